@@ -0,0 +1,72 @@
+//
+//  MAEBDataset.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Parameters of synthetic datasets.
+ */
+typedef struct {
+    /// The number of records in each dataset.
+    NSUInteger records;
+    /// The number of variadic fields in each record.
+    NSUInteger width;
+    /// The probability that a quotable field is quoted. It MUST be in [0, 1].
+    double quoteDensity;
+    /// A seed of the random generator. The same options generate the same datasets.
+    uint64_t seed;
+} MAEBDatasetOptions;
+
+/**
+ * A synthetic dataset of records that have the same shape.
+ */
+@interface MAEBDataset : NSObject
+
+/// The name of the shape
+@property (nonatomic, nonnull, copy, readonly) NSString* name;
+/// A model class that conforms MAEArraySerializing
+@property (nonatomic, nonnull, strong, readonly) Class modelClass;
+/// Records. They do not contain the record terminator.
+@property (nonatomic, nonnull, copy, readonly) NSArray<NSString*>* records;
+/// The total number of UTF-8 bytes of records
+@property (nonatomic, assign, readonly) NSUInteger bytes;
+
+#pragma mark - Lifecycle
+
+/**
+ * Generate datasets of all shapes.
+ *
+ * - numbers:  MAETModel1 (numbers, bool and optional)
+ * - quoted:   MAETModel2 (quoted and optional, separated by space)
+ * - variadic: MAETModel3 (optional and variadic)
+ * - nested:   MAETModel4 (nested by stringTransformerWithArrayModelClass:)
+ * - raw:      MAEBRawModel (MAERaw and MAERawEither)
+ * - tagged:   MAEBTaggedModel (nested by variadicTransformerWithArrayModelClass:)
+ *
+ * @param options  Parameters of datasets
+ * @return Datasets
+ */
++ (NSArray<MAEBDataset*>* _Nonnull)datasetsWithOptions:(MAEBDatasetOptions)options;
+
+/**
+ * Generate strings of integers and floating point numbers.
+ *
+ * @param options  Parameters of datasets. Only records and seed are used.
+ * @return Strings
+ */
++ (NSArray<NSString*>* _Nonnull)numberStringsWithOptions:(MAEBDatasetOptions)options;
+
+/**
+ * Generate strings of bool values.
+ *
+ * @param options  Parameters of datasets. Only records and seed are used.
+ * @return Strings
+ */
++ (NSArray<NSString*>* _Nonnull)boolStringsWithOptions:(MAEBDatasetOptions)options;
+
+@end
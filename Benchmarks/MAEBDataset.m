@@ -0,0 +1,251 @@
+//
+//  MAEBDataset.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEBDataset.h"
+#import "MAEBModels.h"
+#import "MAETModel.h"
+
+/**
+ * A xorshift64* random generator.
+ * It is used instead of random(3), so that datasets are the same on all platforms.
+ */
+typedef struct {
+    uint64_t state;
+} MAEBRandom;
+
+typedef NSString* _Nonnull (^MAEBRecordGenerator)(MAEBRandom* _Nonnull random);
+
+@interface MAEBDataset ()
+@property (nonatomic, nonnull, copy, readwrite) NSString* name;
+@property (nonatomic, nonnull, strong, readwrite) Class modelClass;
+@property (nonatomic, nonnull, copy, readwrite) NSArray<NSString*>* records;
+@property (nonatomic, assign, readwrite) NSUInteger bytes;
+@end
+
+@implementation MAEBDataset
+
+#pragma mark - Functions
+
+static inline MAEBRandom MAEBRandomMake(uint64_t seed)
+{
+    // NOTE: xorshift never leaves the state 0.
+    MAEBRandom random = { seed ^ 0x9E3779B97F4A7C15ULL };
+    return random;
+}
+
+static inline uint64_t MAEBRandomNext(MAEBRandom* _Nonnull random)
+{
+    uint64_t x = random->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    random->state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+static inline NSUInteger MAEBRandomUniform(MAEBRandom* _Nonnull random, NSUInteger bound)
+{
+    return (NSUInteger)(MAEBRandomNext(random) % bound);
+}
+
+static inline BOOL MAEBRandomBool(MAEBRandom* _Nonnull random, double probability)
+{
+    return (double)(MAEBRandomNext(random) >> 11) * 0x1.0p-53 < probability;
+}
+
+/**
+ * Returns a word of 3 to 10 lowercase letters.
+ */
+static NSString* _Nonnull MAEBWord(MAEBRandom* _Nonnull random)
+{
+    char buffer[10];
+    NSUInteger length = 3 + MAEBRandomUniform(random, 8);
+    for (NSUInteger i = 0; i < length; i++) {
+        buffer[i] = (char)('a' + MAEBRandomUniform(random, 26));
+    }
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
+}
+
+/**
+ * Returns a word, or two words joined by the separator and enclosed by the quote.
+ *
+ * @param random        A random generator
+ * @param quoteDensity  The probability that it returns a quoted string
+ * @param separator     A separator of the record
+ * @param quote         A quote character
+ * @return A field
+ */
+static NSString* _Nonnull MAEBField(MAEBRandom* _Nonnull random, double quoteDensity, unichar separator, unichar quote)
+{
+    if (MAEBRandomBool(random, quoteDensity)) {
+        return [NSString stringWithFormat:@"%C%@%C%@%C", quote, MAEBWord(random), separator, MAEBWord(random), quote];
+    }
+    return MAEBWord(random);
+}
+
+static NSString* _Nonnull MAEBVariadicRecord(MAEBRandom* _Nonnull random, MAEBDatasetOptions options)
+{
+    NSMutableArray<NSString*>* fields = [NSMutableArray arrayWithCapacity:options.width + 2];
+    [fields addObject:MAEBWord(random)];
+    [fields addObject:MAEBField(random, options.quoteDensity, ',', '"')];
+    for (NSUInteger i = 0; i < options.width; i++) {
+        [fields addObject:MAEBField(random, options.quoteDensity, ',', '"')];
+    }
+    return [fields componentsJoinedByString:@", "];
+}
+
+#pragma mark - Lifecycle
+
++ (NSArray<MAEBDataset*>* _Nonnull)datasetsWithOptions:(MAEBDatasetOptions)options
+{
+    NSMutableArray<MAEBDataset*>* datasets = [NSMutableArray array];
+
+    [datasets addObject:[self datasetWithName:@"numbers"
+                                   modelClass:MAETModel1.class
+                                      options:options
+                                    generator:^NSString* _Nonnull(MAEBRandom* _Nonnull random) {
+                                        NSMutableString* record = [NSMutableString
+                                            stringWithFormat:@"%d,%llu,%lld,%.2f,%.17g", MAEBRandomBool(random, 0.5),
+                                                             MAEBRandomNext(random) >> 40,
+                                                             (long long)(MAEBRandomNext(random) >> 40) - (1LL << 23),
+                                                             (double)MAEBRandomUniform(random, 1000000) / 100,
+                                                             (double)(MAEBRandomNext(random) >> 11) * 0x1.0p-33];
+                                        if (MAEBRandomBool(random, 0.5)) {
+                                            [record appendFormat:@",%llu", MAEBRandomNext(random) >> 48];
+                                        }
+                                        return record;
+                                    }]];
+
+    [datasets addObject:[self datasetWithName:@"quoted"
+                                   modelClass:MAETModel2.class
+                                      options:options
+                                    generator:^NSString* _Nonnull(MAEBRandom* _Nonnull random) {
+                                        NSMutableArray<NSString*>* fields = [NSMutableArray arrayWithCapacity:3];
+                                        [fields addObject:MAEBField(random, options.quoteDensity, ' ', '\'')];
+                                        if (MAEBRandomBool(random, 0.5)) {
+                                            [fields addObject:MAEBField(random, options.quoteDensity, ' ', '\'')];
+                                        }
+                                        // NOTE: It is MAEQuoted, so it is always quoted.
+                                        [fields addObject:(MAEBRandomBool(random, options.quoteDensity)
+                                                               ? [NSString stringWithFormat:@"\"%@ %@\"", MAEBWord(random),
+                                                                                            MAEBWord(random)]
+                                                               : [NSString stringWithFormat:@"\"%@\"", MAEBWord(random)])];
+                                        return [fields componentsJoinedByString:@" "];
+                                    }]];
+
+    [datasets addObject:[self datasetWithName:@"variadic"
+                                   modelClass:MAETModel3.class
+                                      options:options
+                                    generator:^NSString* _Nonnull(MAEBRandom* _Nonnull random) {
+                                        return MAEBVariadicRecord(random, options);
+                                    }]];
+
+    [datasets addObject:[self datasetWithName:@"nested"
+                                   modelClass:MAETModel4.class
+                                      options:options
+                                    generator:^NSString* _Nonnull(MAEBRandom* _Nonnull random) {
+                                        return [NSString stringWithFormat:@"%@ | %@", MAEBWord(random),
+                                                                          MAEBVariadicRecord(random, options)];
+                                    }]];
+
+    [datasets addObject:[self datasetWithName:@"raw"
+                                   modelClass:MAEBRawModel.class
+                                      options:options
+                                    generator:^NSString* _Nonnull(MAEBRandom* _Nonnull random) {
+                                        NSString* type = @[ @"play", @"pause", @"seek" ][MAEBRandomUniform(random, 3)];
+                                        if (MAEBRandomBool(random, 0.5)) {
+                                            return [NSString stringWithFormat:@"/command %@", type];
+                                        }
+                                        NSString* option = @[ @"head", @"tail" ][MAEBRandomUniform(random, 2)];
+                                        return [NSString stringWithFormat:@"/command %@ %@", type, option];
+                                    }]];
+
+    [datasets addObject:[self datasetWithName:@"tagged"
+                                   modelClass:MAEBTaggedModel.class
+                                      options:options
+                                    generator:^NSString* _Nonnull(MAEBRandom* _Nonnull random) {
+                                        NSMutableArray<NSString*>* fields =
+                                            [NSMutableArray arrayWithCapacity:options.width + 3];
+                                        [fields addObject:MAEBField(random, options.quoteDensity, ',', '"')];
+                                        [fields addObject:MAEBWord(random)];
+                                        [fields addObject:[NSString stringWithFormat:@"%tu", MAEBRandomUniform(random, 100000)]];
+                                        for (NSUInteger i = 0; i < options.width; i++) {
+                                            [fields addObject:MAEBField(random, options.quoteDensity, ',', '"')];
+                                        }
+                                        return [fields componentsJoinedByString:@", "];
+                                    }]];
+
+    return datasets;
+}
+
++ (NSArray<NSString*>* _Nonnull)numberStringsWithOptions:(MAEBDatasetOptions)options
+{
+    MAEBRandom random = MAEBRandomMake(options.seed);
+    NSMutableArray<NSString*>* strings = [NSMutableArray arrayWithCapacity:options.records];
+    for (NSUInteger i = 0; i < options.records; i++) {
+        if (MAEBRandomBool(&random, 0.5)) {
+            [strings addObject:[NSString stringWithFormat:@"%lld", (long long)MAEBRandomNext(&random) >> 20]];
+        } else {
+            [strings addObject:[NSString stringWithFormat:@"%.17g", (double)(MAEBRandomNext(&random) >> 11) * 0x1.0p-33]];
+        }
+    }
+    return strings;
+}
+
++ (NSArray<NSString*>* _Nonnull)boolStringsWithOptions:(MAEBDatasetOptions)options
+{
+    MAEBRandom random = MAEBRandomMake(options.seed);
+    NSArray<NSString*>* candidates = @[ @"true", @"false", @"YES", @"NO", @"1", @"0" ];
+    NSMutableArray<NSString*>* strings = [NSMutableArray arrayWithCapacity:options.records];
+    for (NSUInteger i = 0; i < options.records; i++) {
+        [strings addObject:candidates[MAEBRandomUniform(&random, candidates.count)]];
+    }
+    return strings;
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Create a dataset.
+ *
+ * @param name        The name of the shape
+ * @param modelClass  A model class that conforms MAEArraySerializing
+ * @param options     Parameters of datasets
+ * @param generator   A block that returns a record
+ * @return A dataset
+ */
++ (instancetype _Nonnull)datasetWithName:(NSString* _Nonnull)name
+                              modelClass:(Class _Nonnull)modelClass
+                                 options:(MAEBDatasetOptions)options
+                               generator:(MAEBRecordGenerator _Nonnull)generator
+{
+    // NOTE: Each shape has its own random generator, so adding a shape does not change other datasets.
+    // NOTE: NSString # hash differs between platforms, so it uses FNV-1a.
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (const char* c = name.UTF8String; *c; c++) {
+        hash = (hash ^ (uint8_t)*c) * 0x100000001B3ULL;
+    }
+    MAEBRandom random = MAEBRandomMake(options.seed ^ hash);
+
+    NSMutableArray<NSString*>* records = [NSMutableArray arrayWithCapacity:options.records];
+    NSUInteger bytes = 0;
+    for (NSUInteger i = 0; i < options.records; i++) {
+        NSString* record = generator(&random);
+        bytes += [record lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+        [records addObject:record];
+    }
+
+    MAEBDataset* dataset = [self new];
+    dataset.name = name;
+    dataset.modelClass = modelClass;
+    dataset.records = records;
+    dataset.bytes = bytes;
+    return dataset;
+}
+
+@end
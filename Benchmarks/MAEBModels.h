@@ -0,0 +1,45 @@
+//
+//  MAEBModels.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import <Foundation/Foundation.h>
+
+/**
+ * A model that has raw fragments.
+ *
+ * e.g. "/command play head"
+ */
+@interface MAEBRawModel : MTLModel <MAEArraySerializing>
+
+@property (nonatomic, nullable, copy) NSString* type;
+@property (nonatomic, nullable, copy) NSString* option;
+
+@end
+
+/**
+ * A model that is created from the rest of MAEBTaggedModel by variadicTransformerWithArrayModelClass:.
+ */
+@interface MAEBDetailModel : MTLModel <MAEArraySerializing>
+
+@property (nonatomic, nullable, copy) NSString* identifier;
+@property (nonatomic, assign) NSInteger score;
+@property (nonatomic, nullable, copy) NSArray<NSString*>* tags;
+
+@end
+
+/**
+ * A model that has a nested model defined by MAEVariadic.
+ *
+ * e.g. "name, identifier, 10, tag1, \"tag 2\""
+ */
+@interface MAEBTaggedModel : MTLModel <MAEArraySerializing>
+
+@property (nonatomic, nullable, copy) NSString* name;
+@property (nonatomic, nullable, strong) MAEBDetailModel* detail;
+
+@end
@@ -0,0 +1,73 @@
+//
+//  MAEBModels.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEBModels.h"
+
+@implementation MAEBRawModel
+
+#pragma mark - MAEArraySerializing
+
++ (NSArray* _Nonnull)formatByPropertyKey
+{
+    return @[ MAERaw(@"/command"), MAERawEither(@[ @"play", @"pause", @"seek" ]).withProperty(@"type"),
+              MAEOptional(MAERawEither(@[ @"head", @"tail" ]).withProperty(@"option")) ];
+}
+
++ (unichar)separator
+{
+    return ' ';
+}
+
+@end
+
+@implementation MAEBDetailModel
+
+#pragma mark - MAEArraySerializing
+
++ (NSArray* _Nonnull)formatByPropertyKey
+{
+    return @[ @"identifier", @"score", MAEVariadic(@"tags") ];
+}
+
++ (unichar)separator
+{
+    return ',';
+}
+
++ (BOOL)ignoreEdgeBlank
+{
+    return YES;
+}
+
+@end
+
+@implementation MAEBTaggedModel
+
+#pragma mark - MAEArraySerializing
+
++ (NSArray* _Nonnull)formatByPropertyKey
+{
+    return @[ @"name", MAEVariadic(@"detail") ];
+}
+
++ (unichar)separator
+{
+    return ',';
+}
+
++ (BOOL)ignoreEdgeBlank
+{
+    return YES;
+}
+
++ (NSValueTransformer* _Nonnull)detailArrayTransformer
+{
+    return [MAEArrayAdapter variadicTransformerWithArrayModelClass:MAEBDetailModel.class];
+}
+
+@end
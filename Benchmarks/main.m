@@ -0,0 +1,307 @@
+//
+//  main.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import "MAEBDataset.h"
+#import "MAETModel.h"
+#import <Foundation/Foundation.h>
+#import <time.h>
+#ifdef GNUSTEP
+#import <Foundation/NSDebug.h>
+#endif
+
+/**
+ * A block that processes all inputs once.
+ *
+ * @return The number of failures. It MUST be 0.
+ */
+typedef NSUInteger (^MAEBBlock)(void);
+
+#pragma mark - Functions
+
+static double MAEBNow(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+#ifdef GNUSTEP
+/**
+ * Returns the total number of Objective-C objects that are allocated while allocation debugging is active.
+ */
+static NSUInteger MAEBAllocationCount(void)
+{
+    NSUInteger count = 0;
+    for (Class* classes = GSDebugAllocationClassList(); classes && *classes; classes++) {
+        count += (NSUInteger)GSDebugAllocationTotal(*classes);
+    }
+    return count;
+}
+#endif
+
+/**
+ * Measure the block.
+ *
+ * It runs the block once for warm-up, and `iterations` times for the time.
+ * Allocations are counted in another run, because counting them slows down the block.
+ *
+ * @param shape       The name of the dataset
+ * @param operation   The name of the measured method
+ * @param records     The number of inputs that the block processes
+ * @param bytes       The number of UTF-8 bytes of records that the block processes
+ * @param iterations  The number of times to measure
+ * @param block       A block
+ * @return A result that can be serialized by NSJSONSerialization
+ */
+static NSDictionary* _Nonnull MAEBMeasure(NSString* _Nonnull shape, NSString* _Nonnull operation, NSUInteger records,
+                                          NSUInteger bytes, NSUInteger iterations, MAEBBlock _Nonnull block)
+{
+    NSUInteger failures;
+    @autoreleasepool {
+        failures = block();
+    }
+
+    NSMutableArray<NSNumber*>* times = [NSMutableArray arrayWithCapacity:iterations];
+    for (NSUInteger i = 0; i < iterations; i++) {
+        @autoreleasepool {
+            double start = MAEBNow();
+            failures += block();
+            [times addObject:@(MAEBNow() - start)];
+        }
+    }
+    [times sortUsingSelector:@selector(compare:)];
+
+    id allocationsPerRecord = NSNull.null;
+#ifdef GNUSTEP
+    GSDebugAllocationActive(YES);
+    NSUInteger before = MAEBAllocationCount();
+    @autoreleasepool {
+        failures += block();
+    }
+    allocationsPerRecord = @((double)(MAEBAllocationCount() - before) / records);
+    GSDebugAllocationActive(NO);
+#endif
+
+    if (failures > 0) {
+        fprintf(stderr, "%s %s failed %tu times\n", shape.UTF8String, operation.UTF8String, failures);
+        exit(EXIT_FAILURE);
+    }
+
+    double median = times[iterations / 2].doubleValue;
+    fprintf(stderr, "%-10s %-40s %12.0f records/s %10.2f MB/s\n", shape.UTF8String, operation.UTF8String,
+            records / median, bytes / median / 1e6);
+
+    return @{ @"shape" : shape,
+              @"operation" : operation,
+              @"records" : @(records),
+              @"bytes" : @(bytes),
+              @"iterations" : @(iterations),
+              @"medianSeconds" : @(median),
+              @"minSeconds" : times.firstObject,
+              @"recordsPerSecond" : @(records / median),
+              @"bytesPerSecond" : @(bytes / median),
+              @"allocationsPerRecord" : allocationsPerRecord };
+}
+
+/**
+ * Measure conversions of the dataset by MAEArrayAdapter.
+ *
+ * @param dataset     A dataset
+ * @param iterations  The number of times to measure
+ * @return Results
+ */
+static NSArray<NSDictionary*>* _Nonnull MAEBMeasureDataset(MAEBDataset* _Nonnull dataset, NSUInteger iterations)
+{
+    MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:dataset.modelClass];
+    NSArray<NSString*>* records = dataset.records;
+
+    // NOTE: Inputs of stringFromModel and modelFromArray are created from records, and it is not measured.
+    NSMutableArray<id<MAEArraySerializing> >* models = [NSMutableArray arrayWithCapacity:records.count];
+    NSMutableArray<NSArray*>* arrays = [NSMutableArray arrayWithCapacity:records.count];
+    for (NSString* record in records) {
+        NSError* error = nil;
+        id<MAEArraySerializing> model = [adapter modelFromString:record error:&error];
+        NSArray* array = model ? [adapter arrayFromModel:model error:&error] : nil;
+        if (!array) {
+            fprintf(stderr, "%s: \"%s\" is invalid: %s\n", dataset.name.UTF8String, record.UTF8String,
+                    error.description.UTF8String);
+            exit(EXIT_FAILURE);
+        }
+        [models addObject:model];
+        [arrays addObject:array];
+    }
+
+    NSUInteger count = records.count, bytes = dataset.bytes;
+    return @[
+        MAEBMeasure(dataset.name, @"modelFromString:error:", count, bytes, iterations,
+                    ^NSUInteger {
+                        NSUInteger failures = 0;
+                        for (NSString* record in records) {
+                            failures += [adapter modelFromString:record error:nil] == nil;
+                        }
+                        return failures;
+                    }),
+        MAEBMeasure(dataset.name, @"stringFromModel:error:", count, bytes, iterations,
+                    ^NSUInteger {
+                        NSUInteger failures = 0;
+                        for (id<MAEArraySerializing> model in models) {
+                            failures += [adapter stringFromModel:model error:nil] == nil;
+                        }
+                        return failures;
+                    }),
+        MAEBMeasure(dataset.name, @"modelFromArray:error:", count, bytes, iterations,
+                    ^NSUInteger {
+                        NSUInteger failures = 0;
+                        for (NSArray* array in arrays) {
+                            failures += [adapter modelFromArray:array error:nil] == nil;
+                        }
+                        return failures;
+                    }),
+    ];
+}
+
+/**
+ * Measure both directions of the transformer.
+ *
+ * @param shape        The name of inputs
+ * @param transformer  A transformer
+ * @param values       Inputs of transformedValue:success:error:
+ * @param iterations   The number of times to measure
+ * @return Results
+ */
+static NSArray<NSDictionary*>* _Nonnull MAEBMeasureTransformer(
+    NSString* _Nonnull shape, NSValueTransformer<MTLTransformerErrorHandling>* _Nonnull transformer,
+    NSArray* _Nonnull values, NSUInteger iterations)
+{
+    NSMutableArray* reverseValues = [NSMutableArray arrayWithCapacity:values.count];
+    NSUInteger bytes = 0;
+    for (id value in values) {
+        BOOL success = NO;
+        NSError* error = nil;
+        id transformedValue = [transformer transformedValue:value success:&success error:&error];
+        if (!success) {
+            fprintf(stderr, "%s: \"%s\" is invalid: %s\n", shape.UTF8String, [value description].UTF8String,
+                    error.description.UTF8String);
+            exit(EXIT_FAILURE);
+        }
+        [reverseValues addObject:transformedValue];
+        // NOTE: Arrays are counted as records that are joined by a separator.
+        NSString* string = [value isKindOfClass:NSArray.class] ? [value componentsJoinedByString:@","] : value;
+        bytes += [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    }
+
+    return @[
+        MAEBMeasure(shape, @"transformedValue:success:error:", values.count, bytes, iterations,
+                    ^NSUInteger {
+                        NSUInteger failures = 0;
+                        for (id value in values) {
+                            BOOL success = NO;
+                            [transformer transformedValue:value success:&success error:nil];
+                            failures += !success;
+                        }
+                        return failures;
+                    }),
+        MAEBMeasure(shape, @"reverseTransformedValue:success:error:", values.count, bytes, iterations,
+                    ^NSUInteger {
+                        NSUInteger failures = 0;
+                        for (id value in reverseValues) {
+                            BOOL success = NO;
+                            [transformer reverseTransformedValue:value success:&success error:nil];
+                            failures += !success;
+                        }
+                        return failures;
+                    }),
+    ];
+}
+
+#pragma mark - Main
+
+/**
+ * Usage: MAEBenchmark [-records 10000] [-width 8] [-quoteDensity 0.25] [-iterations 5] [-seed 1]
+ *                     [-shapes numbers,quoted,...] [-output path]
+ *
+ * It prints a summary to stderr, and writes results as JSON to the output (default: stdout).
+ */
+int main(int argc, const char* argv[])
+{
+    @autoreleasepool {
+        NSUserDefaults* defaults = NSUserDefaults.standardUserDefaults;
+        [defaults registerDefaults:@{ @"records" : @10000,
+                                      @"width" : @8,
+                                      @"quoteDensity" : @0.25,
+                                      @"iterations" : @5,
+                                      @"seed" : @1 }];
+
+        MAEBDatasetOptions options;
+        options.records = (NSUInteger)MAX([defaults integerForKey:@"records"], 1);
+        options.width = (NSUInteger)MAX([defaults integerForKey:@"width"], 0);
+        options.quoteDensity = MIN(MAX([defaults doubleForKey:@"quoteDensity"], 0), 1);
+        options.seed = (uint64_t)[defaults integerForKey:@"seed"];
+        NSUInteger iterations = (NSUInteger)MAX([defaults integerForKey:@"iterations"], 1);
+
+        NSString* shapesString = [defaults stringForKey:@"shapes"];
+        NSSet<NSString*>* shapes = shapesString ? [NSSet setWithArray:[shapesString componentsSeparatedByString:@","]] : nil;
+
+        NSArray<MAEBDataset*>* datasets = [MAEBDataset datasetsWithOptions:options];
+        NSMutableArray<NSDictionary*>* results = [NSMutableArray array];
+        for (MAEBDataset* dataset in datasets) {
+            if (!shapes || [shapes containsObject:dataset.name]) {
+                [results addObjectsFromArray:MAEBMeasureDataset(dataset, iterations)];
+            }
+        }
+
+        // NOTE: Inputs of the transformers for MAETModel3 are created from the variadic dataset.
+        NSArray<NSString*>* variadicRecords =
+            [datasets filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"name == 'variadic'"]]
+                .firstObject.records;
+        NSMutableArray<NSArray*>* variadicArrays = [NSMutableArray arrayWithCapacity:variadicRecords.count];
+        for (NSString* record in variadicRecords) {
+            id<MAEArraySerializing> model = [MAEArrayAdapter modelOfClass:MAETModel3.class fromString:record error:nil];
+            [variadicArrays addObject:[MAEArrayAdapter arrayFromModel:model error:nil] ?: @[]];
+        }
+
+        NSArray<NSArray*>* transformers = @[
+            @[ @"numberTransformer", [MAEArrayAdapter numberTransformer], [MAEBDataset numberStringsWithOptions:options] ],
+            @[ @"boolTransformer", [MAEArrayAdapter boolTransformer], [MAEBDataset boolStringsWithOptions:options] ],
+            @[ @"stringTransformer", [MAEArrayAdapter stringTransformerWithArrayModelClass:MAETModel3.class],
+               variadicRecords ],
+            @[ @"variadicTransformer", [MAEArrayAdapter variadicTransformerWithArrayModelClass:MAETModel3.class],
+               variadicArrays ],
+        ];
+        for (NSArray* transformer in transformers) {
+            if (!shapes || [shapes containsObject:transformer[0]]) {
+                [results addObjectsFromArray:MAEBMeasureTransformer(transformer[0], transformer[1], transformer[2],
+                                                                    iterations)];
+            }
+        }
+
+        NSDictionary* report = @{
+            @"options" : @{ @"records" : @(options.records),
+                            @"width" : @(options.width),
+                            @"quoteDensity" : @(options.quoteDensity),
+                            @"seed" : @(options.seed),
+                            @"iterations" : @(iterations) },
+            @"environment" : @{ @"operatingSystem" : NSProcessInfo.processInfo.operatingSystemVersionString,
+                                @"processorCount" : @(NSProcessInfo.processInfo.processorCount) },
+            @"results" : results,
+        };
+
+        NSError* error = nil;
+        NSData* json = [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:&error];
+        NSString* output = [defaults stringForKey:@"output"];
+        if (!json || (output && ![json writeToFile:output options:NSDataWritingAtomic error:&error])) {
+            fprintf(stderr, "Failed to write results: %s\n", error.description.UTF8String);
+            return EXIT_FAILURE;
+        }
+        if (!output) {
+            [NSFileHandle.fileHandleWithStandardOutput writeData:json];
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -7,119 +7,49 @@
 //
 
 #import "MAEArrayAdapter.h"
+#import "MAEModelTransformer.h"
+#import "MAENumberTransformer.h"
 #import "NSError+MAEErrorCode.h"
 #import <Mantle/MTLValueTransformer.h>
-#import <Mantle/NSValueTransformer+MTLPredefinedTransformerAdditions.h>
 
 @implementation MAEArrayAdapter (Transformers)
 
 + (NSValueTransformer<MTLTransformerErrorHandling>* _Nonnull)
     variadicTransformerWithArrayModelClass:(Class _Nonnull)modelClass
 {
-    return [MTLValueTransformer
-        transformerUsingForwardBlock:
-            ^id _Nullable(NSArray* _Nullable value, BOOL* _Nonnull success, NSError* _Nullable* _Nullable error) {
-                if (!value) {
-                    *success = YES;
-                    return nil;
-                }
-
-                if (![value isKindOfClass:NSArray.class]) {
-                    SET_ERROR(error, MAEErrorInvalidInputData,
-                              @{ NSLocalizedFailureReasonErrorKey :
-                                     format(@"%s only support NSArray, but got %@", __FUNCTION__, value.class),
-                                 MAEErrorInputDataKey : value });
-                    *success = NO;
-                    return nil;
-                }
-                id model = [self modelOfClass:modelClass fromArray:value error:error];
-                *success = model != nil;
-                return model;
-            }
-        reverseBlock:
-            ^NSArray* _Nullable(MTLModel<MAEArraySerializing>* _Nullable value, BOOL* _Nonnull success,
-                                NSError* _Nullable* _Nullable error) {
-                if (!value) {
-                    *success = YES;
-                    return nil;
-                }
-
-                if (!([value isKindOfClass:MTLModel.class] &&
-                      [value conformsToProtocol:@protocol(MAEArraySerializing)])) {
-                    SET_ERROR(error, MAEErrorInvalidInputData,
-                              @{ NSLocalizedFailureReasonErrorKey :
-                                     format(@"%s only support MAEArraySerializing MTLModel, but got %@",
-                                            __FUNCTION__, value.class),
-                                 MAEErrorInputDataKey : value });
-                    *success = NO;
-                    return nil;
-                }
-
-                NSArray* array = [self arrayFromModel:value error:error];
-                *success = array != nil;
-                return array;
-            }];
+    return [[MAEModelTransformer alloc] initWithAdapterClass:self modelClass:modelClass variadic:YES];
 }
 
 + (NSValueTransformer<MTLTransformerErrorHandling>* _Nonnull)
     stringTransformerWithArrayModelClass:(Class _Nonnull)modelClass
 {
-    return [MTLValueTransformer
-        transformerUsingForwardBlock:
-            ^id _Nullable(NSString* _Nullable value, BOOL* _Nonnull success, NSError* _Nullable* _Nullable error) {
-                if (!value) {
-                    *success = YES;
-                    return nil;
-                }
-
-                if (![value isKindOfClass:NSString.class]) {
-                    SET_ERROR(error, MAEErrorInvalidInputData,
-                              @{ NSLocalizedFailureReasonErrorKey :
-                                     format(@"%s only support NSString, but got %@", __FUNCTION__, value.class),
-                                 MAEErrorInputDataKey : value });
-                    *success = NO;
-                    return nil;
-                }
-                id model = [self modelOfClass:modelClass fromString:value error:error];
-                *success = model != nil;
-                return model;
-            }
-        reverseBlock:
-            ^NSString* _Nullable(MTLModel<MAEArraySerializing>* _Nullable value, BOOL* _Nonnull success,
-                                 NSError* _Nullable* _Nullable error) {
-                if (!value) {
-                    *success = YES;
-                    return nil;
-                }
-
-                if (!([value isKindOfClass:MTLModel.class] &&
-                      [value conformsToProtocol:@protocol(MAEArraySerializing)])) {
-                    SET_ERROR(error, MAEErrorInvalidInputData,
-                              @{ NSLocalizedFailureReasonErrorKey :
-                                     format(@"%s only support MAEArraySerializing MTLModel, but got %@",
-                                            __FUNCTION__, value.class),
-                                 MAEErrorInputDataKey : value });
-                    *success = NO;
-                    return nil;
-                }
-
-                NSString* str = [self stringFromModel:value error:error];
-                *success = str != nil;
-                return str;
-            }];
+    return [[MAEModelTransformer alloc] initWithAdapterClass:self modelClass:modelClass variadic:NO];
 }
 
 + (NSValueTransformer<MTLTransformerErrorHandling>* _Nonnull)numberTransformer
 {
-    NSNumberFormatter* formatter = [NSNumberFormatter new];
-    formatter.numberStyle = NSNumberFormatterDecimalStyle;
-    formatter.usesGroupingSeparator = NO;
-    formatter.maximumSignificantDigits = 15; // Number of digits that can be represented by double.
-
-    return [MTLValueTransformer mtl_transformerWithFormatter:formatter forObjectClass:NSNumber.class];
+    // NOTE: The transformer is stateless, so it is shared by all properties.
+    return [MAENumberTransformer numberTransformer];
 }
 
 + (NSValueTransformer<MTLTransformerErrorHandling>* _Nonnull)boolTransformer
+{
+    static NSValueTransformer<MTLTransformerErrorHandling>* transformer = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        transformer = [self makeBoolTransformer];
+    });
+    return transformer;
+}
+
+#pragma mark - Private Methods
+
+/**
+ * It creates a transformer for converting between bool and NSString.
+ *
+ * @return A transformer
+ */
++ (NSValueTransformer<MTLTransformerErrorHandling>* _Nonnull)makeBoolTransformer
 {
     return [MTLValueTransformer
         transformerUsingForwardBlock:
@@ -136,7 +66,7 @@
                     *success = NO;
                     return nil;
                 }
-                return [NSNumber numberWithBool:[str boolValue]];
+                return MAEBoolValue(str) ? @YES : @NO;
             }
         reverseBlock:^NSString* _Nullable(NSNumber* _Nullable num, BOOL* _Nonnull success, NSError* _Nullable* _Nullable error) {
             *success = YES;
@@ -6,19 +6,54 @@
 //  Copyright © 2017年 Hinagiku Soranoba. All rights reserved.
 //
 
+#import "MAEArrayMetrics.h"
+#import "MAEColumnarBatch.h"
 #import "MAEErrorCode.h"
+#import "MAEModelPool.h"
 #import "MAERawFragment.h"
+#import "MAERecordFilter.h"
 #import "MAESeparatedString.h"
 #import <Foundation/Foundation.h>
 #import <Mantle/MTLModel.h>
 #import <Mantle/MTLTransformerErrorHandling.h>
 
+@class MAETokenizer;
+
 typedef NS_OPTIONS(NSUInteger, MAEArrayQuotedOptions) {
     MAEArrayQuotedNone = 0,
     MAEArraySingleQuotedEnable = 0x1,
     MAEArrayDoubleQuotedEnable = 0x1 << 1,
 };
 
+typedef NS_OPTIONS(NSUInteger, MAEArrayAdapterOptions) {
+    MAEArrayAdapterOptionNone = 0,
+    /// It does not call MTLModel # validate: after conversion to model.
+    /// Please use it only for trusted input.
+    MAEArrayAdapterSkipValidation = 0x1,
+};
+
+typedef NS_ENUM(NSUInteger, MAEMemoizationEviction) {
+    /// If the memo is full, the least recently used value is evicted.
+    MAEMemoizationEvictionLeastRecentlyUsed = 0,
+    /// If the memo is full, new values are not memoized.
+    /// It does not track recency of values, so it is suitable for properties that have a few distinct values.
+    MAEMemoizationEvictionNone,
+};
+
+/**
+ * Statistics of memoized transformations of a property.
+ */
+typedef struct MAEMemoizationStatistics {
+    /// The number of transformations that returned a memoized value
+    NSUInteger hitCount;
+    /// The number of transformations that did not find a memoized value, and called the transformer
+    NSUInteger missCount;
+    /// The number of values that were evicted from the memo
+    NSUInteger evictionCount;
+    /// The number of values that are memoized now
+    NSUInteger count;
+} MAEMemoizationStatistics;
+
 @protocol MAEArraySerializing <MTLModel>
 
 /**
@@ -85,6 +120,28 @@ typedef NS_OPTIONS(NSUInteger, MAEArrayQuotedOptions) {
  */
 + (Class<MAEArraySerializing> _Nullable)classForParsingArray:(NSArray<MAESeparatedString*>* _Nonnull)array;
 
+/**
+ * If you want to use different classes based on the value of a field, you can use this.
+ *
+ * The class is looked up by the content of the field at +discriminatorIndex. (Quotes and escapes are removed.)
+ * It is checked before classForParsingArray:, and it does not create any separatedString.
+ * If the class has the same separator, ignoreEdgeBlank and quotedOptions as the receiver,
+ * the adapter of the class reuses fields that have already been split.
+ *
+ * If the value is not found, classForParsingArray: is used if it is implemented.
+ * Otherwise, the conversion fails with MAEErrorNoConversionTarget.
+ *
+ * @return MAEArraySerializing classes keyed by the value of the field. It can contain the receiver itself.
+ */
++ (NSDictionary<NSString*, Class>* _Nonnull)classesByDiscriminator;
+
+/**
+ * The index of the field that is used by classesByDiscriminator.
+ *
+ * Default is 0.
+ */
++ (NSUInteger)discriminatorIndex;
+
 /**
  * If you want to select quotes to use, you can use this.
  *
@@ -94,12 +151,161 @@ typedef NS_OPTIONS(NSUInteger, MAEArrayQuotedOptions) {
  */
 + (MAEArrayQuotedOptions)quotedOptions;
 
+/**
+ * If you want to memoize results of an expensive transformer of the property, you can use this.
+ *
+ * Returning a positive number declares that the transformer of the property is pure, that is,
+ *   - It returns equal values for equal inputs, and it does not have side effects.
+ *   - Returned values are immutable, because they are shared between models (and threads).
+ * Forward transformations are memoized by the original characters of fields, and reverse transformations are
+ * memoized by values. (Equal values by isEqual: MUST be transformed to the same string,
+ * except that numbers of different types are memoized separately. e.g. @1, @1.0 and @YES)
+ * Failed transformations are not memoized.
+ *
+ * Numbers, bools and nested models are not memoized, because the adapter converts them without the memo.
+ * Each adapter has its own memo. (Please refer to memoizationStatisticsForPropertyKey:)
+ *
+ * @param key  A property key
+ * @return The maximum number of values that are memoized for each direction. Default is 0 (not memoized).
+ */
++ (NSUInteger)memoizationCapacityForKey:(NSString* _Nonnull)key;
+
+/**
+ * Specifies how to evict memoized values of the property, if the memo is full.
+ *
+ * Default is MAEMemoizationEvictionLeastRecentlyUsed.
+ *
+ * @param key  A property key that memoizationCapacityForKey: returns a positive number
+ * @return An eviction policy
+ */
++ (MAEMemoizationEviction)memoizationEvictionForKey:(NSString* _Nonnull)key;
+
 @end
 
 @interface MAEArrayAdapter : NSObject
 
+/// MAEArraySerializing model class
+@property (nonatomic, nonnull, strong, readonly) Class modelClass;
+/// A cached copy of the return value of +separator
+@property (nonatomic, assign, readonly) unichar separator;
+/// A cached copy of the return value of +ignoreEdgeBlank
+@property (nonatomic, assign, readonly) BOOL ignoreEdgeBlank;
+/// A cached copy of the return value of +quotedOptions
+@property (nonatomic, assign, readonly) MAEArrayQuotedOptions quotedOptions;
+/// A tokenizer that has the same separator, ignoreEdgeBlank and quotedOptions as the adapter.
+@property (nonatomic, nonnull, strong, readonly) MAETokenizer* tokenizer;
+/// Options of conversion. Default is MAEArrayAdapterOptionNone.
+@property (nonatomic, assign, readonly) MAEArrayAdapterOptions options;
+/// Property keys that are converted from records. If it is nil, all properties are converted.
+@property (nonatomic, nullable, copy, readonly) NSSet<NSString*>* projectedKeys;
+/// Filters that records MUST pass. If it is nil, all records are accepted.
+@property (nonatomic, nullable, copy, readonly) NSArray<MAERecordFilter*>* filters;
+/// A pool that models are taken from before they are created. If it is nil, models are always created.
+@property (nonatomic, nullable, strong, readonly) MAEModelPool* modelPool;
+
+#pragma mark - Lifecycle
+
+/**
+ * Returns an adapter for the model class.
+ *
+ * Adapters are immutable and cached per model class, so it returns the same instance for the same class.
+ * It is thread-safe, and it does not take any lock once the adapter is cached.
+ *
+ * @param modelClass MAEArraySerializing model class
+ * @return An adapter
+ */
++ (instancetype _Nonnull)adapterForModelClass:(Class _Nonnull)modelClass;
+
+/**
+ * Returns an adapter that has the same model class as the receiver and the specified options.
+ *
+ * The returned adapter is not cached, so please keep it while you use it.
+ * Options only affect models of the receiver's class. (Nested models are converted by cached adapters)
+ *
+ * @param options Options of conversion
+ * @return An adapter
+ */
+- (instancetype _Nonnull)adapterWithOptions:(MAEArrayAdapterOptions)options;
+
+/**
+ * Returns an adapter that has the same model class and options as the receiver,
+ * and converts only the specified properties from records.
+ *
+ * Fields are still separated and the format is chosen by the number of all fields,
+ * but fields of other fragments are not validated nor transformed, and their properties keep default values.
+ * MTLModel # validate: is called for the model that has default values, unless MAEArrayAdapterSkipValidation is set.
+ * Conversion to string is not affected. If a record is converted to another class
+ * (+classForParsingArray: or +classesByDiscriminator), the cached adapter of the class converts all properties.
+ *
+ * The returned adapter is not cached, so please keep it while you use it.
+ *
+ * @param propertyKeys  Property keys in formatByPropertyKey. If it is nil, all properties are converted.
+ * @return An adapter
+ */
+- (instancetype _Nonnull)adapterProjectingKeys:(NSSet<NSString*>* _Nullable)propertyKeys;
+
+/**
+ * Returns an adapter that has the same model class, options and projection as the receiver,
+ * and converts only records that pass all filters.
+ *
+ * Filters are tested right after separating a record, and the format is chosen by the number of fields.
+ * If a field of the filter is omitted (MAEOptional), the record is rejected.
+ * A rejected record is not validated nor transformed, and the conversion fails with MAEErrorRejectedByFilter.
+ * Batch conversions save the error for the record as other errors, except the following.
+ *   - columnarBatchFromData:recordSeparator:errors: does not append rows for rejected records.
+ *     (Please refer to MAEColumnarBatch # rejectedCount)
+ *   - MAEArrayReader skips rejected records. (Please refer to MAEArrayReader # filters)
+ *
+ * The returned adapter is not cached, so please keep it while you use it.
+ *
+ * @param filters  Filters. If it is nil or empty, all records are accepted.
+ * @return An adapter
+ */
+- (instancetype _Nonnull)adapterWithFilters:(NSArray<MAERecordFilter*>* _Nullable)filters;
+
+/**
+ * Returns an adapter that has the same model class, options, projection and filters as the receiver,
+ * and reuses models in the pool instead of creating them.
+ *
+ * It affects all conversions from string (or data, array) to model, including batch conversions.
+ * Models are reused only if the adapter sets properties without MTLModel # initWithDictionary:error:
+ * (Please refer to populateModel:fromString:error:). Nested models are always created.
+ *
+ * The returned adapter is not cached, so please keep it while you use it.
+ *
+ * @param modelPool  A pool. If it is nil, models are always created.
+ * @return An adapter
+ */
+- (instancetype _Nonnull)adapterWithModelPool:(MAEModelPool* _Nullable)modelPool;
+
 #pragma mark - Public Methods
 
+/**
+ * Set an observer that receives metrics of conversion from string (or array) to model by all adapters.
+ *
+ * If it is nil (default), metrics are disabled and each phase costs only one predictable branch.
+ * The adapter retains the observer. The old observer is released after conversions on other threads
+ * finish reporting to it, so it MUST NOT be called from the observer.
+ *
+ * @param observer An observer (e.g. MAEArrayMetrics), or nil
+ */
++ (void)setMetricsObserver:(id<MAEArrayMetricsObserver> _Nullable)observer;
+
+/**
+ * Returns the observer that is set by setMetricsObserver:.
+ *
+ * @return An observer, or nil
+ */
++ (id<MAEArrayMetricsObserver> _Nullable)metricsObserver;
+
+/**
+ * Returns statistics of memoized transformations of the property by the adapter.
+ *
+ * @param propertyKey  A property key
+ * @return If the property is not memoized, all values are 0. Otherwise, it returns statistics.
+ */
+- (MAEMemoizationStatistics)memoizationStatisticsForPropertyKey:(NSString* _Nonnull)propertyKey;
+
 /**
  * Convert to model from string
  *
@@ -112,6 +318,23 @@ typedef NS_OPTIONS(NSUInteger, MAEArrayQuotedOptions) {
                                        fromString:(NSString* _Nullable)string
                                             error:(NSError* _Nullable* _Nullable)error;
 
+/**
+ * Convert to model from UTF-8 data
+ *
+ * It splits the bytes into fields without converting the whole data to a string,
+ * and creates strings only for fields that need them. Numbers and bools parsed by the default transformers
+ * are set without creating any string.
+ * Invalid UTF-8 sequences are detected in fields that are converted to strings.
+ *
+ * @param modelClass MAEArraySerializing model class
+ * @param data       UTF-8 data of a record
+ * @param error      If it return nil, error information is saved here.
+ * @return If conversion is success, it returns model object. Otherwise, it returns nil.
+ */
++ (id<MAEArraySerializing> _Nullable)modelOfClass:(Class _Nonnull)modelClass
+                                         fromData:(NSData* _Nullable)data
+                                            error:(NSError* _Nullable* _Nullable)error;
+
 /**
  * Convert to model from array
  *
@@ -143,18 +366,184 @@ typedef NS_OPTIONS(NSUInteger, MAEArrayQuotedOptions) {
 + (NSString* _Nullable)stringFromModel:(id<MAEArraySerializing> _Nullable)model
                                  error:(NSError* _Nullable* _Nullable)error;
 
+/**
+ * Convert to models from strings concurrently
+ *
+ * Records are divided into chunks, and the chunks are converted on a concurrent queue.
+ * Each chunk has its own autorelease pool.
+ * MAEArraySerializing classes and transformers used by them MUST be thread-safe.
+ *
+ * @param modelClass  MAEArraySerializing model class
+ * @param strings     An array of records
+ * @param errors      Errors keyed by the index of the record that could not be converted.
+ *                    If all records are converted, nil is saved here.
+ * @return An array in the same order as strings. The element is NSNull, if the record could not be converted.
+ */
++ (NSArray* _Nonnull)modelsOfClass:(Class _Nonnull)modelClass
+                       fromStrings:(NSArray<NSString*>* _Nonnull)strings
+                            errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors;
+
+/**
+ * Convert to models from a string that contains records concurrently
+ *
+ * The separator enclosed in quoted-string or escaped by backslash is not treated as the end of record.
+ * Empty records are ignored. If the separator is '\n', the trailing '\r' of each record is also ignored.
+ *
+ * @param modelClass       MAEArraySerializing model class
+ * @param string           A string that contains records
+ * @param recordSeparator  The character that separates records. (e.g. '\n')
+ * @param errors           Errors keyed by the index of the record (ignoring empty records).
+ *                         If all records are converted, nil is saved here.
+ * @return An array in the same order as records. The element is NSNull, if the record could not be converted.
+ * @see modelsOfClass:fromStrings:errors:
+ */
++ (NSArray* _Nonnull)modelsOfClass:(Class _Nonnull)modelClass
+                        fromString:(NSString* _Nonnull)string
+                   recordSeparator:(unichar)recordSeparator
+                            errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors;
+
+/**
+ * Convert records of UTF-8 data into columns, without creating any model.
+ *
+ * Each property in formatByPropertyKey has a column, and each record has a row.
+ * Integer, floating point and bool properties that use the default transformers are stored as primitive values,
+ * and other properties are stored as characters of fields without their transformers.
+ * Fragments are validated, but models are not created, so MTLModel # validate: is not called.
+ * +classForParsingArray: and +classesByDiscriminator are not used, and all records are treated as the model class.
+ *
+ * Records are separated in the same way as modelsOfClass:fromString:recordSeparator:errors:.
+ * If a record could not be converted, its row is invalid in all columns.
+ *
+ * @param modelClass       MAEArraySerializing model class
+ * @param data             UTF-8 data that contains records
+ * @param recordSeparator  The character that separates records. It MUST be ASCII.
+ * @param errors           Errors of rows that could not be converted are saved here by the index of row.
+ *                         If all records are converted, nil is saved.
+ * @return A columnar batch
+ */
++ (MAEColumnarBatch* _Nonnull)columnarBatchOfClass:(Class _Nonnull)modelClass
+                                          fromData:(NSData* _Nonnull)data
+                                   recordSeparator:(unichar)recordSeparator
+                                            errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors;
+
+/**
+ * Convert rows of the columnar batch to records of UTF-8 data, without creating any model.
+ *
+ * The model class of the batch defines the format (formatByPropertyKey, separator and fragment types),
+ * and each row is followed by recordSeparator.
+ * Values of int64, double and bool columns are printed in the same way as the default number and bool transformers,
+ * and values of string columns are written as characters of fields without their transformers.
+ * So a row is the same as stringFromModel:error: of the model that columnarBatchOfClass:fromData:recordSeparator:errors:
+ * decodes, if properties use the default transformers.
+ *
+ * A row that is invalid in a column (or that does not have the column) is treated as nil.
+ * The field of MAEOptional is omitted, and MAEVariadic has no fields. For other fragments, the conversion fails.
+ * Rows are converted in parallel, and they are written in order.
+ *
+ * @param batch            A columnar batch. Columns can be created from buffers. (Please refer to MAEColumn)
+ * @param recordSeparator  The character that is written after each record. It MUST be ASCII.
+ * @param error            If it return nil, error information of the first row that could not be converted is saved here.
+ * @return UTF-8 data
+ */
++ (NSData* _Nullable)dataFromColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+                           recordSeparator:(unichar)recordSeparator
+                                     error:(NSError* _Nullable* _Nullable)error;
+
 /**
  * @see modelOfClass:fromString:error:
  */
 - (id<MAEArraySerializing> _Nullable)modelFromString:(NSString* _Nullable)string
                                                error:(NSError* _Nullable* _Nullable)error;
 
+/**
+ * @see modelOfClass:fromData:error:
+ */
+- (id<MAEArraySerializing> _Nullable)modelFromData:(NSData* _Nullable)data
+                                             error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Convert to model from UTF-8 bytes of a record.
+ *
+ * @param bytes   UTF-8 bytes. It does not need to be terminated by NUL.
+ * @param length  The number of bytes
+ * @param error   If it return nil, error information is saved here.
+ * @return If conversion is success, it returns model object. Otherwise, it returns nil.
+ * @see modelOfClass:fromData:error:
+ */
+- (id<MAEArraySerializing> _Nullable)modelFromUTF8Bytes:(const char* _Nonnull)bytes
+                                                 length:(NSUInteger)length
+                                                  error:(NSError* _Nullable* _Nullable)error;
+
 /**
  * @see modelOfClass:fromArray:error:
  */
 - (id<MAEArraySerializing> _Nullable)modelFromArray:(NSArray<NSString*>* _Nullable)array
                                               error:(NSError* _Nullable* _Nullable)error;
 
+/**
+ * Convert the string and overwrite properties of the model, instead of creating a model.
+ *
+ * Properties that are in formatByPropertyKey are overwritten, and properties of absent fields
+ * (MAEOptional or projected out) are reset to the values of a model created by -init.
+ * Other properties are not changed. The model is validated in the same way as modelFromString:error:.
+ *
+ * If models of the class can not be set directly (e.g. the class overrides MTLModel # initWithDictionary:error:),
+ * or the record may be converted to another class, it creates a model and copies all properties to the model.
+ *
+ * @param model   A model whose class is the same as modelClass
+ * @param string  A record
+ * @param error   If it return NO, error information is saved here.
+ * @return If conversion is success, it returns YES. Otherwise, it returns NO and the model may be partially overwritten.
+ */
+- (BOOL)populateModel:(id<MAEArraySerializing> _Nonnull)model
+           fromString:(NSString* _Nullable)string
+                error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Convert UTF-8 bytes and overwrite properties of the model, instead of creating a model.
+ *
+ * @param model   A model whose class is the same as modelClass
+ * @param bytes   UTF-8 bytes. It does not need to be terminated by NUL.
+ * @param length  The number of bytes
+ * @param error   If it return NO, error information is saved here.
+ * @return If conversion is success, it returns YES. Otherwise, it returns NO and the model may be partially overwritten.
+ * @see populateModel:fromString:error:
+ */
+- (BOOL)populateModel:(id<MAEArraySerializing> _Nonnull)model
+        fromUTF8Bytes:(const char* _Nonnull)bytes
+               length:(NSUInteger)length
+                error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Convert the string to a model without creating NSError.
+ *
+ * If the conversion fails, a compact failure is saved instead of NSError, and messages of errors are not formatted.
+ * So rejecting an invalid record costs less than modelFromString:error:.
+ * If NSError is necessary, please convert the record again by modelFromString:error:.
+ *
+ * If the record is converted to another class (e.g. classForParsingArray:),
+ * fragmentIndex of the failure is an index in the format of the class.
+ *
+ * @param string   A record
+ * @param failure  If it return nil, the failure is saved here.
+ * @return A model instance
+ */
+- (id<MAEArraySerializing> _Nullable)modelFromString:(NSString* _Nullable)string
+                                             failure:(MAEFailure* _Nullable)failure;
+
+/**
+ * Convert UTF-8 bytes to a model without creating NSError.
+ *
+ * @param bytes    UTF-8 bytes. It does not need to be terminated by NUL.
+ * @param length   The number of bytes
+ * @param failure  If it return nil, the failure is saved here. The range of it is a byte range.
+ * @return A model instance
+ * @see modelFromString:failure:
+ */
+- (id<MAEArraySerializing> _Nullable)modelFromUTF8Bytes:(const char* _Nonnull)bytes
+                                                 length:(NSUInteger)length
+                                                failure:(MAEFailure* _Nullable)failure;
+
 /**
  * @see arrayFromModel:error:
  */
@@ -167,6 +556,145 @@ typedef NS_OPTIONS(NSUInteger, MAEArrayQuotedOptions) {
 - (NSString* _Nullable)stringFromModel:(id<MAEArraySerializing> _Nullable)model
                                  error:(NSError* _Nullable* _Nullable)error;
 
+/**
+ * Convert to string from model, and append it to the data as UTF-8.
+ *
+ * It appends the same string as stringFromModel:error:, but it reads properties through their accessors
+ * (instead of MTLModel # dictionaryValue) and writes quoted and escaped fields directly into the data.
+ *
+ * @param model  a MAEArraySerializing model object
+ * @param data   A buffer. If it returns NO, the data is not changed.
+ * @param error  If it return NO, error information is saved here.
+ * @return If conversion is success, it returns YES. Otherwise, it returns NO.
+ * @see MAEArrayWriter
+ */
+- (BOOL)appendModel:(id<MAEArraySerializing> _Nullable)model
+             toData:(NSMutableData* _Nonnull)data
+              error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Replace the field of the property in the record, without converting other fields.
+ *
+ * The field is found in the same way as modelFromString:error: (the format is chosen by the number of fields),
+ * and only the value is encoded in the same way as stringFromModel:error:.
+ * Other characters of the record (including separators and blanks around the field) are copied as they are.
+ * The record is not converted to another class (e.g. classForParsingArray:), so it MUST be a record of modelClass.
+ *
+ * @param value        A new value of the property. If the fragment is optional, it MUST NOT be nil.
+ * @param propertyKey  A property key of a fragment that is not variadic
+ * @param string       A record
+ * @param error        If it return nil, error information is saved here.
+ * @return A record whose field is replaced
+ */
+- (NSString* _Nullable)stringByReplacingValue:(id _Nullable)value
+                               forPropertyKey:(NSString* _Nonnull)propertyKey
+                                     inString:(NSString* _Nonnull)string
+                                        error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Replace the field of the property in a record of UTF-8 bytes, and append the record to the data.
+ *
+ * Bytes other than the field are copied as they are.
+ *
+ * @param bytes        UTF-8 bytes of a record. It does not need to be terminated by NUL.
+ * @param length       The number of bytes
+ * @param value        A new value of the property. If the fragment is optional, it MUST NOT be nil.
+ * @param propertyKey  A property key of a fragment that is not variadic
+ * @param data         A buffer. If it returns NO, the data is not changed.
+ * @param error        If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ * @see stringByReplacingValue:forPropertyKey:inString:error:
+ */
+- (BOOL)appendRecordFromUTF8Bytes:(const char* _Nonnull)bytes
+                           length:(NSUInteger)length
+                   replacingValue:(id _Nullable)value
+                   forPropertyKey:(NSString* _Nonnull)propertyKey
+                           toData:(NSMutableData* _Nonnull)data
+                            error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * @see modelsOfClass:fromStrings:errors:
+ */
+- (NSArray* _Nonnull)modelsFromStrings:(NSArray<NSString*>* _Nonnull)strings
+                                errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors;
+
+/**
+ * @see modelsOfClass:fromString:recordSeparator:errors:
+ */
+- (NSArray* _Nonnull)modelsFromString:(NSString* _Nonnull)string
+                      recordSeparator:(unichar)recordSeparator
+                               errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors;
+
+/**
+ * Validate records in parallel, and count failures by error code.
+ *
+ * Records are converted and validated in the same way as modelsFromStrings:errors:,
+ * but models are discarded (and reused if possible) and NSError is not created.
+ *
+ * @param strings  An array of records
+ * @return A dictionary whose keys are error codes (MAEErrorCode) and values are the numbers of failed records.
+ *         If all records are valid, it is empty.
+ * @see modelFromString:failure:
+ */
+- (NSDictionary<NSNumber*, NSNumber*>* _Nonnull)validateStrings:(NSArray<NSString*>* _Nonnull)strings;
+
+/**
+ * @see columnarBatchOfClass:fromData:recordSeparator:errors:
+ */
+- (MAEColumnarBatch* _Nonnull)columnarBatchFromData:(NSData* _Nonnull)data
+                                    recordSeparator:(unichar)recordSeparator
+                                             errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors;
+
+/**
+ * Returns a columnar batch that has no rows.
+ * Rows can be appended by appendRecordFromUTF8Bytes:length:toColumnarBatch:error:.
+ *
+ * @return A columnar batch
+ */
+- (MAEColumnarBatch* _Nonnull)emptyColumnarBatch;
+
+/**
+ * Convert a record of UTF-8 bytes, and append it to the batch as a row.
+ *
+ * @param bytes   UTF-8 bytes of a record. It does not need to be terminated by NUL.
+ * @param length  The number of bytes
+ * @param batch   A columnar batch that was created by this adapter
+ * @param error   If it return NO, error information is saved here.
+ * @return If conversion is success, it returns YES.
+ *         Otherwise, it returns NO, and the row is appended as an invalid row in all columns.
+ *         If the record is rejected by filters, it returns NO without appending any row.
+ * @see columnarBatchOfClass:fromData:recordSeparator:errors:
+ */
+- (BOOL)appendRecordFromUTF8Bytes:(const char* _Nonnull)bytes
+                           length:(NSUInteger)length
+                  toColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+                            error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * @see dataFromColumnarBatch:recordSeparator:error:
+ */
+- (NSData* _Nullable)dataFromColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+                           recordSeparator:(unichar)recordSeparator
+                                     error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Convert rows in the range of the columnar batch to records, and append them to the data on the calling thread.
+ * Different ranges can be converted on different threads into different buffers.
+ *
+ * @param range            A range of rows
+ * @param batch            A columnar batch whose columns are in the format of modelClass
+ * @param recordSeparator  The character that is written after each record. It MUST be ASCII.
+ * @param data             A buffer. If it returns NO, the data is not changed.
+ * @param error            If it return NO, error information is saved here.
+ * @return If all rows are converted, it returns YES. Otherwise, it returns NO.
+ * @see dataFromColumnarBatch:recordSeparator:error:
+ */
+- (BOOL)appendRowsInRange:(NSRange)range
+          ofColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+          recordSeparator:(unichar)recordSeparator
+                   toData:(NSMutableData* _Nonnull)data
+                    error:(NSError* _Nullable* _Nullable)error;
+
 @end
 
 @interface MAEArrayAdapter (Transformers)
@@ -193,6 +721,9 @@ typedef NS_OPTIONS(NSUInteger, MAEArrayQuotedOptions) {
 /**
  * It returns transformer for converting between number and NSString.
  *
+ * It does not depend on locale. Integers are converted to integers as they are,
+ * and floating point numbers are converted to the shortest string that is parsed to the same value.
+ *
  * @return A transformer
  */
 + (NSValueTransformer<MTLTransformerErrorHandling>* _Nonnull)numberTransformer;
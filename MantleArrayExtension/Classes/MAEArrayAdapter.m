@@ -7,33 +7,340 @@
 //
 
 #import "MAEArrayAdapter.h"
+#import "MAEColumnarBatch+Private.h"
+#import "MAEMemoizingTransformer.h"
+#import "MAEMetricsRecorder.h"
+#import "MAEModelTransformer.h"
+#import "MAENumberTransformer.h"
+#import "MAEPropertyDecoder.h"
 #import "MAESeparatedString.h"
+#import "MAEStringInterner.h"
+#import "MAETokenizer.h"
 #import "NSArray+MAESeparatedString.h"
 #import "NSError+MAEErrorCode.h"
 #import <Mantle/EXTRuntimeExtensions.h>
 #import <Mantle/NSValueTransformer+MTLPredefinedTransformerAdditions.h>
 #import <objc/runtime.h>
+#import <pthread.h>
+#import <stdatomic.h>
 
 static unichar const MAEDefaultSeparator = ' ';
+/// The minimum number of records that a worker converts at once in batch conversion.
+static NSUInteger const MAEBatchMinimumChunkSize = 16;
+/// The number of chunks per processor in batch conversion. Several chunks per processor balance the load.
+static NSUInteger const MAEBatchChunksPerProcessor = 4;
+/// The maximum number of strings that an interner of an adapter holds.
+static NSUInteger const MAEInternerMaximumCount = 1024;
+/// The maximum number of UTF-16 characters that are interned without the character buffer of the string.
+static NSUInteger const MAEInternerMaximumStackLength = 64;
+
+/// An immutable snapshot of the cached adapters (Class -> MAEArrayAdapter).
+/// Readers load it without any lock. Writers copy it, add an entry, and publish the new snapshot under the lock.
+/// Old snapshots are never released, because readers may still be using them.
+/// The number of them is bounded by the number of model classes.
+static _Atomic(CFDictionaryRef) MAEAdapterCache = NULL;
+static pthread_mutex_t MAEAdapterCacheLock = PTHREAD_MUTEX_INITIALIZER;
 
 @interface MAEArrayAdapter ()
 
-@property (nonatomic, nonnull, strong) Class modelClass;
+@property (nonatomic, nonnull, strong, readwrite) Class modelClass;
 /// A cached copy of the return value of +formatByPropertyKey
 @property (nonatomic, nonnull, copy) NSArray<id<MAEFragment> >* formatByPropertyKey;
-/// A cached copy of the return value of +separator
-@property (nonatomic, assign) unichar separator;
+@property (nonatomic, assign, readwrite) unichar separator;
 /// A cached copy of the return value of +propertyKeys
 @property (nonatomic, nonnull, copy) NSSet<NSString*>* propertyKeys;
 /// A cached copy of the return value of -valueTransforersForModelClass:
 @property (nonatomic, nonnull, copy) NSDictionary* valueTransformersByPropertyKey;
-/// A cached copy of the return value of +ignoreEdgeBlank
-@property (nonatomic, assign) BOOL ignoreEdgeBlank;
-/// A cached copy of the return value of +quotedOptions
-@property (nonatomic, assign) MAEArrayQuotedOptions quotedOptions;
+/// Transformers of nested models in valueTransformersByPropertyKey. It is nil, if there are no nested models.
+@property (nonatomic, nullable, copy) NSDictionary<NSString*, MAEModelTransformer*>* modelTransformersByPropertyKey;
+@property (nonatomic, assign, readwrite) BOOL ignoreEdgeBlank;
+@property (nonatomic, assign, readwrite) MAEArrayQuotedOptions quotedOptions;
+@property (nonatomic, nonnull, strong, readwrite) MAETokenizer* tokenizer;
+/// The result of +chooseFormatByPropertyKey:withCount: for each count (index).
+/// The element is NSNull, if there is no format for the count.
+@property (nonatomic, nonnull, copy) NSArray* formatsByCount;
+/// Decoders for each fragment of formatByPropertyKey. The element is NSNull, if the fragment does not have property.
+/// It is nil, if models can not be created by decoders.
+@property (nonatomic, nullable, copy) NSArray* decoders;
+/// Decoders corresponding to formatsByCount.
+@property (nonatomic, nullable, copy) NSArray* decodersByCount;
+/// A model created by -init, that has default values of properties. It is nil, if decoders is nil.
+@property (nonatomic, nullable, strong) id defaultModel;
+/// The first characters of type encodings of primitive number properties (key -> NSNumber of char).
+/// Transformed values are checked by them, before they are set by modelWithDictionary:error:.
+@property (nonatomic, nonnull, copy) NSDictionary<NSString*, NSNumber*>* primitiveTypesByPropertyKey;
+@property (nonatomic, assign, readwrite) MAEArrayAdapterOptions options;
+@property (nonatomic, nullable, copy, readwrite) NSSet<NSString*>* projectedKeys;
+/// Indexes of fragments in formatByPropertyKey that are projected. It is nil, if all properties are converted.
+@property (nonatomic, nullable, copy) NSIndexSet* projectedIndexes;
+/// projectedIndexes corresponding to formatsByCount.
+@property (nonatomic, nullable, copy) NSArray<NSIndexSet*>* projectedIndexesByCount;
+@property (nonatomic, nullable, copy, readwrite) NSArray<MAERecordFilter*>* filters;
+@property (nonatomic, nullable, strong, readwrite) MAEModelPool* modelPool;
+/// Indexes of fields that filters test in formatByPropertyKey. NSNotFound means that the field is omitted.
+/// It is nil, if there are no filters.
+@property (nonatomic, nullable, copy) NSArray<NSNumber*>* filterFieldIndexes;
+/// filterFieldIndexes corresponding to formatsByCount. The element is NSNull, if there is no format for the count.
+@property (nonatomic, nullable, copy) NSArray* filterFieldIndexesByCount;
+/// Keys of properties whose values are interned. (Enumerate strings and raw candidates that are NSString)
+/// It is nil, if there are no such properties.
+@property (nonatomic, nullable, copy) NSSet<NSString*>* internedPropertyKeys;
+/// An interner of UTF-8 bytes. It is nil, if internedPropertyKeys is nil.
+@property (nonatomic, nullable, strong) MAEStringInterner* utf8Interner;
+/// An interner of UTF-16 characters. It is nil, if internedPropertyKeys is nil.
+@property (nonatomic, nullable, strong) MAEStringInterner* utf16Interner;
+/// A cached copy of the return value of +classesByDiscriminator. It is nil, if it is not implemented.
+@property (nonatomic, nullable, copy) NSDictionary<NSString*, Class>* classesByDiscriminator;
+/// A cached copy of the return value of +discriminatorIndex
+@property (nonatomic, assign) NSUInteger discriminatorIndex;
+/// If it is YES, appendModel:toData:error: reads properties through their accessors.
+/// It is NO, if the model class overrides MTLModel # dictionaryValue.
+@property (nonatomic, assign) BOOL encodesByAccessors;
 
 @end
 
+/**
+ * A column that the values of a fragment are encoded from, and its buffers.
+ */
+typedef struct MAEColumnEncoding {
+    __unsafe_unretained id<MAEFragment> _Nonnull fragment;
+    /// If the fragment does not have property or the batch does not have the column, it is nil.
+    __unsafe_unretained MAEColumn* _Nullable column;
+    MAEColumnType type;
+    /// If it is YES, the values are printed as unsigned integers.
+    BOOL isUnsigned;
+    /// If it is YES, the values are printed as float.
+    BOOL floatPrecision;
+    const void* _Nullable values;
+    const uint8_t* _Nullable stringBytes;
+    const NSUInteger* _Nullable valueOffsets;
+    const uint8_t* _Nullable validityBitmap;
+} MAEColumnEncoding;
+
+#pragma mark - Functions
+
+/**
+ * Reset the failure to the state that nothing has failed.
+ *
+ * @param failure  A failure
+ */
+static inline void MAEResetFailure(MAEFailure* _Nonnull failure)
+{
+    failure->code = MAEErrorUnknown;
+    failure->fragmentIndex = NSNotFound;
+    failure->range = NSMakeRange(NSNotFound, 0);
+}
+
+/**
+ * Start capturing failures of the current thread into the failure, instead of creating NSError.
+ *
+ * @param failure  A failure. It is reset.
+ * @return The failure that was captured before. It MUST be restored by MAEEndCapturingFailure.
+ */
+static inline MAEFailure* _Nullable MAEBeginCapturingFailure(MAEFailure* _Nonnull failure)
+{
+    MAEFailure* previousFailure = MAECapturedFailure;
+    MAEResetFailure(failure);
+    MAECapturedFailure = failure;
+    return previousFailure;
+}
+
+/**
+ * Stop capturing failures, and restore the failure that was captured before.
+ *
+ * @param previousFailure  The value returned by MAEBeginCapturingFailure
+ */
+static inline void MAEEndCapturingFailure(MAEFailure* _Nullable previousFailure)
+{
+    MAECapturedFailure = previousFailure;
+}
+
+/**
+ * Encode the character as UTF-8.
+ *
+ * @param character  A character. Surrogates are not supported.
+ * @param bytes      A buffer that has 3 bytes
+ * @return The number of bytes
+ */
+static NSUInteger MAEEncodeUTF8Character(unichar character, uint8_t* _Nonnull bytes)
+{
+    if (character < 0x80) {
+        bytes[0] = (uint8_t)character;
+        return 1;
+    } else if (character < 0x800) {
+        bytes[0] = (uint8_t)(0xC0 | (character >> 6));
+        bytes[1] = (uint8_t)(0x80 | (character & 0x3F));
+        return 2;
+    }
+    bytes[0] = (uint8_t)(0xE0 | (character >> 12));
+    bytes[1] = (uint8_t)(0x80 | ((character >> 6) & 0x3F));
+    bytes[2] = (uint8_t)(0x80 | (character & 0x3F));
+    return 3;
+}
+
+/**
+ * Returns the number as int64_t.
+ * Unsigned integers keep their bit patterns, and floating point numbers are truncated.
+ *
+ * @param number  A number
+ * @return A value
+ */
+static inline int64_t MAENumberInt64Value(const MAENumber* _Nonnull number)
+{
+    switch (number->type) {
+        case MAENumberTypeSigned:
+            return (int64_t)number->signedValue;
+        case MAENumberTypeUnsigned:
+            return (int64_t)number->unsignedValue;
+        case MAENumberTypeFloating:
+            return (int64_t)number->floatingValue;
+    }
+}
+
+/**
+ * Returns the number as double.
+ *
+ * @param number  A number
+ * @return A value
+ */
+static inline double MAENumberDoubleValue(const MAENumber* _Nonnull number)
+{
+    switch (number->type) {
+        case MAENumberTypeSigned:
+            return (double)number->signedValue;
+        case MAENumberTypeUnsigned:
+            return (double)number->unsignedValue;
+        case MAENumberTypeFloating:
+            return number->floatingValue;
+    }
+}
+
+/**
+ * Append the string to the data as UTF-8.
+ *
+ * @param data    A buffer
+ * @param string  A string
+ */
+static void MAEAppendUTF8String(NSMutableData* _Nonnull data, NSString* _Nonnull string)
+{
+    NSUInteger length = string.length;
+    if (length == 0) {
+        return;
+    }
+
+    // NOTE: If it returns a pointer, the string only contains ASCII characters.
+    const char* cString = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingASCII);
+    if (cString) {
+        [data appendBytes:cString length:length];
+        return;
+    }
+
+    NSUInteger offset = data.length;
+    NSUInteger maxLength = [string maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    NSUInteger usedLength = 0;
+    data.length = offset + maxLength;
+    [string getBytes:(uint8_t*)data.mutableBytes + offset
+               maxLength:maxLength
+              usedLength:&usedLength
+                encoding:NSUTF8StringEncoding
+                 options:NSStringEncodingConversionAllowLossy
+                   range:NSMakeRange(0, length)
+          remainingRange:NULL];
+    data.length = offset + usedLength;
+}
+
+/**
+ * Enclose the field in quotes if the fragment requires, and escape quotes in the field.
+ * It is the same result as MAEFragment # separatedStringFromTransformedValue:error: and
+ * MAESeparatedString # originalCharacters, but it modifies the data in place.
+ *
+ * @param data    A buffer
+ * @param offset  The beginning of the field. The field is [offset, data.length).
+ * @param type    A type of the fragment
+ */
+static void MAEEncloseField(NSMutableData* _Nonnull data, NSUInteger offset, MAEFragmentType type)
+{
+    NSUInteger end = data.length;
+    uint8_t quote;
+    switch (type) {
+        case MAEFragmentDoubleQuotedString:
+            quote = '"';
+            break;
+        case MAEFragmentSingleQuotedString:
+            quote = '\'';
+            break;
+        case MAEFragmentMaybeQuotedString:
+            if (end > offset && !memchr((const uint8_t*)data.bytes + offset, ' ', end - offset)) {
+                return;
+            }
+            quote = '"';
+            break;
+        default:
+            return;
+    }
+
+    NSUInteger count = 0;
+    const uint8_t* bytes = data.bytes;
+    for (const uint8_t* p = bytes + offset; (p = memchr(p, quote, (NSUInteger)(bytes + end - p))); p++) {
+        count++;
+    }
+
+    // NOTE: It moves the field from the end, inserting backslashes before quotes.
+    data.length = end + count + 2;
+    uint8_t* mutableBytes = data.mutableBytes;
+    NSUInteger dst = end + count + 1;
+    mutableBytes[dst] = quote;
+    for (NSUInteger src = end; src > offset;) {
+        uint8_t c = mutableBytes[--src];
+        mutableBytes[--dst] = c;
+        if (c == quote) {
+            mutableBytes[--dst] = '\\';
+        }
+    }
+    mutableBytes[offset] = quote;
+}
+
+/**
+ * Append the value of the column to the data, and enclose it in quotes if the fragment requires.
+ * Values are printed in the same way as the default number and bool transformers.
+ *
+ * @param data      A buffer
+ * @param encoding  A column
+ * @param index     An index of values
+ * @param type      A type of the fragment
+ */
+static void MAEAppendColumnValue(NSMutableData* _Nonnull data, const MAEColumnEncoding* _Nonnull encoding,
+                                 NSUInteger index, MAEFragmentType type)
+{
+    const NSUInteger offset = data.length;
+    char number[MAENumberBufferLength];
+    NSUInteger length;
+
+    switch (encoding->type) {
+        case MAEColumnTypeInt64:
+            length = MAEFormatInt64(((const int64_t*)encoding->values)[index], encoding->isUnsigned, number);
+            [data appendBytes:number length:length];
+            break;
+        case MAEColumnTypeDouble:
+            length = MAEFormatDouble(((const double*)encoding->values)[index], encoding->floatPrecision, number);
+            [data appendBytes:number length:length];
+            break;
+        case MAEColumnTypeBool:
+            if (((const BOOL*)encoding->values)[index]) {
+                [data appendBytes:"true" length:4];
+            } else {
+                [data appendBytes:"false" length:5];
+            }
+            break;
+        case MAEColumnTypeString: {
+            const NSUInteger* offsets = encoding->values;
+            [data appendBytes:encoding->stringBytes + offsets[index] length:offsets[index + 1] - offsets[index]];
+            break;
+        }
+    }
+    MAEEncloseField(data, offset, type);
+}
+
 @implementation MAEArrayAdapter
 
 #pragma mark - Lifecycle
@@ -72,8 +379,41 @@ static unichar const MAEDefaultSeparator = ' ';
             self.quotedOptions = MAEArraySingleQuotedEnable | MAEArrayDoubleQuotedEnable;
         }
 
+        if ([modelClass respondsToSelector:@selector(classesByDiscriminator)]) {
+            self.classesByDiscriminator = [modelClass classesByDiscriminator];
+            if ([modelClass respondsToSelector:@selector(discriminatorIndex)]) {
+                self.discriminatorIndex = [modelClass discriminatorIndex];
+            }
+        }
+
+        self.tokenizer = [[MAETokenizer alloc] initWithSeparator:self.separator
+                                                 ignoreEdgeBlank:self.ignoreEdgeBlank
+                                                   quotedOptions:self.quotedOptions];
         self.formatByPropertyKey = [self.class fragmentsFromFormat:[modelClass formatByPropertyKey]];
-        self.valueTransformersByPropertyKey = [self.class valueTransformersForModelClass:modelClass];
+        self.valueTransformersByPropertyKey
+            = [self memoizingTransformersFromTransformers:[self.class valueTransformersForModelClass:modelClass]];
+
+        NSMutableDictionary* modelTransformers = [NSMutableDictionary dictionary];
+        [self.valueTransformersByPropertyKey
+            enumerateKeysAndObjectsUsingBlock:^(NSString* _Nonnull key, id _Nonnull transformer, BOOL* _Nonnull stop) {
+                if ([transformer isKindOfClass:MAEModelTransformer.class]) {
+                    modelTransformers[key] = transformer;
+                }
+            }];
+        self.modelTransformersByPropertyKey = modelTransformers.count > 0 ? modelTransformers : nil;
+
+        NSMutableArray* formatsByCount = [NSMutableArray arrayWithCapacity:self.formatByPropertyKey.count + 1];
+        for (NSUInteger count = 0; count <= self.formatByPropertyKey.count; count++) {
+            [formatsByCount addObject:[self.class chooseFormatByPropertyKey:self.formatByPropertyKey withCount:count]
+                                          ?: NSNull.null];
+        }
+        self.formatsByCount = formatsByCount;
+        self.encodesByAccessors = [modelClass instanceMethodForSelector:@selector(dictionaryValue)]
+            == [MTLModel instanceMethodForSelector:@selector(dictionaryValue)];
+
+        [self compileDecoders];
+        [self setUpPrimitiveTypes];
+        [self setUpInterners];
 
         NSMutableSet<NSString*>* usingPropertyNames = [NSMutableSet set];
         for (id<MAEFragment> fragment in self.formatByPropertyKey) {
@@ -89,23 +429,120 @@ static unichar const MAEDefaultSeparator = ' ';
     return self;
 }
 
++ (instancetype _Nonnull)adapterForModelClass:(Class _Nonnull)modelClass
+{
+    NSParameterAssert(modelClass != nil);
+
+    CFDictionaryRef cache = atomic_load_explicit(&MAEAdapterCache, memory_order_acquire);
+    MAEArrayAdapter* adapter = cache ? (__bridge MAEArrayAdapter*)CFDictionaryGetValue(cache, (__bridge void*)modelClass) : nil;
+    if (adapter) {
+        return adapter;
+    }
+
+    // NOTE: It creates an adapter outside the lock, because the initializer may require adapters of nested models.
+    adapter = [[self alloc] initWithModelClass:modelClass];
+
+    pthread_mutex_lock(&MAEAdapterCacheLock);
+    cache = atomic_load_explicit(&MAEAdapterCache, memory_order_relaxed);
+    MAEArrayAdapter* cachedAdapter = cache ? (__bridge MAEArrayAdapter*)CFDictionaryGetValue(cache, (__bridge void*)modelClass) : nil;
+    if (cachedAdapter) {
+        adapter = cachedAdapter;
+    } else {
+        CFMutableDictionaryRef newCache = cache
+            ? CFDictionaryCreateMutableCopy(kCFAllocatorDefault, 0, cache)
+            : CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, &kCFTypeDictionaryValueCallBacks);
+        CFDictionarySetValue(newCache, (__bridge void*)modelClass, (__bridge void*)adapter);
+        atomic_store_explicit(&MAEAdapterCache, newCache, memory_order_release);
+    }
+    pthread_mutex_unlock(&MAEAdapterCacheLock);
+
+    return adapter;
+}
+
+- (instancetype _Nonnull)adapterWithOptions:(MAEArrayAdapterOptions)options
+{
+    if (options == self.options) {
+        return self;
+    }
+    return [self adapterWithOptions:options projectedKeys:self.projectedKeys filters:self.filters];
+}
+
+- (instancetype _Nonnull)adapterProjectingKeys:(NSSet<NSString*>* _Nullable)propertyKeys
+{
+    if (propertyKeys == self.projectedKeys || [propertyKeys isEqualToSet:self.projectedKeys]) {
+        return self;
+    }
+    return [self adapterWithOptions:self.options projectedKeys:propertyKeys filters:self.filters];
+}
+
+- (instancetype _Nonnull)adapterWithFilters:(NSArray<MAERecordFilter*>* _Nullable)filters
+{
+    if (filters.count == 0) {
+        filters = nil;
+    }
+    if (filters == self.filters || [filters isEqualToArray:self.filters]) {
+        return self;
+    }
+    return [self adapterWithOptions:self.options projectedKeys:self.projectedKeys filters:filters];
+}
+
+- (instancetype _Nonnull)adapterWithModelPool:(MAEModelPool* _Nullable)modelPool
+{
+    if (modelPool == self.modelPool) {
+        return self;
+    }
+    MAEArrayAdapter* adapter = [self adapterWithOptions:self.options projectedKeys:self.projectedKeys filters:self.filters];
+    adapter.modelPool = modelPool;
+    return adapter;
+}
+
 #pragma mark - Public Methods
 
++ (void)setMetricsObserver:(id<MAEArrayMetricsObserver> _Nullable)observer
+{
+    MAEMetricsSetObserver(observer);
+}
+
++ (id<MAEArrayMetricsObserver> _Nullable)metricsObserver
+{
+    return MAEMetricsCurrentObserver();
+}
+
+- (MAEMemoizationStatistics)memoizationStatisticsForPropertyKey:(NSString* _Nonnull)propertyKey
+{
+    NSParameterAssert(propertyKey != nil);
+
+    id transformer = self.valueTransformersByPropertyKey[propertyKey];
+    if ([transformer isKindOfClass:MAEMemoizingTransformer.class]) {
+        return ((MAEMemoizingTransformer*)transformer).statistics;
+    }
+    return (MAEMemoizationStatistics){ 0 };
+}
+
 + (id<MAEArraySerializing> _Nullable)modelOfClass:(Class _Nonnull)modelClass
                                        fromString:(NSString* _Nullable)string
                                             error:(NSError* _Nullable* _Nullable)error
 {
     NSParameterAssert(modelClass != nil);
-    MAEArrayAdapter* adapter = [[self alloc] initWithModelClass:modelClass];
+    MAEArrayAdapter* adapter = [self adapterForModelClass:modelClass];
     return [adapter modelFromString:string error:error];
 }
 
++ (id<MAEArraySerializing> _Nullable)modelOfClass:(Class _Nonnull)modelClass
+                                         fromData:(NSData* _Nullable)data
+                                            error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(modelClass != nil);
+    MAEArrayAdapter* adapter = [self adapterForModelClass:modelClass];
+    return [adapter modelFromData:data error:error];
+}
+
 + (id<MAEArraySerializing> _Nullable)modelOfClass:(Class _Nonnull)modelClass
                                         fromArray:(NSArray<NSString*>* _Nullable)array
                                             error:(NSError* _Nullable* _Nullable)error
 {
     NSParameterAssert(modelClass != nil);
-    MAEArrayAdapter* adapter = [[self alloc] initWithModelClass:modelClass];
+    MAEArrayAdapter* adapter = [self adapterForModelClass:modelClass];
     return [adapter modelFromArray:array error:error];
 }
 
@@ -117,7 +554,7 @@ static unichar const MAEDefaultSeparator = ' ';
                   @{ NSLocalizedFailureReasonErrorKey : @"The model instance is nil" });
         return nil;
     }
-    MAEArrayAdapter* adapter = [[self alloc] initWithModelClass:[model class]];
+    MAEArrayAdapter* adapter = [self adapterForModelClass:[model class]];
     return [adapter arrayFromModel:model error:error];
 }
 
@@ -129,10 +566,48 @@ static unichar const MAEDefaultSeparator = ' ';
                   @{ NSLocalizedFailureReasonErrorKey : @"The model instance is nil" });
         return nil;
     }
-    MAEArrayAdapter* adapter = [[self alloc] initWithModelClass:[model class]];
+    MAEArrayAdapter* adapter = [self adapterForModelClass:[model class]];
     return [adapter stringFromModel:model error:error];
 }
 
++ (NSArray* _Nonnull)modelsOfClass:(Class _Nonnull)modelClass
+                       fromStrings:(NSArray<NSString*>* _Nonnull)strings
+                            errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors
+{
+    NSParameterAssert(modelClass != nil);
+    MAEArrayAdapter* adapter = [self adapterForModelClass:modelClass];
+    return [adapter modelsFromStrings:strings errors:errors];
+}
+
++ (NSArray* _Nonnull)modelsOfClass:(Class _Nonnull)modelClass
+                        fromString:(NSString* _Nonnull)string
+                   recordSeparator:(unichar)recordSeparator
+                            errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors
+{
+    NSParameterAssert(modelClass != nil);
+    MAEArrayAdapter* adapter = [self adapterForModelClass:modelClass];
+    return [adapter modelsFromString:string recordSeparator:recordSeparator errors:errors];
+}
+
++ (MAEColumnarBatch* _Nonnull)columnarBatchOfClass:(Class _Nonnull)modelClass
+                                          fromData:(NSData* _Nonnull)data
+                                   recordSeparator:(unichar)recordSeparator
+                                            errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors
+{
+    NSParameterAssert(modelClass != nil);
+    MAEArrayAdapter* adapter = [self adapterForModelClass:modelClass];
+    return [adapter columnarBatchFromData:data recordSeparator:recordSeparator errors:errors];
+}
+
++ (NSData* _Nullable)dataFromColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+                           recordSeparator:(unichar)recordSeparator
+                                     error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(batch != nil);
+    MAEArrayAdapter* adapter = [self adapterForModelClass:batch.modelClass];
+    return [adapter dataFromColumnarBatch:batch recordSeparator:recordSeparator error:error];
+}
+
 #pragma mark Instance Methods
 
 - (id<MAEArraySerializing> _Nullable)modelFromString:(NSString* _Nullable)string
@@ -143,30 +618,39 @@ static unichar const MAEDefaultSeparator = ' ';
                   @{ NSLocalizedFailureReasonErrorKey : @"Input string is nil" });
         return nil;
     }
+    // NOTE: separatedStrings refer to the string lazily, so it is copied once here.
+    string = [string copy];
+    return [self modelFromRecordString:string utf8Bytes:NULL length:string.length reusingModel:nil error:error];
+}
 
-    NSArray<MAESeparatedString*>* separatedStrings = [self separateString:string];
-    if (!separatedStrings) {
-        SET_ERROR(error, MAEErrorInvalidInputData,
-                  @{ NSLocalizedFailureReasonErrorKey : @"Unclosed single or double quoted string is exist" });
+- (id<MAEArraySerializing> _Nullable)modelFromData:(NSData* _Nullable)data
+                                             error:(NSError* _Nullable* _Nullable)error
+{
+    if (!data) {
+        SET_ERROR(error, MAEErrorNilInputData,
+                  @{ NSLocalizedFailureReasonErrorKey : @"Input data is nil" });
         return nil;
     }
+    return [self modelFromUTF8Bytes:data.bytes length:data.length error:error];
+}
 
-    if ([self.modelClass respondsToSelector:@selector(classForParsingArray:)]) {
-        Class class = [self.modelClass classForParsingArray:separatedStrings];
-        if (class == nil) {
-            SET_ERROR(error, MAEErrorNoConversionTarget,
-                      @{ NSLocalizedFailureReasonErrorKey :
-                             format(@"%@ # classForParsingArray returns nil", self.modelClass) });
+- (id<MAEArraySerializing> _Nullable)modelFromUTF8Bytes:(const char* _Nonnull)bytes
+                                                 length:(NSUInteger)length
+                                                  error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(bytes != NULL || length == 0);
+
+    if (self.separator >= 0x80 || [self.modelClass respondsToSelector:@selector(classForParsingArray:)]) {
+        // NOTE: classForParsingArray: receives all separatedStrings, so the whole record is converted to a string.
+        NSString* string = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+        if (!string) {
+            SET_ERROR(error, MAEErrorInvalidInputData,
+                      @{ NSLocalizedFailureReasonErrorKey : @"Input data is not a valid UTF-8 string" });
             return nil;
         }
-
-        if (class != self.modelClass) {
-            return [self.class modelOfClass:class fromString:string error:error];
-        }
+        return [self modelFromString:string error:error];
     }
-
-    return [self modelFromSeparatedStrings:separatedStrings
-                                     error:error];
+    return [self modelFromRecordString:nil utf8Bytes:(const uint8_t*)bytes length:length reusingModel:nil error:error];
 }
 
 - (id<MAEArraySerializing> _Nullable)modelFromArray:(NSArray<NSString*>* _Nullable)array
@@ -186,26 +670,93 @@ static unichar const MAEDefaultSeparator = ' ';
             [separatedStrings addObject:[[MAESeparatedString alloc] initWithOriginalCharacters:s ignoreEdgeBlank:NO]];
         }
     }
+    if (self.filters && ![self acceptsSeparatedStrings:separatedStrings error:error]) {
+        return nil;
+    }
 
-    if ([self.modelClass respondsToSelector:@selector(classForParsingArray:)]) {
-        Class class = [self.modelClass classForParsingArray:separatedStrings];
-        if (class == nil) {
-            SET_ERROR(error, MAEErrorNoConversionTarget,
-                      @{ NSLocalizedFailureReasonErrorKey :
-                             format(@"%@ # classForParsingArray returns nil", self.modelClass) });
+    Class class = nil;
+    if (self.classesByDiscriminator && self.discriminatorIndex < separatedStrings.count) {
+        class = self.classesByDiscriminator[separatedStrings[self.discriminatorIndex].characters];
+    }
+    if (!class) {
+        BOOL usesClassForParsingArray = [self.modelClass respondsToSelector:@selector(classForParsingArray:)];
+        class = [self classForParsingSeparatedStrings:usesClassForParsingArray ? separatedStrings : nil error:error];
+        if (!class) {
             return nil;
         }
+    }
 
-        if (class != self.modelClass) {
-            return [self.class modelOfClass:class
-                                 fromString:[separatedStrings mae_componentsJoinedBySeparatedString:self.separator]
-                                      error:error];
+    if (class != self.modelClass) {
+        MAEArrayAdapter* adapter = [self.class adapterForModelClass:class];
+        if ([self splitsLikeAdapter:adapter]) {
+            return [adapter modelFromArray:separatedStrings error:error];
         }
+        return [adapter modelFromString:[separatedStrings mae_componentsJoinedBySeparatedString:self.separator]
+                                  error:error];
     }
-
     return [self modelFromSeparatedStrings:separatedStrings error:error];
 }
 
+- (BOOL)populateModel:(id<MAEArraySerializing> _Nonnull)model
+           fromString:(NSString* _Nullable)string
+                error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(model != nil);
+    NSAssert([(id)model isMemberOfClass:self.modelClass], @"The model MUST be %@, but got %@", self.modelClass, model.class);
+
+    if (!string) {
+        SET_ERROR(error, MAEErrorNilInputData,
+                  @{ NSLocalizedFailureReasonErrorKey : @"Input string is nil" });
+        return NO;
+    }
+    if (![self populatesModelDirectly]) {
+        return [self populateModel:model withModel:[self modelFromString:string error:error] error:error];
+    }
+    string = [string copy];
+    return [self modelFromRecordString:string utf8Bytes:NULL length:string.length reusingModel:model error:error] != nil;
+}
+
+- (BOOL)populateModel:(id<MAEArraySerializing> _Nonnull)model
+        fromUTF8Bytes:(const char* _Nonnull)bytes
+               length:(NSUInteger)length
+                error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(model != nil);
+    NSParameterAssert(bytes != NULL || length == 0);
+    NSAssert([(id)model isMemberOfClass:self.modelClass], @"The model MUST be %@, but got %@", self.modelClass, model.class);
+
+    if (![self populatesModelDirectly] || self.separator >= 0x80) {
+        return [self populateModel:model withModel:[self modelFromUTF8Bytes:bytes length:length error:error] error:error];
+    }
+    return [self modelFromRecordString:nil
+                             utf8Bytes:(const uint8_t*)bytes
+                                length:length
+                          reusingModel:model
+                                 error:error]
+        != nil;
+}
+
+- (id<MAEArraySerializing> _Nullable)modelFromString:(NSString* _Nullable)string
+                                             failure:(MAEFailure* _Nullable)failure
+{
+    MAEFailure localFailure;
+    MAEFailure* previousFailure = MAEBeginCapturingFailure(failure ?: &localFailure);
+    id<MAEArraySerializing> model = [self modelFromString:string error:nil];
+    MAEEndCapturingFailure(previousFailure);
+    return model;
+}
+
+- (id<MAEArraySerializing> _Nullable)modelFromUTF8Bytes:(const char* _Nonnull)bytes
+                                                 length:(NSUInteger)length
+                                                failure:(MAEFailure* _Nullable)failure
+{
+    MAEFailure localFailure;
+    MAEFailure* previousFailure = MAEBeginCapturingFailure(failure ?: &localFailure);
+    id<MAEArraySerializing> model = [self modelFromUTF8Bytes:bytes length:length error:nil];
+    MAEEndCapturingFailure(previousFailure);
+    return model;
+}
+
 - (NSString* _Nullable)stringFromModel:(id<MAEArraySerializing> _Nullable)model
                                  error:(NSError* _Nullable* _Nullable)error
 {
@@ -291,138 +842,2316 @@ static unichar const MAEDefaultSeparator = ' ';
     return result;
 }
 
-#pragma mark - Private Methods
-
-/**
- * Convert to model from separatedString
- *
- * @param separatedStrings An array of MAESeparatedString.
- * @param error            If it return nil, error information is saved here.
- * @return A model instance
- */
-- (id<MAEArraySerializing> _Nullable)modelFromSeparatedStrings:(NSArray<MAESeparatedString*>* _Nonnull)separatedStrings
-                                                         error:(NSError* _Nullable* _Nullable)error
+- (BOOL)appendModel:(id<MAEArraySerializing> _Nullable)model
+             toData:(NSMutableData* _Nonnull)data
+              error:(NSError* _Nullable* _Nullable)error
 {
-    NSParameterAssert(separatedStrings != nil);
+    NSParameterAssert(data != nil);
 
-    NSArray<MAEFragment*>* fragments = [self.class chooseFormatByPropertyKey:self.formatByPropertyKey
-                                                                   withCount:separatedStrings.count];
-    if (!fragments) {
-        SET_ERROR(error, MAEErrorNotMatchFragmentCount,
-                  @{ NSLocalizedFailureReasonErrorKey :
-                         format(@"Expected format is %@, but got fragment count is %@",
-                                self.formatByPropertyKey, @(separatedStrings.count)) });
-        return nil;
+    if (!model) {
+        SET_ERROR(error, MAEErrorNilInputData,
+                  @{ NSLocalizedFailureReasonErrorKey : @"Input model is nil" });
+        return NO;
     }
 
-    NSMutableDictionary* dictionaryValue = [NSMutableDictionary dictionaryWithCapacity:fragments.count];
-    NSEnumerator* sEnum = separatedStrings.objectEnumerator;
-
-    MAESeparatedString* s;
-    for (id<MAEFragment> fragment in fragments) {
-        id value;
-
-        if (fragment.isVariadic) {
-            NSMutableArray* arr = [NSMutableArray array];
-            while ((s = [sEnum nextObject])) {
-                if (![fragment validateWithSeparatedString:s error:error]) {
-                    return nil;
-                }
-                [arr addObject:s];
-            }
-            value = arr;
-        } else {
-            s = [sEnum nextObject];
-            NSAssert(s, @"Incorrect number of elements in separatedString");
+    if (![model isMemberOfClass:self.modelClass]) {
+        return [[self.class adapterForModelClass:[model class]] appendModel:model toData:data error:error];
+    }
 
-            if (![fragment validateWithSeparatedString:s error:error]) {
-                return nil;
-            }
-            value = s;
+    if (!self.encodesByAccessors) {
+        NSString* string = [self stringFromModel:model error:error];
+        if (!string) {
+            return NO;
         }
+        MAEAppendUTF8String(data, string);
+        return YES;
+    }
 
-        if (fragment.propertyName) {
-            NSValueTransformer* transformer = self.valueTransformersByPropertyKey[fragment.propertyName];
-            if (transformer) {
-                if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
-                    id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
-                    BOOL success = YES;
-                    value = [errorHandlingTransformer transformedValue:value success:&success error:error];
-                    if (!success) {
-                        return nil;
-                    }
-                } else {
-                    value = [transformer transformedValue:value];
-                }
-            }
+    const NSUInteger initialLength = data.length;
+    BOOL isFirstField = YES;
 
-            dictionaryValue[fragment.propertyName] = value;
+    for (id<MAEFragment> fragment in self.formatByPropertyKey) {
+        // NOTE: It is the same value as MTLModel # dictionaryValue.
+        id value = fragment.propertyName ? ([(NSObject*)model valueForKey:fragment.propertyName] ?: NSNull.null) : nil;
+        if (![self appendValue:value forFragment:fragment toData:data isFirstField:&isFirstField error:error]) {
+            data.length = initialLength;
+            return NO;
         }
     }
-    id model = [self.modelClass modelWithDictionary:dictionaryValue error:error];
-    return [model validate:error] ? model : nil;
+    return YES;
 }
 
-/**
- * Separate the string and return an array of separatedString
- *
- * @param string A string
- * @return If the string contains unclosed-quoted, it returns nil.
- *         Otherwise, it returns an array of separatedString.
- */
-- (NSArray<MAESeparatedString*>* _Nullable)separateString:(NSString* _Nonnull)string
+- (NSString* _Nullable)stringByReplacingValue:(id _Nullable)value
+                               forPropertyKey:(NSString* _Nonnull)propertyKey
+                                     inString:(NSString* _Nonnull)string
+                                        error:(NSError* _Nullable* _Nullable)error
 {
-    NSParameterAssert(string != nil);
+    NSParameterAssert(propertyKey != nil && string != nil);
 
-    unichar* chars = malloc(sizeof(unichar) * (string.length + 1));
-    [string getCharacters:chars range:NSMakeRange(0, string.length)];
-    chars[string.length] = '\0';
+    MAEFieldList list;
+    MAEFieldListInit(&list);
+    if (![self.tokenizer tokenizeString:string intoFieldList:&list]) {
+        MAEFieldListDestroy(&list);
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey : @"Unclosed single or double quoted string is exist" });
+        return nil;
+    }
+
+    NSMutableData* data = [NSMutableData data];
+    NSUInteger index = [self indexOfFieldInFieldList:&list replacingValue:value forPropertyKey:propertyKey toData:data error:error];
+    NSRange range = index != NSNotFound ? list.fields[index].range : NSMakeRange(NSNotFound, 0);
+    MAEFieldListDestroy(&list);
+    if (range.location == NSNotFound) {
+        return nil;
+    }
+
+    NSString* field = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+    return [string stringByReplacingCharactersInRange:range withString:field];
+}
+
+- (BOOL)appendRecordFromUTF8Bytes:(const char* _Nonnull)bytes
+                           length:(NSUInteger)length
+                   replacingValue:(id _Nullable)value
+                   forPropertyKey:(NSString* _Nonnull)propertyKey
+                           toData:(NSMutableData* _Nonnull)data
+                            error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert((bytes != NULL || length == 0) && propertyKey != nil && data != nil);
+
+    if (self.separator >= 0x80) {
+        NSString* string = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+        if (!string) {
+            SET_ERROR(error, MAEErrorInvalidInputData,
+                      @{ NSLocalizedFailureReasonErrorKey : @"Input data is not a valid UTF-8 string" });
+            return NO;
+        }
+        NSString* patched = [self stringByReplacingValue:value forPropertyKey:propertyKey inString:string error:error];
+        if (!patched) {
+            return NO;
+        }
+        MAEAppendUTF8String(data, patched);
+        return YES;
+    }
+
+    MAEFieldList list;
+    MAEFieldListInit(&list);
+    if (![self.tokenizer tokenizeUTF8Bytes:(const uint8_t*)bytes length:length intoFieldList:&list]) {
+        MAEFieldListDestroy(&list);
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey : @"Unclosed single or double quoted string is exist" });
+        return NO;
+    }
+
+    const NSUInteger initialLength = data.length;
+    NSUInteger index = [self indexOfFieldInFieldList:&list replacingValue:value forPropertyKey:propertyKey toData:data error:error];
+    NSRange range = index != NSNotFound ? list.fields[index].range : NSMakeRange(NSNotFound, 0);
+    MAEFieldListDestroy(&list);
+    if (range.location == NSNotFound) {
+        data.length = initialLength;
+        return NO;
+    }
+
+    // NOTE: The field is encoded at the end of the data, so only the bytes before it are inserted in front of it.
+    [data replaceBytesInRange:NSMakeRange(initialLength, 0) withBytes:bytes length:range.location];
+    [data appendBytes:bytes + NSMaxRange(range) length:length - NSMaxRange(range)];
+    return YES;
+}
+
+- (NSArray* _Nonnull)modelsFromStrings:(NSArray<NSString*>* _Nonnull)strings
+                                errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors
+{
+    NSParameterAssert(strings != nil);
+
+    // NOTE: The array is read from multiple threads, so it MUST be immutable.
+    strings = [strings copy];
+    const NSUInteger count = strings.count;
+    if (errors) {
+        *errors = nil;
+    }
+    if (count == 0) {
+        return @[];
+    }
+
+    // NOTE: Each worker writes to its own slots only, so these do not need any lock.
+    __strong id* models = (__strong id*)calloc(count, sizeof(id));
+    __strong NSError** recordErrors = (__strong NSError**)calloc(count, sizeof(NSError*));
+
+    NSUInteger chunkCount = NSProcessInfo.processInfo.activeProcessorCount * MAEBatchChunksPerProcessor;
+    const NSUInteger chunkSize = MAX(MAEBatchMinimumChunkSize, (count + chunkCount - 1) / chunkCount);
+    chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+        @autoreleasepool {
+            const NSUInteger end = MIN(count, (chunk + 1) * chunkSize);
+            for (NSUInteger i = chunk * chunkSize; i < end; i++) {
+                NSError* error = nil;
+                models[i] = [self modelFromString:strings[i] error:&error];
+                if (!models[i]) {
+                    recordErrors[i] = error;
+                }
+            }
+        }
+    });
+
+    NSMutableDictionary<NSNumber*, NSError*>* errorsByIndex = nil;
+    for (NSUInteger i = 0; i < count; i++) {
+        if (!models[i]) {
+            models[i] = NSNull.null;
+        }
+        if (recordErrors[i]) {
+            if (!errorsByIndex) {
+                errorsByIndex = [NSMutableDictionary dictionary];
+            }
+            errorsByIndex[@(i)] = recordErrors[i];
+            recordErrors[i] = nil;
+        }
+    }
+    NSArray* result = [NSArray arrayWithObjects:models count:count];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        models[i] = nil;
+    }
+    free(models);
+    free(recordErrors);
+
+    if (errors) {
+        *errors = errorsByIndex;
+    }
+    return result;
+}
+
+- (NSArray* _Nonnull)modelsFromString:(NSString* _Nonnull)string
+                      recordSeparator:(unichar)recordSeparator
+                               errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors
+{
+    NSParameterAssert(string != nil);
+
+    string = [string copy];
+    return [self modelsFromStrings:[self recordsFromString:string recordSeparator:recordSeparator] errors:errors];
+}
+
+- (NSDictionary<NSNumber*, NSNumber*>* _Nonnull)validateStrings:(NSArray<NSString*>* _Nonnull)strings
+{
+    NSParameterAssert(strings != nil);
+
+    // NOTE: The array is read from multiple threads, so it MUST be immutable.
+    strings = [strings copy];
+    const NSUInteger count = strings.count;
+    if (count == 0) {
+        return @{};
+    }
+
+    NSUInteger chunkCount = NSProcessInfo.processInfo.activeProcessorCount * MAEBatchChunksPerProcessor;
+    const NSUInteger chunkSize = MAX(MAEBatchMinimumChunkSize, (count + chunkCount - 1) / chunkCount);
+    chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    // NOTE: Each worker writes to its own slot only, so these do not need any lock.
+    __strong NSCountedSet** codesByChunk = (__strong NSCountedSet**)calloc(chunkCount, sizeof(NSCountedSet*));
+    const BOOL reusesModel = self.populatesModelDirectly;
+
+    dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+        @autoreleasepool {
+            MAEFailure failure;
+            MAEFailure* previousFailure = MAEBeginCapturingFailure(&failure);
+            // NOTE: A valid model is overwritten by following records, so models are not created for each record.
+            id reusedModel = nil;
+
+            const NSUInteger end = MIN(count, (chunk + 1) * chunkSize);
+            for (NSUInteger i = chunk * chunkSize; i < end; i++) {
+                NSString* string = [strings[i] copy];
+                MAEResetFailure(&failure);
+                id model = [self modelFromRecordString:string
+                                             utf8Bytes:NULL
+                                                length:string.length
+                                          reusingModel:reusedModel
+                                                 error:nil];
+                if (!model) {
+                    if (!codesByChunk[chunk]) {
+                        codesByChunk[chunk] = [NSCountedSet set];
+                    }
+                    [codesByChunk[chunk] addObject:@(failure.code)];
+                } else if (reusesModel) {
+                    reusedModel = model;
+                }
+            }
+            MAEEndCapturingFailure(previousFailure);
+            if (reusedModel) {
+                [self.modelPool recycleModel:reusedModel];
+            }
+        }
+    });
+
+    NSMutableDictionary<NSNumber*, NSNumber*>* countsByCode = [NSMutableDictionary dictionary];
+    for (NSUInteger chunk = 0; chunk < chunkCount; chunk++) {
+        for (NSNumber* code in codesByChunk[chunk]) {
+            countsByCode[code] = @(countsByCode[code].unsignedIntegerValue + [codesByChunk[chunk] countForObject:code]);
+        }
+        codesByChunk[chunk] = nil;
+    }
+    free(codesByChunk);
+    return countsByCode;
+}
+
+- (MAEColumnarBatch* _Nonnull)columnarBatchFromData:(NSData* _Nonnull)data
+                                    recordSeparator:(unichar)recordSeparator
+                                             errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors
+{
+    NSParameterAssert(data != nil);
+    NSParameterAssert(recordSeparator < 0x80);
+
+    // NOTE: Records refer to the bytes, so it is copied once here. (It does not copy immutable data)
+    data = [data copy];
+    const uint8_t* bytes = data.bytes;
+    const NSUInteger length = data.length;
+
+    MAETokenizer* tokenizer = [[MAETokenizer alloc] initWithSeparator:recordSeparator
+                                                      ignoreEdgeBlank:NO
+                                                        quotedOptions:self.quotedOptions];
+    MAEFieldList list;
+    MAEFieldListInit(&list);
+    BOOL closed = [tokenizer tokenizeUTF8Bytes:bytes length:length intoFieldList:&list];
+
+    MAEColumnarBatch* batch = [self emptyColumnarBatch];
+    NSMutableDictionary<NSNumber*, NSError*>* errorsByRow = nil;
+    const NSUInteger recordCount = list.count + (closed ? 0 : 1);
+
+    for (NSUInteger i = 0; i < recordCount; i++) {
+        NSRange range;
+        if (i < list.count) {
+            range = list.fields[i].range;
+        } else {
+            NSUInteger start = list.count > 0 ? NSMaxRange(list.fields[list.count - 1].range) + 1 : 0;
+            range = NSMakeRange(start, length - start);
+        }
+        if (recordSeparator == '\n' && range.length > 0 && bytes[NSMaxRange(range) - 1] == '\r') {
+            range.length--;
+        }
+        if (range.length == 0) {
+            continue;
+        }
+
+        @autoreleasepool {
+            NSError* error = nil;
+            const NSUInteger rejectedCount = batch.rejectedCount;
+            if (![self appendRecordFromUTF8Bytes:(const char*)bytes + range.location
+                                          length:range.length
+                                 toColumnarBatch:batch
+                                           error:&error]
+                && batch.rejectedCount == rejectedCount) {
+                if (!errorsByRow) {
+                    errorsByRow = [NSMutableDictionary dictionary];
+                }
+                errorsByRow[@(batch.rowCount - 1)] = error;
+            }
+        }
+    }
+    MAEFieldListDestroy(&list);
+
+    if (errors) {
+        *errors = errorsByRow;
+    }
+    return batch;
+}
+
+- (MAEColumnarBatch* _Nonnull)emptyColumnarBatch
+{
+    NSMutableArray<MAEColumn*>* columns = [NSMutableArray arrayWithCapacity:self.formatByPropertyKey.count];
+    for (id<MAEFragment> fragment in self.formatByPropertyKey) {
+        if (fragment.propertyName && (!self.projectedKeys || [self.projectedKeys containsObject:fragment.propertyName])) {
+            [columns addObject:[self columnForFragment:fragment]];
+        }
+    }
+    return [[MAEColumnarBatch alloc] initWithModelClass:self.modelClass columns:columns];
+}
+
+- (BOOL)appendRecordFromUTF8Bytes:(const char* _Nonnull)bytes
+                           length:(NSUInteger)length
+                  toColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+                            error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(bytes != NULL || length == 0);
+    NSParameterAssert(batch.modelClass == self.modelClass);
+
+    NSString* string = nil;
+    if (self.separator >= 0x80) {
+        // NOTE: The tokenizer of UTF-8 bytes supports only ASCII separators.
+        string = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+        if (!string) {
+            [batch finishInvalidRow];
+            SET_ERROR(error, MAEErrorInvalidInputData,
+                      @{ NSLocalizedFailureReasonErrorKey : @"Input data is not a valid UTF-8 string" });
+            return NO;
+        }
+    }
+
+    MAEFieldList list;
+    MAEFieldListInit(&list);
+    uint64_t start = MAEMetricsStart();
+    BOOL tokenized = string
+        ? [self.tokenizer tokenizeString:string intoFieldList:&list]
+        : [self.tokenizer tokenizeUTF8Bytes:(const uint8_t*)bytes length:length intoFieldList:&list];
+    MAEMetricsFinish(start, MAEArrayPhaseSeparate, self.modelClass, nil);
+    if (!tokenized) {
+        MAEFieldListDestroy(&list);
+        [batch finishInvalidRow];
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey : @"Unclosed single or double quoted string is exist" });
+        return NO;
+    }
+    if (self.filters
+        && ![self acceptsFieldList:&list inString:string utf8Bytes:string ? NULL : (const uint8_t*)bytes error:error]) {
+        MAEFieldListDestroy(&list);
+        [batch rejectRow];
+        return NO;
+    }
+
+    BOOL success = [self appendFieldList:&list
+                                inString:string
+                               utf8Bytes:string ? NULL : (const uint8_t*)bytes
+                         toColumnarBatch:batch
+                                   error:error];
+    MAEFieldListDestroy(&list);
+    if (success) {
+        [batch finishRow];
+    } else {
+        [batch finishInvalidRow];
+    }
+    return success;
+}
+
+- (NSData* _Nullable)dataFromColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+                           recordSeparator:(unichar)recordSeparator
+                                     error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(batch != nil);
+
+    const NSUInteger count = batch.rowCount;
+    if (count == 0) {
+        return [NSData data];
+    }
+
+    NSUInteger chunkCount = NSProcessInfo.processInfo.activeProcessorCount * MAEBatchChunksPerProcessor;
+    const NSUInteger chunkSize = MAX(MAEBatchMinimumChunkSize, (count + chunkCount - 1) / chunkCount);
+    chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    // NOTE: Each worker writes to its own slots only, so these do not need any lock.
+    __strong NSMutableData** chunks = (__strong NSMutableData**)calloc(chunkCount, sizeof(NSMutableData*));
+    __strong NSError** chunkErrors = (__strong NSError**)calloc(chunkCount, sizeof(NSError*));
+
+    dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+        @autoreleasepool {
+            const NSUInteger start = chunk * chunkSize;
+            NSMutableData* data = [NSMutableData data];
+            NSError* chunkError = nil;
+            if ([self appendRowsInRange:NSMakeRange(start, MIN(count, start + chunkSize) - start)
+                        ofColumnarBatch:batch
+                        recordSeparator:recordSeparator
+                                 toData:data
+                                  error:&chunkError]) {
+                chunks[chunk] = data;
+            } else {
+                chunkErrors[chunk] = chunkError ?: [NSError mae_errorWithMAEErrorCode:MAEErrorUnknown];
+            }
+        }
+    });
+
+    NSError* firstError = nil;
+    NSUInteger length = 0;
+    for (NSUInteger i = 0; i < chunkCount && !firstError; i++) {
+        firstError = chunkErrors[i];
+        length += chunks[i].length;
+    }
+
+    NSMutableData* result = nil;
+    if (!firstError) {
+        result = [NSMutableData dataWithCapacity:length];
+        for (NSUInteger i = 0; i < chunkCount; i++) {
+            [result appendData:chunks[i]];
+        }
+    }
+
+    for (NSUInteger i = 0; i < chunkCount; i++) {
+        chunks[i] = nil;
+        chunkErrors[i] = nil;
+    }
+    free(chunks);
+    free(chunkErrors);
+
+    if (!result && error) {
+        *error = firstError;
+    }
+    return result;
+}
+
+- (BOOL)appendRowsInRange:(NSRange)range
+          ofColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+          recordSeparator:(unichar)recordSeparator
+                   toData:(NSMutableData* _Nonnull)data
+                    error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(batch != nil && data != nil);
+    NSParameterAssert(NSMaxRange(range) <= batch.rowCount);
+    NSParameterAssert(recordSeparator < 0x80);
+
+    // NOTE: Columns and their buffers are looked up once, instead of for each row.
+    const NSUInteger fragmentCount = self.formatByPropertyKey.count;
+    MAEColumnEncoding* encodings = calloc(MAX(fragmentCount, 1), sizeof(MAEColumnEncoding));
+    for (NSUInteger i = 0; i < fragmentCount; i++) {
+        [self prepareColumnEncoding:&encodings[i] forFragment:self.formatByPropertyKey[i] ofColumnarBatch:batch];
+    }
+
+    const uint8_t terminator = (uint8_t)recordSeparator;
+    uint8_t separator[3];
+    const NSUInteger separatorLength = MAEEncodeUTF8Character(self.separator, separator);
+    const NSUInteger initialLength = data.length;
+    BOOL success = YES;
+
+    for (NSUInteger row = range.location; row < NSMaxRange(range) && success; row++) {
+        BOOL isFirstField = YES;
+        for (NSUInteger i = 0; i < fragmentCount && success; i++) {
+            const MAEColumnEncoding* encoding = &encodings[i];
+            id<MAEFragment> fragment = encoding->fragment;
+
+            if (!fragment.propertyName) {
+                success = [self appendValue:nil forFragment:fragment toData:data isFirstField:&isFirstField error:error];
+                continue;
+            }
+            if (!encoding->column || !((encoding->validityBitmap[row / 8] >> (row % 8)) & 1)) {
+                // NOTE: It is the same as nil, so the field is omitted if it is possible.
+                if (!fragment.isOptional && !fragment.isVariadic) {
+                    SET_ERROR(error, MAEErrorInvalidInputData,
+                              @{ NSLocalizedFailureReasonErrorKey :
+                                     format(@"The row %@ does not have the value of %@", @(row), fragment.propertyName) });
+                    success = NO;
+                }
+                continue;
+            }
+
+            const NSUInteger start = encoding->valueOffsets ? encoding->valueOffsets[row] : row;
+            const NSUInteger end = encoding->valueOffsets ? encoding->valueOffsets[row + 1] : row + 1;
+            for (NSUInteger index = start; index < end && success; index++) {
+                if (!isFirstField) {
+                    [data appendBytes:separator length:separatorLength];
+                }
+                isFirstField = NO;
+
+                const NSUInteger offset = data.length;
+                const BOOL isPlainFragment = [fragment isMemberOfClass:MAEFragment.class];
+                MAEAppendColumnValue(data, encoding, index,
+                                     isPlainFragment ? ((MAEFragment*)fragment).type : MAEFragmentEnumerateString);
+                if (!isPlainFragment) {
+                    // NOTE: Other fragments enclose the string by themselves.
+                    NSString* string = [[NSString alloc] initWithBytes:(const uint8_t*)data.bytes + offset
+                                                                length:data.length - offset
+                                                              encoding:NSUTF8StringEncoding];
+                    data.length = offset;
+                    MAESeparatedString* separatedString = [fragment separatedStringFromTransformedValue:string ?: @""
+                                                                                                  error:error];
+                    if (separatedString) {
+                        MAEAppendUTF8String(data, separatedString.originalCharacters);
+                    } else {
+                        success = NO;
+                    }
+                }
+            }
+        }
+        [data appendBytes:&terminator length:1];
+    }
+
+    free(encodings);
+    if (!success) {
+        data.length = initialLength;
+    }
+    return success;
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Remove all cached adapters.
+ * Adapters that have already been returned remain valid.
+ */
++ (void)removeAllCachedAdapters
+{
+    pthread_mutex_lock(&MAEAdapterCacheLock);
+    // NOTE: The old snapshot is not released, because readers may still be using it.
+    atomic_store_explicit(&MAEAdapterCache, NULL, memory_order_release);
+    pthread_mutex_unlock(&MAEAdapterCacheLock);
+}
+
+/**
+ * Tokenize the record, test filters, and convert fields to a model.
+ *
+ * @param string       A record. It is used if bytes is NULL.
+ * @param bytes        UTF-8 bytes of a record. If it is NULL, the string is converted.
+ * @param length       The length of the record
+ * @param reusedModel  A model that is overwritten. If it is nil, the class is chosen and a model is created.
+ * @param error        If it return nil, error information is saved here.
+ * @return A model instance
+ */
+- (id<MAEArraySerializing> _Nullable)modelFromRecordString:(NSString* _Nullable)string
+                                                 utf8Bytes:(const uint8_t* _Nullable)bytes
+                                                    length:(NSUInteger)length
+                                              reusingModel:(id _Nullable)reusedModel
+                                                     error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(string != nil || bytes != NULL || length == 0);
+
+    MAEFieldList list;
+    MAEFieldListInit(&list);
+    uint64_t start = MAEMetricsStart();
+    BOOL tokenized = bytes ? [self.tokenizer tokenizeUTF8Bytes:bytes length:length intoFieldList:&list]
+                           : [self.tokenizer tokenizeString:string intoFieldList:&list];
+    MAEMetricsFinish(start, MAEArrayPhaseSeparate, self.modelClass, nil);
+    if (!tokenized) {
+        MAEFieldListDestroy(&list);
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey : @"Unclosed single or double quoted string is exist" });
+        return nil;
+    }
+    if (self.filters && ![self acceptsFieldList:&list inString:string utf8Bytes:bytes error:error]) {
+        MAEFieldListDestroy(&list);
+        return nil;
+    }
+
+    id<MAEArraySerializing> model = reusedModel
+        ? [self modelFromFieldList:&list inString:string utf8Bytes:bytes reusingModel:reusedModel error:error]
+        : [self dispatchModelFromFieldList:&list inString:string utf8Bytes:bytes length:length error:error];
+    MAEFieldListDestroy(&list);
+    return model;
+}
+
+/**
+ * Returns whether populateModel: can set properties of the model directly.
+ *
+ * @return If models are set by decoders and records are always converted to modelClass, it returns YES.
+ *         Otherwise, it returns NO.
+ */
+- (BOOL)populatesModelDirectly
+{
+    return self.decoders && !self.classesByDiscriminator
+        && ![self.modelClass respondsToSelector:@selector(classForParsingArray:)];
+}
+
+/**
+ * Copy all properties of the converted model to the model.
+ * It is used if populateModel: can not set properties of the model directly.
+ *
+ * @param model           A model that is overwritten
+ * @param convertedModel  A model converted from the record. If it is nil, the conversion has failed.
+ * @param error           If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)populateModel:(id _Nonnull)model
+            withModel:(id _Nullable)convertedModel
+                error:(NSError* _Nullable* _Nullable)error
+{
+    if (!convertedModel) {
+        return NO;
+    }
+    if (![convertedModel isMemberOfClass:[model class]]) {
+        SET_ERROR(error, MAEErrorNoConversionTarget,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"The record was converted to %@, but the model is %@", [convertedModel class], [model class]) });
+        return NO;
+    }
+    for (NSString* propertyKey in self.propertyKeys) {
+        [model setValue:[convertedModel valueForKey:propertyKey] forKey:propertyKey];
+    }
+    return YES;
+}
+
+/**
+ * Choose the class by classesByDiscriminator and classForParsingArray:, and convert the fields to a model of the class.
+ *
+ * If the adapter of the class splits records by the same rules, the fields are passed to it without splitting again.
+ *
+ * @param list    A field list
+ * @param string  The string that fields were created from. If bytes is not NULL, it is ignored.
+ * @param bytes   UTF-8 bytes that fields were created from. If it is NULL, fields were created from the string.
+ *                It MUST be NULL, if the model class implements classForParsingArray:.
+ * @param length  The length of the string, or the number of bytes
+ * @param error   If it return nil, error information is saved here.
+ * @return A model instance
+ */
+- (id<MAEArraySerializing> _Nullable)dispatchModelFromFieldList:(const MAEFieldList* _Nonnull)list
+                                                       inString:(NSString* _Nullable)string
+                                                      utf8Bytes:(const uint8_t* _Nullable)bytes
+                                                         length:(NSUInteger)length
+                                                          error:(NSError* _Nullable* _Nullable)error
+{
+    Class class = nil;
+    if (self.classesByDiscriminator) {
+        class = self.classesByDiscriminator[[self discriminatorFromFieldList:list inString:string utf8Bytes:bytes]];
+    }
+
+    NSArray<MAESeparatedString*>* separatedStrings = nil;
+    if (!class) {
+        if ([self.modelClass respondsToSelector:@selector(classForParsingArray:)]) {
+            NSAssert(bytes == NULL, @"classForParsingArray: requires the string of the record");
+            separatedStrings = [self separatedStringsFromFieldList:list inString:string];
+        }
+        class = [self classForParsingSeparatedStrings:separatedStrings error:error];
+        if (!class) {
+            return nil;
+        }
+    }
+
+    if (class == self.modelClass) {
+        return separatedStrings ? [self modelFromSeparatedStrings:separatedStrings error:error]
+                                : [self modelFromFieldList:list inString:string utf8Bytes:bytes reusingModel:nil error:error];
+    }
+
+    MAEArrayAdapter* adapter = [self.class adapterForModelClass:class];
+    if ([self splitsLikeAdapter:adapter]
+        && (!bytes || ![class respondsToSelector:@selector(classForParsingArray:)])) {
+        return separatedStrings
+            ? [adapter modelFromArray:separatedStrings error:error]
+            : [adapter dispatchModelFromFieldList:list inString:string utf8Bytes:bytes length:length error:error];
+    }
+    // NOTE: The adapter splits records by different rules, so the record is split again.
+    return bytes ? [adapter modelFromUTF8Bytes:(const char*)bytes length:length error:error]
+                 : [adapter modelFromString:string error:error];
+}
+
+/**
+ * Returns the content of the field at discriminatorIndex, that is a key of classesByDiscriminator.
+ *
+ * @param list    A field list
+ * @param string  The string that fields were created from. If bytes is not NULL, it is ignored.
+ * @param bytes   UTF-8 bytes that fields were created from. If it is NULL, fields were created from the string.
+ * @return If there is no field at discriminatorIndex, it returns nil. Otherwise, it returns the content.
+ */
+- (NSString* _Nullable)discriminatorFromFieldList:(const MAEFieldList* _Nonnull)list
+                                         inString:(NSString* _Nullable)string
+                                        utf8Bytes:(const uint8_t* _Nullable)bytes
+{
+    if (self.discriminatorIndex >= list->count) {
+        return nil;
+    }
+
+    MAEField field = list->fields[self.discriminatorIndex];
+    if (!bytes) {
+        return field.needsUnescape ? [[MAESeparatedString alloc] initWithField:field inString:string].characters
+                                   : [string substringWithRange:field.contentRange];
+    }
+    if (!field.needsUnescape) {
+        return [[NSString alloc] initWithBytes:bytes + field.contentRange.location
+                                        length:field.contentRange.length
+                                      encoding:NSUTF8StringEncoding];
+    }
+    NSString* originalCharacters = [[NSString alloc] initWithBytes:bytes + field.range.location
+                                                            length:field.range.length
+                                                          encoding:NSUTF8StringEncoding];
+    return originalCharacters
+        ? [[MAESeparatedString alloc] initWithOriginalCharacters:originalCharacters ignoreEdgeBlank:self.ignoreEdgeBlank]
+              .characters
+        : nil;
+}
+
+/**
+ * Choose the class by classForParsingArray:. It is used if classesByDiscriminator does not choose any class.
+ *
+ * @param separatedStrings  All separatedStrings, if the model class implements classForParsingArray:. Otherwise, nil.
+ * @param error             If it return nil, error information is saved here.
+ * @return If there is no class to convert, it returns nil.
+ *         If the model class implements neither classesByDiscriminator nor classForParsingArray:,
+ *         it returns the model class.
+ */
+- (Class _Nullable)classForParsingSeparatedStrings:(NSArray<MAESeparatedString*>* _Nullable)separatedStrings
+                                             error:(NSError* _Nullable* _Nullable)error
+{
+    if (separatedStrings) {
+        Class class = [self.modelClass classForParsingArray:separatedStrings];
+        if (!class) {
+            SET_ERROR(error, MAEErrorNoConversionTarget,
+                      @{ NSLocalizedFailureReasonErrorKey :
+                             format(@"%@ # classForParsingArray returns nil", self.modelClass) });
+        }
+        return class;
+    }
+
+    if (self.classesByDiscriminator) {
+        SET_ERROR(error, MAEErrorNoConversionTarget,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"%@ # classesByDiscriminator does not have a class for the field at %tu",
+                                self.modelClass, self.discriminatorIndex) });
+        return nil;
+    }
+    return self.modelClass;
+}
+
+/**
+ * Returns whether the adapter splits records into the same fields as the receiver.
+ *
+ * @param adapter  An adapter
+ * @return If separator, ignoreEdgeBlank and quotedOptions are the same, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)splitsLikeAdapter:(MAEArrayAdapter* _Nonnull)adapter
+{
+    return self.separator == adapter.separator && self.ignoreEdgeBlank == adapter.ignoreEdgeBlank
+        && self.quotedOptions == adapter.quotedOptions;
+}
+
+/**
+ * It returns the precomputed result of +chooseFormatByPropertyKey:withCount: for the receiver's format.
+ *
+ * @param count The count of separated string.
+ * @return If it does not correspond to the count, it returns nil. Otherwise, it returns fragments.
+ */
+- (NSArray<id<MAEFragment> >* _Nullable)formatForCount:(NSUInteger)count
+{
+    if (count < self.formatsByCount.count) {
+        id fragments = self.formatsByCount[count];
+        return fragments == NSNull.null ? nil : fragments;
+    }
+    return self.formatByPropertyKey.lastObject.variadic ? self.formatByPropertyKey : nil;
+}
+
+/**
+ * It returns decoders corresponding to -formatForCount:.
+ *
+ * @param count The count of separated string.
+ * @return If models can not be created by decoders or there is no format for the count, it returns nil.
+ *         Otherwise, it returns decoders.
+ */
+- (NSArray* _Nullable)decodersForCount:(NSUInteger)count
+{
+    if (!self.decodersByCount) {
+        return nil;
+    }
+    if (count < self.decodersByCount.count) {
+        id decoders = self.decodersByCount[count];
+        return decoders == NSNull.null ? nil : decoders;
+    }
+    return self.formatByPropertyKey.lastObject.variadic ? self.decoders : nil;
+}
+
+/**
+ * Returns indexes of projected fragments in the format of count.
+ *
+ * @param count  The number of fields
+ * @return If all properties are converted, it returns nil. Otherwise, it returns indexes.
+ */
+- (NSIndexSet* _Nullable)projectedIndexesForCount:(NSUInteger)count
+{
+    if (!self.projectedIndexesByCount) {
+        return nil;
+    }
+    if (count < self.projectedIndexesByCount.count) {
+        return self.projectedIndexesByCount[count];
+    }
+    return self.projectedIndexes;
+}
+
+/**
+ * Set projectedKeys, and compute indexes of projected fragments for each format.
+ *
+ * @param propertyKeys  Property keys. If it is nil, all properties are converted.
+ */
+- (void)projectKeys:(NSSet<NSString*>* _Nullable)propertyKeys
+{
+    self.projectedKeys = propertyKeys;
+    if (!propertyKeys) {
+        self.projectedIndexes = nil;
+        self.projectedIndexesByCount = nil;
+        return;
+    }
+
+    NSIndexSet* (^projectedIndexesOfFragments)(NSArray<id<MAEFragment> >*) = ^(NSArray<id<MAEFragment> >* fragments) {
+        return [fragments indexesOfObjectsPassingTest:^BOOL(id<MAEFragment> _Nonnull fragment, NSUInteger idx,
+                                                            BOOL* _Nonnull stop) {
+            return fragment.propertyName && [propertyKeys containsObject:fragment.propertyName];
+        }];
+    };
+
+    NSIndexSet* projectedIndexes = projectedIndexesOfFragments(self.formatByPropertyKey);
+#if !defined(NS_BLOCK_ASSERTIONS)
+    NSSet<NSString*>* formatKeys = [NSSet setWithArray:[[self.formatByPropertyKey objectsAtIndexes:projectedIndexes]
+                                                           valueForKey:@"propertyName"]];
+    NSAssert([propertyKeys isSubsetOfSet:formatKeys], @"Projected keys %@ MUST be in the format %@", propertyKeys,
+             self.formatByPropertyKey);
+#endif
+
+    NSMutableArray<NSIndexSet*>* projectedIndexesByCount = [NSMutableArray arrayWithCapacity:self.formatsByCount.count];
+    for (id fragments in self.formatsByCount) {
+        [projectedIndexesByCount addObject:fragments == NSNull.null ? [NSIndexSet indexSet]
+                                                                    : projectedIndexesOfFragments(fragments)];
+    }
+    self.projectedIndexes = projectedIndexes;
+    self.projectedIndexesByCount = projectedIndexesByCount;
+}
+
+/**
+ * Returns an adapter that is not cached.
+ *
+ * @param options        Options of conversion
+ * @param propertyKeys   Projected keys
+ * @param filters        Filters
+ * @return An adapter
+ */
+- (instancetype _Nonnull)adapterWithOptions:(MAEArrayAdapterOptions)options
+                              projectedKeys:(NSSet<NSString*>* _Nullable)propertyKeys
+                                    filters:(NSArray<MAERecordFilter*>* _Nullable)filters
+{
+    MAEArrayAdapter* adapter = [[self.class alloc] initWithModelClass:self.modelClass];
+    adapter.options = options;
+    [adapter projectKeys:propertyKeys];
+    [adapter setUpFilters:filters];
+    adapter.modelPool = self.modelPool;
+    return adapter;
+}
+
+/**
+ * Set filters, and compute indexes of fields that filters test for each format.
+ *
+ * @param filters  Filters
+ */
+- (void)setUpFilters:(NSArray<MAERecordFilter*>* _Nullable)filters
+{
+    self.filters = filters;
+    if (!filters) {
+        self.filterFieldIndexes = nil;
+        self.filterFieldIndexesByCount = nil;
+        return;
+    }
+
+    NSArray<NSNumber*>* (^fieldIndexesOfFragments)(NSArray<id<MAEFragment> >*) = ^(NSArray<id<MAEFragment> >* fragments) {
+        NSMutableArray<NSNumber*>* fieldIndexes = [NSMutableArray arrayWithCapacity:filters.count];
+        for (MAERecordFilter* filter in filters) {
+            // NOTE: Variadic fragments are not allowed, so the index of fragment equals to the index of field.
+            NSUInteger index = [fragments indexOfObjectPassingTest:^BOOL(id<MAEFragment> _Nonnull fragment,
+                                                                         NSUInteger idx, BOOL* _Nonnull stop) {
+                return [fragment.propertyName isEqualToString:filter.propertyKey];
+            }];
+            [fieldIndexes addObject:@(index)];
+        }
+        return fieldIndexes;
+    };
+
+    NSArray<NSNumber*>* filterFieldIndexes = fieldIndexesOfFragments(self.formatByPropertyKey);
+#if !defined(NS_BLOCK_ASSERTIONS)
+    for (NSUInteger i = 0; i < filters.count; i++) {
+        NSUInteger index = filterFieldIndexes[i].unsignedIntegerValue;
+        NSAssert(index != NSNotFound, @"Not found a fragment of the filter %@", filters[i]);
+        NSAssert(!self.formatByPropertyKey[index].variadic, @"The fragment of the filter %@ MUST NOT be variadic",
+                 filters[i]);
+    }
+#endif
+
+    NSMutableArray* filterFieldIndexesByCount = [NSMutableArray arrayWithCapacity:self.formatsByCount.count];
+    for (id fragments in self.formatsByCount) {
+        [filterFieldIndexesByCount addObject:fragments == NSNull.null ? NSNull.null : fieldIndexesOfFragments(fragments)];
+    }
+    self.filterFieldIndexes = filterFieldIndexes;
+    self.filterFieldIndexesByCount = filterFieldIndexesByCount;
+}
+
+/**
+ * Returns indexes of fields that filters test in the format of count.
+ *
+ * @param count  The number of fields
+ * @return If there is no format for the count, it returns nil. Otherwise, it returns indexes for each filter.
+ */
+- (NSArray<NSNumber*>* _Nullable)filterFieldIndexesForCount:(NSUInteger)count
+{
+    if (count < self.filterFieldIndexesByCount.count) {
+        id fieldIndexes = self.filterFieldIndexesByCount[count];
+        return fieldIndexes == NSNull.null ? nil : fieldIndexes;
+    }
+    return self.formatByPropertyKey.lastObject.variadic ? self.filterFieldIndexes : nil;
+}
+
+/**
+ * Test fields with filters.
+ *
+ * If there is no format for the number of fields, the record is accepted, so that the conversion fails later.
+ *
+ * @param list    A field list
+ * @param string  The string that fields were created from. If bytes is not NULL, it is ignored.
+ * @param bytes   UTF-8 bytes that fields were created from
+ * @param error   If it return NO, error information is saved here.
+ * @return If the record passes all filters, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)acceptsFieldList:(const MAEFieldList* _Nonnull)list
+                inString:(NSString* _Nullable)string
+               utf8Bytes:(const uint8_t* _Nullable)bytes
+                   error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(list != NULL && (string != nil || bytes != NULL));
+
+    NSArray<NSNumber*>* fieldIndexes = [self filterFieldIndexesForCount:list->count];
+    if (!fieldIndexes) {
+        return YES;
+    }
+
+    NSUInteger i = 0;
+    for (MAERecordFilter* filter in self.filters) {
+        NSUInteger fieldIndex = fieldIndexes[i++].unsignedIntegerValue;
+        BOOL accepted = NO;
+        if (fieldIndex != NSNotFound) {
+            MAEField field = list->fields[fieldIndex];
+            if (bytes && !field.needsUnescape) {
+                accepted = [filter acceptsUTF8Bytes:bytes + field.contentRange.location length:field.contentRange.length];
+            } else {
+                NSString* source = bytes ? [self stringOfField:&field inUTF8Bytes:bytes error:error] : string;
+                if (!source) {
+                    return NO;
+                }
+                accepted = [filter acceptsCharacters:[[MAESeparatedString alloc] initWithField:field inString:source]
+                                                         .characters];
+            }
+        }
+        if (!accepted) {
+            SET_ERROR(error, MAEErrorRejectedByFilter,
+                      @{ NSLocalizedFailureReasonErrorKey : @"The record was rejected by filters" });
+            return NO;
+        }
+    }
+    return YES;
+}
+
+/**
+ * Test separatedStrings with filters.
+ *
+ * @param separatedStrings  An array of separatedString
+ * @param error             If it return NO, error information is saved here.
+ * @return If the record passes all filters, it returns YES. Otherwise, it returns NO.
+ * @see acceptsFieldList:inString:utf8Bytes:error:
+ */
+- (BOOL)acceptsSeparatedStrings:(NSArray<MAESeparatedString*>* _Nonnull)separatedStrings
+                          error:(NSError* _Nullable* _Nullable)error
+{
+    NSArray<NSNumber*>* fieldIndexes = [self filterFieldIndexesForCount:separatedStrings.count];
+    if (!fieldIndexes) {
+        return YES;
+    }
+
+    NSUInteger i = 0;
+    for (MAERecordFilter* filter in self.filters) {
+        NSUInteger fieldIndex = fieldIndexes[i++].unsignedIntegerValue;
+        if (fieldIndex == NSNotFound || ![filter acceptsCharacters:separatedStrings[fieldIndex].characters]) {
+            SET_ERROR(error, MAEErrorRejectedByFilter,
+                      @{ NSLocalizedFailureReasonErrorKey : @"The record was rejected by filters" });
+            return NO;
+        }
+    }
+    return YES;
+}
+
+/**
+ * Wrap transformers of properties that the model class memoizes by MAEMemoizingTransformer.
+ *
+ * @param transformers  Transformers keyed by property keys
+ * @return Transformers that some of them are wrapped
+ */
+- (NSDictionary* _Nonnull)memoizingTransformersFromTransformers:(NSDictionary* _Nonnull)transformers
+{
+    if (![self.modelClass respondsToSelector:@selector(memoizationCapacityForKey:)]) {
+        return transformers;
+    }
+
+    BOOL respondsToEviction = [self.modelClass respondsToSelector:@selector(memoizationEvictionForKey:)];
+    NSMutableDictionary* result = [transformers mutableCopy];
+    [transformers enumerateKeysAndObjectsUsingBlock:^(NSString* _Nonnull key, id _Nonnull transformer, BOOL* _Nonnull stop) {
+        NSUInteger capacity = [self.modelClass memoizationCapacityForKey:key];
+        if (capacity == 0) {
+            return;
+        }
+        // NOTE: The adapter recognizes these transformers and converts values without them.
+        //       Nested models are also mutable, so they can not be shared between models.
+        if ([transformer isKindOfClass:MAENumberTransformer.class] || [transformer isKindOfClass:MAEModelTransformer.class]
+            || transformer == [self.class boolTransformer]) {
+            return;
+        }
+        MAEMemoizationEviction eviction
+            = respondsToEviction ? [self.modelClass memoizationEvictionForKey:key] : MAEMemoizationEvictionLeastRecentlyUsed;
+        result[key] = [[MAEMemoizingTransformer alloc] initWithTransformer:transformer capacity:capacity eviction:eviction];
+    }];
+    return result;
+}
+
+/**
+ * Compile decoders of the receiver's format.
+ * If models of the class can not be created by decoders, decoders are nil.
+ */
+- (void)compileDecoders
+{
+    NSMutableArray<NSString*>* propertyKeys = [NSMutableArray arrayWithCapacity:self.formatByPropertyKey.count];
+    for (id<MAEFragment> fragment in self.formatByPropertyKey) {
+        if (fragment.propertyName) {
+            [propertyKeys addObject:fragment.propertyName];
+        }
+    }
+    if (![MAEPropertyDecoder canDecodeModelClass:self.modelClass propertyKeys:propertyKeys]) {
+        return;
+    }
+
+    NSMutableArray* decoders = [NSMutableArray arrayWithCapacity:self.formatByPropertyKey.count];
+    for (id<MAEFragment> fragment in self.formatByPropertyKey) {
+        if (!fragment.propertyName) {
+            [decoders addObject:NSNull.null];
+            continue;
+        }
+        MAEPropertyDecoder* decoder
+            = [MAEPropertyDecoder decoderWithModelClass:self.modelClass
+                                            propertyKey:fragment.propertyName
+                                            transformer:self.valueTransformersByPropertyKey[fragment.propertyName]
+                                               variadic:fragment.variadic];
+        if (!decoder) {
+            return;
+        }
+        [decoders addObject:decoder];
+    }
+
+    NSMutableArray* decodersByCount = [NSMutableArray arrayWithCapacity:self.formatsByCount.count];
+    for (id fragments in self.formatsByCount) {
+        if (fragments == NSNull.null) {
+            [decodersByCount addObject:NSNull.null];
+            continue;
+        }
+        NSMutableArray* decodersForCount = [NSMutableArray arrayWithCapacity:[fragments count]];
+        for (id<MAEFragment> fragment in fragments) {
+            [decodersForCount addObject:decoders[[self.formatByPropertyKey indexOfObjectIdenticalTo:fragment]]];
+        }
+        [decodersByCount addObject:decodersForCount];
+    }
+
+    self.decoders = decoders;
+    self.decodersByCount = decodersByCount;
+    self.defaultModel = [self.modelClass new];
+}
+
+/**
+ * Resolve types of properties of primitive numbers, whose values may be out of range.
+ */
+- (void)setUpPrimitiveTypes
+{
+    NSMutableDictionary<NSString*, NSNumber*>* primitiveTypes = [NSMutableDictionary dictionary];
+    for (id<MAEFragment> fragment in self.formatByPropertyKey) {
+        if (!fragment.propertyName) {
+            continue;
+        }
+        objc_property_t property = class_getProperty(self.modelClass, fragment.propertyName.UTF8String);
+        if (!property) {
+            continue;
+        }
+        mtl_propertyAttributes* attributes = mtl_copyPropertyAttributes(property);
+        const char* type = attributes->type;
+        if (type[0] != '\0' && type[1] == '\0' && strchr("cCsSiIlLqQf", type[0])) {
+            primitiveTypes[fragment.propertyName] = @(type[0]);
+        }
+        free(attributes);
+    }
+    self.primitiveTypesByPropertyKey = primitiveTypes;
+}
+
+/**
+ * Create interners, if there are properties whose values can be interned.
+ *
+ * Values are interned if the fragment is an enumerate string or raw candidates, and it is not variadic,
+ * and the property is NSString that uses the default transformer. (The value equals to characters of the field)
+ */
+- (void)setUpInterners
+{
+    NSMutableSet<NSString*>* propertyKeys = [NSMutableSet set];
+    for (id<MAEFragment> fragment in self.formatByPropertyKey) {
+        if (!fragment.propertyName || fragment.isVariadic) {
+            continue;
+        }
+        BOOL enumerates = [fragment isMemberOfClass:MAEFragment.class]
+            && ((MAEFragment*)fragment).type == MAEFragmentEnumerateString;
+        if (!enumerates && ![fragment isKindOfClass:MAERawFragment.class]) {
+            continue;
+        }
+        if ([self.class specifiesTransformerForKey:fragment.propertyName modelClass:self.modelClass]) {
+            continue;
+        }
+
+        objc_property_t property = class_getProperty(self.modelClass, fragment.propertyName.UTF8String);
+        if (!property) {
+            continue;
+        }
+        mtl_propertyAttributes* attributes = mtl_copyPropertyAttributes(property);
+        if (attributes->objectClass == NSString.class) {
+            [propertyKeys addObject:fragment.propertyName];
+        }
+        free(attributes);
+    }
+
+    if (propertyKeys.count > 0) {
+        self.internedPropertyKeys = propertyKeys;
+        self.utf8Interner = [[MAEStringInterner alloc] initWithUTF16:NO maxCount:MAEInternerMaximumCount];
+        self.utf16Interner = [[MAEStringInterner alloc] initWithUTF16:YES maxCount:MAEInternerMaximumCount];
+    }
+}
+
+/**
+ * Convert to model from separatedString
+ *
+ * @param separatedStrings An array of MAESeparatedString.
+ * @param error            If it return nil, error information is saved here.
+ * @return A model instance
+ */
+- (id<MAEArraySerializing> _Nullable)modelFromSeparatedStrings:(NSArray<MAESeparatedString*>* _Nonnull)separatedStrings
+                                                         error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(separatedStrings != nil);
+
+    uint64_t start = MAEMetricsStart();
+    NSArray<id<MAEFragment> >* fragments = [self formatForCount:separatedStrings.count];
+    NSArray* decoders = [self decodersForCount:separatedStrings.count];
+    NSIndexSet* projectedIndexes = [self projectedIndexesForCount:separatedStrings.count];
+    MAEMetricsFinish(start, MAEArrayPhaseChooseFormat, self.modelClass, nil);
+    if (!fragments) {
+        SET_ERROR(error, MAEErrorNotMatchFragmentCount,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"Expected format is %@, but got fragment count is %@",
+                                self.formatByPropertyKey, @(separatedStrings.count)) });
+        return nil;
+    }
+
+    id model = decoders ? [self makeModelReusingModel:nil] : nil;
+    NSMutableDictionary* dictionaryValue = decoders ? nil : [NSMutableDictionary dictionaryWithCapacity:fragments.count];
+    NSEnumerator* sEnum = separatedStrings.objectEnumerator;
+
+    MAESeparatedString* s;
+    for (NSUInteger i = 0; i < fragments.count; i++) {
+        id<MAEFragment> fragment = fragments[i];
+        id value;
+
+        if (projectedIndexes && ![projectedIndexes containsIndex:i]) {
+            if (fragment.isVariadic) {
+                while ([sEnum nextObject]) {
+                }
+            } else {
+                [sEnum nextObject];
+            }
+            continue;
+        }
+
+        if (fragment.isVariadic) {
+            NSMutableArray* arr = [NSMutableArray array];
+            while ((s = [sEnum nextObject])) {
+                if (![self validateSeparatedString:s withFragment:fragment error:error]) {
+                    [self recordFailureAtFragment:fragment inFieldList:NULL fieldIndexes:NSMakeRange(0, 0)];
+                    return nil;
+                }
+                [arr addObject:s];
+            }
+            value = arr;
+        } else {
+            s = [sEnum nextObject];
+            NSAssert(s, @"Incorrect number of elements in separatedString");
+
+            if (![self validateSeparatedString:s withFragment:fragment error:error]) {
+                [self recordFailureAtFragment:fragment inFieldList:NULL fieldIndexes:NSMakeRange(0, 0)];
+                return nil;
+            }
+            value = s;
+        }
+
+        if (fragment.propertyName && ![self setValue:value
+                                            forFragment:fragment
+                                            withDecoder:decoders[i]
+                                              intoModel:model
+                                        dictionaryValue:dictionaryValue
+                                                  error:error]) {
+            [self recordFailureAtFragment:fragment inFieldList:NULL fieldIndexes:NSMakeRange(0, 0)];
+            return nil;
+        }
+    }
+    return [self completeModel:model withDictionaryValue:dictionaryValue error:error];
+}
+
+/**
+ * Convert to model from fields.
+ * It creates separatedStrings only for fields that correspond to properties.
+ *
+ * @param list         A field list
+ * @param string       The string that fields were created from. If bytes is not NULL, it is ignored.
+ * @param bytes        UTF-8 bytes that fields were created from. If it is NULL, fields were created from the string.
+ * @param reusedModel  A model that is overwritten instead of creating a model. It is only used with decoders.
+ * @param error        If it return nil, error information is saved here.
+ * @return A model instance
+ */
+- (id<MAEArraySerializing> _Nullable)modelFromFieldList:(const MAEFieldList* _Nonnull)list
+                                               inString:(NSString* _Nullable)string
+                                              utf8Bytes:(const uint8_t* _Nullable)bytes
+                                           reusingModel:(id _Nullable)reusedModel
+                                                  error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(list != NULL && (string != nil || bytes != NULL));
+
+    uint64_t start = MAEMetricsStart();
+    NSArray<id<MAEFragment> >* fragments = [self formatForCount:list->count];
+    NSArray* decoders = [self decodersForCount:list->count];
+    NSIndexSet* projectedIndexes = [self projectedIndexesForCount:list->count];
+    MAEMetricsFinish(start, MAEArrayPhaseChooseFormat, self.modelClass, nil);
+    if (!fragments) {
+        SET_ERROR(error, MAEErrorNotMatchFragmentCount,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"Expected format is %@, but got fragment count is %@",
+                                self.formatByPropertyKey, @(list->count)) });
+        return nil;
+    }
+
+    id model = decoders ? [self makeModelReusingModel:reusedModel] : nil;
+    NSMutableDictionary* dictionaryValue = decoders ? nil : [NSMutableDictionary dictionaryWithCapacity:fragments.count];
+    NSUInteger index = 0;
+
+    for (NSUInteger i = 0; i < fragments.count; i++) {
+        id<MAEFragment> fragment = fragments[i];
+        id value;
+
+        if (projectedIndexes && ![projectedIndexes containsIndex:i]) {
+            // NOTE: Fields of the fragment are skipped without validation.
+            index = fragment.isVariadic ? list->count : index + 1;
+            continue;
+        }
+        const NSUInteger firstIndex = index;
+
+        MAEModelTransformer* modelTransformer
+            = fragment.propertyName ? self.modelTransformersByPropertyKey[fragment.propertyName] : nil;
+        if (modelTransformer) {
+            NSRange range = fragment.isVariadic ? NSMakeRange(index, list->count - index) : NSMakeRange(index, 1);
+            if ([self canDecodeNestedModelByTransformer:modelTransformer
+                                          fromFieldList:list
+                                                  range:range
+                                              utf8Bytes:bytes
+                                           withFragment:fragment]) {
+                index = NSMaxRange(range);
+                if (![self decodeNestedModelByTransformer:modelTransformer
+                                            fromFieldList:list
+                                                    range:range
+                                                 inString:string
+                                                utf8Bytes:bytes
+                                             withFragment:(MAEFragment*)fragment
+                                                  decoder:decoders[i]
+                                                intoModel:model
+                                          dictionaryValue:dictionaryValue
+                                                    error:error]) {
+                    [self recordFailureAtFragment:fragment inFieldList:list fieldIndexes:range];
+                    return nil;
+                }
+                continue;
+            }
+        }
+
+        if (fragment.isVariadic) {
+            NSMutableArray* arr = [NSMutableArray arrayWithCapacity:list->count - index];
+            for (; index < list->count; index++) {
+                MAESeparatedString* s = bytes
+                    ? [self validatedSeparatedStringFromField:list->fields[index]
+                                                  inUTF8Bytes:bytes
+                                                 withFragment:fragment
+                                                        error:error]
+                    : [self validatedSeparatedStringFromField:list->fields[index]
+                                                     inString:string
+                                                 withFragment:fragment
+                                                        error:error];
+                if (!s) {
+                    [self recordFailureAtFragment:fragment inFieldList:list fieldIndexes:NSMakeRange(index, 1)];
+                    return nil;
+                }
+                [arr addObject:s];
+            }
+            value = arr;
+        } else {
+            NSAssert(index < list->count, @"Incorrect number of elements in fields");
+            MAEField field = list->fields[index++];
+
+            // NOTE: An interned string is already validated. Otherwise, the field is converted as usual.
+            value = fragment.propertyName
+                ? [self internedStringFromField:field inString:string utf8Bytes:bytes withFragment:fragment]
+                : nil;
+            if (!value && bytes) {
+                // NOTE: Numbers and bools are parsed from bytes directly, if the field does not need any string.
+                MAEPropertyDecoder* decoder = decoders && fragment.propertyName ? decoders[i] : nil;
+                if (decoder.decodesUTF8Bytes && !field.needsUnescape && [fragment isMemberOfClass:MAEFragment.class]) {
+                    start = MAEMetricsStart();
+                    BOOL valid = [(MAEFragment*)fragment validateWithStringType:field.type error:error];
+                    MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+                    if (!valid) {
+                        [self recordFailureAtFragment:fragment inFieldList:list fieldIndexes:NSMakeRange(firstIndex, 1)];
+                        return nil;
+                    }
+
+                    start = MAEMetricsStart();
+                    BOOL decoded = [decoder decodeUTF8Bytes:bytes + field.contentRange.location
+                                                     length:field.contentRange.length
+                                                  intoModel:model];
+                    MAEMetricsFinish(start, MAEArrayPhaseTransform, self.modelClass, fragment.propertyName);
+                    if (decoded) {
+                        continue;
+                    }
+                }
+                value = [self validatedSeparatedStringFromField:field inUTF8Bytes:bytes withFragment:fragment error:error];
+            } else if (!value) {
+                value = [self validatedSeparatedStringFromField:field inString:string withFragment:fragment error:error];
+            }
+            if (!value) {
+                [self recordFailureAtFragment:fragment inFieldList:list fieldIndexes:NSMakeRange(firstIndex, 1)];
+                return nil;
+            }
+        }
+
+        if (fragment.propertyName && ![self setValue:value
+                                            forFragment:fragment
+                                            withDecoder:decoders[i]
+                                              intoModel:model
+                                        dictionaryValue:dictionaryValue
+                                                  error:error]) {
+            [self recordFailureAtFragment:fragment
+                              inFieldList:list
+                             fieldIndexes:NSMakeRange(firstIndex, index - firstIndex)];
+            return nil;
+        }
+    }
+    return [self completeModel:model withDictionaryValue:dictionaryValue error:error];
+}
+
+/**
+ * Returns whether the nested model can be converted from fields directly, instead of the transformer.
+ *
+ * It requires that the child adapter converts records without choosing another class,
+ * and that strings of fields are not necessary for validation. (e.g. escaped quotes)
+ *
+ * @param transformer  The transformer of the property
+ * @param list         A field list
+ * @param range        The range of fields that correspond to the fragment
+ * @param bytes        UTF-8 bytes that fields were created from. If it is NULL, fields were created from a string.
+ * @param fragment     A fragment that has the property
+ * @return If it can be converted directly, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)canDecodeNestedModelByTransformer:(MAEModelTransformer* _Nonnull)transformer
+                            fromFieldList:(const MAEFieldList* _Nonnull)list
+                                    range:(NSRange)range
+                                utf8Bytes:(const uint8_t* _Nullable)bytes
+                             withFragment:(id<MAEFragment> _Nonnull)fragment
+{
+    if (transformer.variadic != fragment.isVariadic || ![fragment isMemberOfClass:MAEFragment.class]) {
+        return NO;
+    }
+
+    MAEArrayAdapter* adapter = transformer.adapter;
+    if (adapter.classesByDiscriminator || [adapter.modelClass respondsToSelector:@selector(classForParsingArray:)]) {
+        return NO;
+    }
+    if (transformer.variadic) {
+        return YES;
+    }
+    return !list->fields[range.location].needsUnescape && !(bytes && adapter.separator >= 0x80);
+}
+
+/**
+ * Convert fields to the nested model by the child adapter, and set it to the model (or the dictionary).
+ *
+ * A variadic nested model is converted from the fields of the parent as they are.
+ * Otherwise, the content of the field is split by the child adapter in place, without creating a substring.
+ *
+ * @param transformer      The transformer of the property
+ * @param list             A field list
+ * @param range            The range of fields that correspond to the fragment
+ * @param string           The string that fields were created from. If bytes is not NULL, it is ignored.
+ * @param bytes            UTF-8 bytes that fields were created from. If it is NULL, fields were created from the string.
+ * @param fragment         A fragment that has the property
+ * @param decoder          A decoder. If models are not created by decoders, it is nil.
+ * @param model            A model. If models are not created by decoders, it is nil.
+ * @param dictionaryValue  A dictionary used by modelWithDictionary:error:, if models are not created by decoders.
+ * @param error            If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)decodeNestedModelByTransformer:(MAEModelTransformer* _Nonnull)transformer
+                         fromFieldList:(const MAEFieldList* _Nonnull)list
+                                 range:(NSRange)range
+                              inString:(NSString* _Nullable)string
+                             utf8Bytes:(const uint8_t* _Nullable)bytes
+                          withFragment:(MAEFragment* _Nonnull)fragment
+                               decoder:(MAEPropertyDecoder* _Nullable)decoder
+                             intoModel:(id _Nullable)model
+                       dictionaryValue:(NSMutableDictionary* _Nullable)dictionaryValue
+                                 error:(NSError* _Nullable* _Nullable)error
+{
+    uint64_t start = MAEMetricsStart();
+    for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+        if (![fragment validateWithStringType:list->fields[i].type error:error]) {
+            MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+            return NO;
+        }
+    }
+    MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+
+    start = MAEMetricsStart();
+    MAEArrayAdapter* adapter = transformer.adapter;
+    id nestedModel;
+    if (transformer.variadic) {
+        // NOTE: It is a view of the fields of the parent, so it MUST NOT be destroyed.
+        MAEFieldList fields;
+        fields.fields = list->fields + range.location;
+        fields.count = fields.capacity = range.length;
+        nestedModel = [adapter modelFromFieldList:&fields inString:string utf8Bytes:bytes reusingModel:nil error:error];
+    } else {
+        NSRange contentRange = list->fields[range.location].contentRange;
+        MAEFieldList fields;
+        MAEFieldListInit(&fields);
+        uint64_t separateStart = MAEMetricsStart();
+        BOOL tokenized = bytes
+            ? [adapter.tokenizer tokenizeUTF8Bytes:bytes + contentRange.location
+                                            length:contentRange.length
+                                     intoFieldList:&fields]
+            : [adapter.tokenizer tokenizeString:string range:contentRange intoFieldList:&fields];
+        MAEMetricsFinish(separateStart, MAEArrayPhaseSeparate, adapter.modelClass, nil);
+        if (tokenized) {
+            nestedModel = [adapter modelFromFieldList:&fields
+                                             inString:string
+                                            utf8Bytes:bytes ? bytes + contentRange.location : NULL
+                                         reusingModel:nil
+                                                error:error];
+        } else {
+            nestedModel = nil;
+            SET_ERROR(error, MAEErrorInvalidInputData,
+                      @{ NSLocalizedFailureReasonErrorKey : @"Unclosed single or double quoted string is exist" });
+        }
+        MAEFieldListDestroy(&fields);
+    }
+
+    BOOL success = nestedModel != nil;
+    if (success) {
+        if (decoder) {
+            success = [decoder setTransformedValue:nestedModel intoModel:model error:error];
+        } else {
+            dictionaryValue[fragment.propertyName] = nestedModel;
+        }
+    }
+    MAEMetricsFinish(start, MAEArrayPhaseTransform, self.modelClass, fragment.propertyName);
+    return success;
+}
+
+/**
+ * Set the value to the model by the decoder, or set the transformed value to the dictionary.
+ *
+ * @param value            A MAESeparatedString or an array of MAESeparatedString
+ * @param fragment         A fragment that has a property
+ * @param decoder          A decoder. If models are not created by decoders, it is nil.
+ * @param model            A model. If models are not created by decoders, it is nil.
+ * @param dictionaryValue  A dictionary used by modelWithDictionary:error:, if models are not created by decoders.
+ * @param error            If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)setValue:(id _Nonnull)value
+        forFragment:(id<MAEFragment> _Nonnull)fragment
+        withDecoder:(MAEPropertyDecoder* _Nullable)decoder
+          intoModel:(id _Nullable)model
+    dictionaryValue:(NSMutableDictionary* _Nullable)dictionaryValue
+              error:(NSError* _Nullable* _Nullable)error
+{
+    uint64_t start = MAEMetricsStart();
+    BOOL success = YES;
+    if (decoder) {
+        success = [decoder decodeValue:value intoModel:model error:error];
+    } else {
+        value = [self transformedValue:value forPropertyKey:fragment.propertyName success:&success error:error];
+        NSNumber* primitiveType = [value isKindOfClass:NSNumber.class] ? self.primitiveTypesByPropertyKey[fragment.propertyName] : nil;
+        if (success && primitiveType) {
+            success = MAEValidateNumberRange(value, primitiveType.charValue, fragment.propertyName, error);
+        }
+        if (success) {
+            dictionaryValue[fragment.propertyName] = value;
+        }
+    }
+    MAEMetricsFinish(start, MAEArrayPhaseTransform, self.modelClass, fragment.propertyName);
+    return success;
+}
+
+/**
+ * Record where the conversion failed, if failures are captured on the current thread.
+ *
+ * Nested adapters record their failures first, and then the parent overwrites them.
+ * So the failure points to the outermost fragment and fields.
+ *
+ * @param fragment      The fragment that failed
+ * @param list          A field list. If it is NULL, the range is not recorded.
+ * @param fieldIndexes  The range of indexes of fields that correspond to the fragment
+ */
+- (void)recordFailureAtFragment:(id<MAEFragment> _Nonnull)fragment
+                    inFieldList:(const MAEFieldList* _Nullable)list
+                   fieldIndexes:(NSRange)fieldIndexes
+{
+    MAEFailure* failure = MAECapturedFailure;
+    if (!failure) {
+        return;
+    }
+    failure->fragmentIndex = [self.formatByPropertyKey indexOfObjectIdenticalTo:fragment];
+    if (list && fieldIndexes.length > 0) {
+        NSUInteger location = list->fields[fieldIndexes.location].range.location;
+        failure->range = NSMakeRange(location, NSMaxRange(list->fields[NSMaxRange(fieldIndexes) - 1].range) - location);
+    } else {
+        failure->range = NSMakeRange(NSNotFound, 0);
+    }
+}
+
+/**
+ * Create a model from the dictionary if it is necessary, and validate the model.
+ *
+ * @param model            A model created by decoders. If it is nil, it creates a model from the dictionary.
+ * @param dictionaryValue  A dictionary of transformed values
+ * @param error            If it return nil, error information is saved here.
+ * @return A model instance
+ */
+- (id<MAEArraySerializing> _Nullable)completeModel:(id _Nullable)model
+                               withDictionaryValue:(NSDictionary* _Nullable)dictionaryValue
+                                             error:(NSError* _Nullable* _Nullable)error
+{
+    if (!model) {
+        uint64_t start = MAEMetricsStart();
+        model = [self.modelClass modelWithDictionary:dictionaryValue error:error];
+        MAEMetricsFinish(start, MAEArrayPhaseCreateModel, self.modelClass, nil);
+        if (!model) {
+            return nil;
+        }
+    }
+
+    if (self.options & MAEArrayAdapterSkipValidation) {
+        return model;
+    }
+    uint64_t start = MAEMetricsStart();
+    BOOL valid = [model validate:error];
+    MAEMetricsFinish(start, MAEArrayPhaseValidateModel, self.modelClass, nil);
+    return valid ? model : nil;
+}
+
+/**
+ * Create an empty model, whose properties are set by decoders.
+ *
+ * If a model is reused (the specified model, or a model in modelPool),
+ * properties of all decoders are reset to default values.
+ *
+ * @param model  A model that is reused. If it is nil, it takes a model from modelPool or creates a model.
+ * @return A model instance
+ */
+- (id _Nonnull)makeModelReusingModel:(id _Nullable)model
+{
+    uint64_t start = MAEMetricsStart();
+    model = model ?: [self.modelPool dequeueModelOfClass:self.modelClass];
+    if (model) {
+        for (MAEPropertyDecoder* decoder in self.decoders) {
+            if ((id)decoder != NSNull.null) {
+                [decoder resetValueInModel:model toDefaultModel:self.defaultModel];
+            }
+        }
+    } else {
+        model = [self.modelClass new];
+    }
+    MAEMetricsFinish(start, MAEArrayPhaseCreateModel, self.modelClass, nil);
+    return model;
+}
+
+/**
+ * Validate the separatedString with the fragment.
+ *
+ * @param separatedString  A separatedString
+ * @param fragment         A corresponding fragment
+ * @param error            If it return NO, error information is saved here.
+ * @return If the separatedString is valid, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)validateSeparatedString:(MAESeparatedString* _Nonnull)separatedString
+                   withFragment:(id<MAEFragment> _Nonnull)fragment
+                          error:(NSError* _Nullable* _Nullable)error
+{
+    uint64_t start = MAEMetricsStart();
+    BOOL valid = [fragment validateWithSeparatedString:separatedString error:error];
+    MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+    return valid;
+}
+
+/**
+ * Validate the field with the fragment, and returns a separatedString if the fragment corresponds to a property.
+ *
+ * @param field     A field
+ * @param string    The string that the field was created from
+ * @param fragment  A corresponding fragment
+ * @param error     If it return nil, error information is saved here.
+ * @return If the field is invalid, it returns nil.
+ *         If the fragment does not have property, it returns NSNull. Otherwise, it returns a separatedString.
+ */
+- (id _Nullable)validatedSeparatedStringFromField:(MAEField)field
+                                         inString:(NSString* _Nonnull)string
+                                     withFragment:(id<MAEFragment> _Nonnull)fragment
+                                            error:(NSError* _Nullable* _Nullable)error
+{
+    MAESeparatedString* separatedString = nil;
+    if ([fragment respondsToSelector:@selector(validateWithField:inString:error:)]) {
+        uint64_t start = MAEMetricsStart();
+        BOOL valid = [fragment validateWithField:field inString:string error:error];
+        MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+        if (!valid) {
+            return nil;
+        }
+    } else {
+        separatedString = [[MAESeparatedString alloc] initWithField:field inString:string];
+        if (![self validateSeparatedString:separatedString withFragment:fragment error:error]) {
+            return nil;
+        }
+    }
+
+    if (!fragment.propertyName) {
+        return NSNull.null;
+    }
+    return separatedString ?: [[MAESeparatedString alloc] initWithField:field inString:string];
+}
+
+/**
+ * Validate the field of UTF-8 bytes with the fragment, and returns a separatedString
+ * if the fragment corresponds to a property.
+ *
+ * It creates a string of the field only if it is necessary.
+ *
+ * @param field     A field. Ranges are byte ranges.
+ * @param bytes     UTF-8 bytes that the field was created from
+ * @param fragment  A corresponding fragment
+ * @param error     If it return nil, error information is saved here.
+ * @return If the field is invalid, it returns nil.
+ *         If the fragment does not have property, it returns NSNull. Otherwise, it returns a separatedString.
+ */
+- (id _Nullable)validatedSeparatedStringFromField:(MAEField)field
+                                      inUTF8Bytes:(const uint8_t* _Nonnull)bytes
+                                     withFragment:(id<MAEFragment> _Nonnull)fragment
+                                            error:(NSError* _Nullable* _Nullable)error
+{
+    if (!fragment.propertyName && [fragment isMemberOfClass:MAEFragment.class]) {
+        uint64_t start = MAEMetricsStart();
+        BOOL valid = [(MAEFragment*)fragment validateWithStringType:field.type error:error];
+        MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+        return valid ? NSNull.null : nil;
+    }
+    if (!fragment.propertyName && [fragment isKindOfClass:MAERawFragment.class]) {
+        uint64_t start = MAEMetricsStart();
+        BOOL valid = [(MAERawFragment*)fragment isCandidateUTF8Bytes:bytes + field.range.location length:field.range.length];
+        MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+        if (valid) {
+            return NSNull.null;
+        }
+        if (!error) {
+            SET_ERROR(error, MAEErrorInvalidInputData, nil);
+            return nil;
+        }
+        // NOTE: Invalid fields are validated with a string again, to create the same error.
+    }
+
+    NSString* string = [self stringOfField:&field inUTF8Bytes:bytes error:error];
+    if (!string) {
+        return nil;
+    }
+    return [self validatedSeparatedStringFromField:field inString:string withFragment:fragment error:error];
+}
+
+/**
+ * Create a string of the field of UTF-8 bytes, and convert ranges of the field to ranges in the string.
+ *
+ * @param field  A field. Ranges are byte ranges.
+ * @param bytes  UTF-8 bytes that the field was created from
+ * @param error  If it return nil, error information is saved here.
+ * @return If the field is not a valid UTF-8 string, it returns nil. Otherwise, it returns a string.
+ */
+- (NSString* _Nullable)stringOfField:(MAEField* _Nonnull)field
+                         inUTF8Bytes:(const uint8_t* _Nonnull)bytes
+                               error:(NSError* _Nullable* _Nullable)error
+{
+    NSString* string = [[NSString alloc] initWithBytes:bytes + field->range.location
+                                                length:field->range.length
+                                              encoding:NSUTF8StringEncoding];
+    if (!string) {
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey : @"The field is not a valid UTF-8 string" });
+        return nil;
+    }
+
+    // NOTE: Blanks and quotes around the content are ASCII, so they have the same length in UTF-16.
+    NSUInteger head = field->contentRange.location - field->range.location;
+    NSUInteger tail = NSMaxRange(field->range) - NSMaxRange(field->contentRange);
+    field->range = NSMakeRange(0, string.length);
+    field->contentRange = NSMakeRange(head, string.length - head - tail);
+    return string;
+}
+
+/**
+ * Returns an interned string of the field, if the property is interned and the field is valid.
+ *
+ * It does not create any object, if the same characters have already been interned.
+ * It does not create any error, so invalid fields MUST be converted again as usual.
+ *
+ * @param field     A field. If bytes is not NULL, ranges are byte ranges.
+ * @param string    The string that the field was created from. It is used if bytes is NULL.
+ * @param bytes     UTF-8 bytes that the field was created from. If it is NULL, the field was created from a string.
+ * @param fragment  A corresponding fragment that has a property
+ * @return If the string can be interned, it returns the string. Otherwise, it returns nil.
+ */
+- (NSString* _Nullable)internedStringFromField:(MAEField)field
+                                      inString:(NSString* _Nullable)string
+                                     utf8Bytes:(const uint8_t* _Nullable)bytes
+                                  withFragment:(id<MAEFragment> _Nonnull)fragment
+{
+    if (!self.internedPropertyKeys || field.needsUnescape || ![self.internedPropertyKeys containsObject:fragment.propertyName]) {
+        return nil;
+    }
+
+    uint64_t start = MAEMetricsStart();
+    BOOL valid;
+    if ([fragment isKindOfClass:MAERawFragment.class]) {
+        MAERawFragment* rawFragment = (MAERawFragment*)fragment;
+        valid = bytes ? [rawFragment isCandidateUTF8Bytes:bytes + field.range.location length:field.range.length]
+                      : [rawFragment isCandidateField:field inString:string];
+    } else {
+        valid = field.type == MAEStringTypeEnumerate;
+    }
+    MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+    if (!valid) {
+        return nil;
+    }
+
+    NSRange range = field.contentRange;
+    if (bytes) {
+        return [self.utf8Interner stringWithBytes:bytes + range.location length:range.length];
+    }
+
+    const unichar* characters = CFStringGetCharactersPtr((__bridge CFStringRef)string);
+    if (characters) {
+        return [self.utf16Interner stringWithBytes:characters + range.location length:range.length * sizeof(unichar)];
+    } else if (range.length <= MAEInternerMaximumStackLength) {
+        unichar buffer[MAEInternerMaximumStackLength];
+        [string getCharacters:buffer range:range];
+        return [self.utf16Interner stringWithBytes:buffer length:range.length * sizeof(unichar)];
+    }
+    return nil;
+}
+
+/**
+ * Apply the transformer of the property to the value.
+ *
+ * @param value        A MAESeparatedString or an array of MAESeparatedString
+ * @param propertyKey  A property key
+ * @param success      If the transformation is failed, NO is saved here.
+ * @param error        If the transformation is failed, error information is saved here.
+ * @return A transformed value
+ */
+- (id _Nullable)transformedValue:(id _Nullable)value
+                  forPropertyKey:(NSString* _Nonnull)propertyKey
+                         success:(BOOL* _Nonnull)success
+                           error:(NSError* _Nullable* _Nullable)error
+{
+    NSValueTransformer* transformer = self.valueTransformersByPropertyKey[propertyKey];
+    if (!transformer) {
+        return value;
+    }
+
+    if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
+        id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
+        return [errorHandlingTransformer transformedValue:value success:success error:error];
+    }
+    return [transformer transformedValue:value];
+}
+
+/**
+ * Separate the string and return an array of separatedString
+ *
+ * @param string A string
+ * @return If the string contains unclosed-quoted, it returns nil.
+ *         Otherwise, it returns an array of separatedString.
+ */
+- (NSArray<MAESeparatedString*>* _Nullable)separateString:(NSString* _Nonnull)string
+{
+    NSParameterAssert(string != nil);
+
+    string = [string copy];
+    MAEFieldList list;
+    MAEFieldListInit(&list);
+    NSArray<MAESeparatedString*>* separatedStrings = nil;
+    if ([self.tokenizer tokenizeString:string intoFieldList:&list]) {
+        separatedStrings = [self separatedStringsFromFieldList:&list inString:string];
+    }
+    MAEFieldListDestroy(&list);
+    return separatedStrings;
+}
 
-    unichar* p = chars;
-    unichar *start = nil, *end = nil;
-    BOOL doubleQuoted = NO, singleQuoted = NO;
-    NSMutableArray<MAESeparatedString*>* separatedStrings =
-        [NSMutableArray arrayWithCapacity:self.formatByPropertyKey.count];
+/**
+ * Separate the string into records.
+ *
+ * The separator enclosed in quoted-string or escaped by backslash is not treated as the end of record.
+ * Empty records are ignored. If the separator is '\n', the trailing '\r' of each record is also ignored.
+ * An unclosed-quoted record is returned as it is, so that the conversion of the record fails.
+ *
+ * @param string           A string that contains records
+ * @param recordSeparator  The character that separates records
+ * @return An array of records
+ */
+- (NSArray<NSString*>* _Nonnull)recordsFromString:(NSString* _Nonnull)string
+                                  recordSeparator:(unichar)recordSeparator
+{
+    NSParameterAssert(string != nil);
 
-    void (^append)(unichar* _Nullable, unichar* _Nullable) = ^void(unichar* _Nullable start, unichar* _Nullable end) {
-        NSString* str = (start <= end) ? [NSString stringWithCharacters:start length:end - start + 1] : @"";
-        [separatedStrings addObject:[[MAESeparatedString alloc] initWithOriginalCharacters:str
-                                                                           ignoreEdgeBlank:self.ignoreEdgeBlank]];
+    MAETokenizer* tokenizer = [[MAETokenizer alloc] initWithSeparator:recordSeparator
+                                                      ignoreEdgeBlank:NO
+                                                        quotedOptions:self.quotedOptions];
+    MAEFieldList list;
+    MAEFieldListInit(&list);
+    BOOL closed = [tokenizer tokenizeString:string intoFieldList:&list];
+
+    NSMutableArray<NSString*>* records = [NSMutableArray arrayWithCapacity:list.count + 1];
+    void (^addRecord)(NSRange) = ^(NSRange range) {
+        if (recordSeparator == '\n' && range.length > 0 && [string characterAtIndex:NSMaxRange(range) - 1] == '\r') {
+            range.length--;
+        }
+        if (range.length > 0) {
+            [records addObject:[string substringWithRange:range]];
+        }
     };
 
-    for (start = p; *p != '\0'; p++) {
-        if (*p == '\\') {
-            if (*(++p) == '\0') {
+    for (NSUInteger i = 0; i < list.count; i++) {
+        addRecord(list.fields[i].range);
+    }
+    if (!closed) {
+        NSUInteger start = list.count > 0 ? NSMaxRange(list.fields[list.count - 1].range) + 1 : 0;
+        addRecord(NSMakeRange(start, string.length - start));
+    }
+    MAEFieldListDestroy(&list);
+    return records;
+}
+
+/**
+ * Create separatedStrings from fields.
+ *
+ * @param list    A field list
+ * @param string  The string that fields were created from
+ * @return An array of separatedString
+ */
+- (NSArray<MAESeparatedString*>* _Nonnull)separatedStringsFromFieldList:(const MAEFieldList* _Nonnull)list
+                                                               inString:(NSString* _Nonnull)string
+{
+    NSMutableArray<MAESeparatedString*>* separatedStrings = [NSMutableArray arrayWithCapacity:list->count];
+    for (NSUInteger i = 0; i < list->count; i++) {
+        [separatedStrings addObject:[[MAESeparatedString alloc] initWithField:list->fields[i] inString:string]];
+    }
+    return separatedStrings;
+}
+
+/**
+ * Create a column for the property of the fragment.
+ *
+ * @param fragment  A fragment that has a property
+ * @return A column that does not have any row
+ */
+- (MAEColumn* _Nonnull)columnForFragment:(id<MAEFragment> _Nonnull)fragment
+{
+    NSParameterAssert(fragment.propertyName != nil);
+
+    NSValueTransformer* transformer = self.valueTransformersByPropertyKey[fragment.propertyName];
+    MAEColumnType type = MAEColumnTypeString;
+    if (!fragment.isVariadic) {
+        if (transformer == [self.class boolTransformer]) {
+            type = MAEColumnTypeBool;
+        } else if ([transformer isKindOfClass:MAENumberTransformer.class]) {
+            type = MAEColumnTypeDouble;
+            objc_property_t property = class_getProperty(self.modelClass, fragment.propertyName.UTF8String);
+            if (property) {
+                mtl_propertyAttributes* attributes = mtl_copyPropertyAttributes(property);
+                if (strlen(attributes->type) == 1 && strchr("cCsSiIlLqQ", *(attributes->type))) {
+                    type = MAEColumnTypeInt64;
+                }
+                free(attributes);
+            }
+        }
+    }
+
+    MAEColumn* column = [[MAEColumn alloc] initWithPropertyKey:fragment.propertyName
+                                                          type:type
+                                                      variadic:fragment.isVariadic];
+    if ([transformer isKindOfClass:MAENumberTransformer.class]) {
+        column.floatPrecision = ((MAENumberTransformer*)transformer).floatPrecision;
+    }
+    return column;
+}
+
+/**
+ * Look up the column of the fragment, and save it and its buffers to the encoding.
+ *
+ * @param encoding  An encoding. All fields are overwritten.
+ * @param fragment  A fragment
+ * @param batch     A columnar batch
+ */
+- (void)prepareColumnEncoding:(MAEColumnEncoding* _Nonnull)encoding
+                  forFragment:(id<MAEFragment> _Nonnull)fragment
+              ofColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+{
+    NSParameterAssert(encoding != NULL && fragment != nil && batch != nil);
+
+    memset(encoding, 0, sizeof(MAEColumnEncoding));
+    encoding->fragment = fragment;
+    if (!fragment.propertyName) {
+        return;
+    }
+
+    MAEColumn* column = [batch columnForPropertyKey:fragment.propertyName];
+    if (!column) {
+        return;
+    }
+    NSAssert(!column.variadic || fragment.isVariadic, @"%@ is not variadic, but the column is variadic", fragment.propertyName);
+
+    encoding->column = column;
+    encoding->type = column.type;
+    encoding->validityBitmap = column.validityBitmap;
+    encoding->valueOffsets = column.valueOffsets;
+    switch (column.type) {
+        case MAEColumnTypeInt64:
+            encoding->values = column.int64Values;
+            break;
+        case MAEColumnTypeDouble:
+            encoding->values = column.doubleValues;
+            break;
+        case MAEColumnTypeBool:
+            encoding->values = column.boolValues;
+            break;
+        case MAEColumnTypeString:
+            encoding->values = column.stringOffsets;
+            encoding->stringBytes = column.stringBytes;
+            break;
+    }
+
+    NSValueTransformer* transformer = self.valueTransformersByPropertyKey[fragment.propertyName];
+    if ([transformer isKindOfClass:MAENumberTransformer.class]) {
+        encoding->floatPrecision = ((MAENumberTransformer*)transformer).floatPrecision;
+    }
+    objc_property_t property = class_getProperty(self.modelClass, fragment.propertyName.UTF8String);
+    if (property) {
+        mtl_propertyAttributes* attributes = mtl_copyPropertyAttributes(property);
+        encoding->isUnsigned = strlen(attributes->type) == 1 && strchr("CSILQ", *(attributes->type));
+        free(attributes);
+    }
+}
+
+/**
+ * Validate fields, and append their values to the current row of the batch.
+ * It does not finish the row.
+ *
+ * @param list    A field list
+ * @param string  The string that fields were created from. If bytes is not NULL, it is ignored.
+ * @param bytes   UTF-8 bytes that fields were created from
+ * @param batch   A columnar batch
+ * @param error   If it return NO, error information is saved here.
+ * @return If all fields are valid, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)appendFieldList:(const MAEFieldList* _Nonnull)list
+               inString:(NSString* _Nullable)string
+              utf8Bytes:(const uint8_t* _Nullable)bytes
+        toColumnarBatch:(MAEColumnarBatch* _Nonnull)batch
+                  error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(list != NULL && (string != nil || bytes != NULL));
+
+    uint64_t start = MAEMetricsStart();
+    NSArray<id<MAEFragment> >* fragments = [self formatForCount:list->count];
+    NSIndexSet* projectedIndexes = [self projectedIndexesForCount:list->count];
+    MAEMetricsFinish(start, MAEArrayPhaseChooseFormat, self.modelClass, nil);
+    if (!fragments) {
+        SET_ERROR(error, MAEErrorNotMatchFragmentCount,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"Expected format is %@, but got fragment count is %@",
+                                self.formatByPropertyKey, @(list->count)) });
+        return NO;
+    }
+
+    NSUInteger index = 0;
+    for (NSUInteger i = 0; i < fragments.count; i++) {
+        id<MAEFragment> fragment = fragments[i];
+        NSUInteger end = fragment.isVariadic ? list->count : index + 1;
+        NSAssert(end <= list->count, @"Incorrect number of elements in fields");
+        if (projectedIndexes && ![projectedIndexes containsIndex:i]) {
+            index = end;
+            continue;
+        }
+
+        MAEColumn* column = fragment.propertyName ? [batch columnForPropertyKey:fragment.propertyName] : nil;
+
+        [column markPresent];
+        for (; index < end; index++) {
+            if (![self appendField:list->fields[index]
+                          inString:string
+                         utf8Bytes:bytes
+                      withFragment:fragment
+                          toColumn:column
+                             error:error]) {
+                return NO;
+            }
+        }
+    }
+    return YES;
+}
+
+/**
+ * Validate the field, and append its value to the column.
+ *
+ * @param field     A field
+ * @param string    The string that the field was created from. If bytes is not NULL, it is ignored.
+ * @param bytes     UTF-8 bytes that the field was created from
+ * @param fragment  A corresponding fragment
+ * @param column    The column of the property. If the fragment does not have property, it is nil.
+ * @param error     If it return NO, error information is saved here.
+ * @return If the field is valid, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)appendField:(MAEField)field
+           inString:(NSString* _Nullable)string
+          utf8Bytes:(const uint8_t* _Nullable)bytes
+       withFragment:(id<MAEFragment> _Nonnull)fragment
+           toColumn:(MAEColumn* _Nullable)column
+              error:(NSError* _Nullable* _Nullable)error
+{
+    MAENumber number;
+
+    if (bytes && column && !field.needsUnescape && [fragment isMemberOfClass:MAEFragment.class]) {
+        // NOTE: Values are read from bytes directly, if the field does not need any string.
+        uint64_t start = MAEMetricsStart();
+        BOOL valid = [(MAEFragment*)fragment validateWithStringType:field.type error:error];
+        MAEMetricsFinish(start, MAEArrayPhaseValidateFragment, self.modelClass, nil);
+        if (!valid) {
+            return NO;
+        }
+
+        const uint8_t* content = bytes + field.contentRange.location;
+        const NSUInteger length = field.contentRange.length;
+        switch (column.type) {
+            case MAEColumnTypeInt64:
+                if (MAEParseNumberFromUTF8Bytes(content, length, column.floatPrecision, &number)) {
+                    [column appendInt64:MAENumberInt64Value(&number)];
+                    return YES;
+                }
+                break;
+            case MAEColumnTypeDouble:
+                if (MAEParseNumberFromUTF8Bytes(content, length, column.floatPrecision, &number)) {
+                    [column appendDouble:MAENumberDoubleValue(&number)];
+                    return YES;
+                }
                 break;
+            case MAEColumnTypeBool:
+                [column appendBool:MAEBoolValueFromUTF8Bytes(content, length)];
+                return YES;
+            case MAEColumnTypeString:
+                [column appendUTF8Bytes:content length:length];
+                return YES;
+        }
+    }
+
+    id value = bytes ? [self validatedSeparatedStringFromField:field inUTF8Bytes:bytes withFragment:fragment error:error]
+                     : [self validatedSeparatedStringFromField:field inString:string withFragment:fragment error:error];
+    if (!value) {
+        return NO;
+    }
+    if (!column) {
+        return YES;
+    }
+
+    MAESeparatedString* separatedString = value;
+    switch (column.type) {
+        case MAEColumnTypeString:
+            [column appendString:separatedString.characters];
+            return YES;
+        case MAEColumnTypeBool:
+            [column appendBool:MAEBoolValue(separatedString.characters)];
+            return YES;
+        case MAEColumnTypeInt64:
+        case MAEColumnTypeDouble:
+            if (!MAEParseNumber(separatedString.characters, column.floatPrecision, &number)) {
+                // NOTE: The transformer creates the same error as conversion to model.
+                BOOL success = YES;
+                [self transformedValue:separatedString forPropertyKey:column.propertyKey success:&success error:error];
+                if (success) {
+                    SET_ERROR(error, MAEErrorInvalidInputData,
+                              @{ NSLocalizedFailureReasonErrorKey :
+                                     format(@"%@ could not be converted to number", separatedString.characters) });
+                }
+                return NO;
             }
-        } else if (!singleQuoted && !doubleQuoted && *p == self.separator) {
-            if (*p == ' ' && self.ignoreEdgeBlank && *(p + 1) == ' ') {
-                // NOP
+            if (column.type == MAEColumnTypeInt64) {
+                [column appendInt64:MAENumberInt64Value(&number)];
             } else {
-                end = p - 1;
-                append(start, end);
-                start = p + 1;
-                end = nil;
+                [column appendDouble:MAENumberDoubleValue(&number)];
+            }
+            return YES;
+    }
+}
+
+/**
+ * Append fields of the property value to the data, in the same way as appendModel:toData:error:.
+ *
+ * @param value         A property value (NSNull means nil). If the fragment does not have property, it is nil.
+ * @param fragment      A corresponding fragment
+ * @param data          A buffer. If it returns NO, the data may be partially appended.
+ * @param isFirstField  If it is NO, a separator is appended before each field. It is set NO, if a field is appended.
+ * @param error         If it return NO, error information is saved here.
+ * @return If conversion is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)appendValue:(id _Nullable)value
+        forFragment:(id<MAEFragment> _Nonnull)fragment
+             toData:(NSMutableData* _Nonnull)data
+       isFirstField:(BOOL* _Nonnull)isFirstField
+              error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(fragment != nil && data != nil && isFirstField != NULL);
+
+    NSValueTransformer* transformer = nil;
+    if (fragment.propertyName) {
+        if ([value isEqual:NSNull.null] && fragment.optional) {
+            return YES;
+        }
+        transformer = self.valueTransformersByPropertyKey[fragment.propertyName];
+    }
+
+    uint8_t separator[3];
+    const NSUInteger separatorLength = MAEEncodeUTF8Character(self.separator, separator);
+
+    // NOTE: Nested models are written into the data directly, and enclosed in quotes if it is necessary.
+    if ([transformer isKindOfClass:MAEModelTransformer.class] && !((MAEModelTransformer*)transformer).variadic
+        && [fragment isMemberOfClass:MAEFragment.class] && [value isKindOfClass:MTLModel.class]
+        && [value conformsToProtocol:@protocol(MAEArraySerializing)]) {
+        if (!*isFirstField) {
+            [data appendBytes:separator length:separatorLength];
+        }
+        *isFirstField = NO;
+
+        NSUInteger offset = data.length;
+        if (![((MAEModelTransformer*)transformer).adapter appendModel:value toData:data error:error]) {
+            return NO;
+        }
+        MAEEncloseField(data, offset, ((MAEFragment*)fragment).type);
+        return YES;
+    }
+
+    // NOTE: Numbers are printed into the data without creating NSString.
+    char number[MAENumberBufferLength];
+    NSUInteger numberLength = 0;
+    if ([transformer isKindOfClass:MAENumberTransformer.class] && [value isKindOfClass:NSNumber.class]
+        && [fragment isMemberOfClass:MAEFragment.class]) {
+        numberLength = MAEFormatNumber(value, number);
+    }
+
+    if (numberLength == 0 && fragment.propertyName && [transformer.class allowsReverseTransformation]) {
+        if ([transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)]) {
+            id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
+            BOOL success = YES;
+            value = [errorHandlingTransformer reverseTransformedValue:value success:&success error:error];
+            if (!success) {
+                return NO;
             }
-        } else if (!singleQuoted && (self.quotedOptions & MAEArrayDoubleQuotedEnable) && *p == '"') {
-            doubleQuoted = !doubleQuoted;
-        } else if (!doubleQuoted && (self.quotedOptions & MAEArraySingleQuotedEnable) && *p == '\'') {
-            singleQuoted = !singleQuoted;
+        } else {
+            value = [transformer reverseTransformedValue:value];
+        }
+    }
+
+    if (numberLength > 0) {
+        value = @[ NSNull.null ];
+    } else {
+        if (!value) {
+            value = NSNull.null;
+        }
+        if ([value isEqual:NSNull.null] && fragment.isOptional) {
+            return YES;
+        }
+        if (![value isKindOfClass:NSArray.class]) {
+            value = @[ value ];
         }
     }
-    end = p - 1;
 
-    if (*start != '\0') {
-        if (!doubleQuoted && !singleQuoted) {
-            append(start, end);
+    for (id v in value) {
+        NSString* transformedString = v;
+
+        if ([transformedString isEqual:NSNull.null]) {
+            transformedString = nil;
+        } else if (![transformedString isKindOfClass:NSString.class]) {
+            SET_ERROR(error, MAEErrorInvalidInputData,
+                      @{ NSLocalizedFailureReasonErrorKey :
+                             format(@"The result of reverseTransform MUST be NSString or NSArray<NSString>, but got %@", value) });
+            return NO;
+        }
+
+        if (!*isFirstField) {
+            [data appendBytes:separator length:separatorLength];
+        }
+        *isFirstField = NO;
+
+        if ([fragment isMemberOfClass:MAEFragment.class]) {
+            NSUInteger offset = data.length;
+            if (numberLength > 0) {
+                [data appendBytes:number length:numberLength];
+            } else if (transformedString) {
+                MAEAppendUTF8String(data, transformedString);
+            }
+            MAEEncloseField(data, offset, ((MAEFragment*)fragment).type);
         } else {
-            // NOTE: unclosed-quoted
-            separatedStrings = nil;
+            MAESeparatedString* separatedString = [fragment separatedStringFromTransformedValue:transformedString
+                                                                                          error:error];
+            if (!separatedString) {
+                return NO;
+            }
+            MAEAppendUTF8String(data, separatedString.originalCharacters);
         }
     }
+    return YES;
+}
 
-    free(chars);
-    return separatedStrings;
+/**
+ * Find the field of the property in the record, and encode the value for the field.
+ *
+ * @param list         A field list of the record
+ * @param value        A new value of the property. nil means NSNull.
+ * @param propertyKey  A property key of a fragment that is not variadic
+ * @param data         A buffer. The encoded field is appended.
+ * @param error        If it return NSNotFound, error information is saved here.
+ * @return If it is success, it returns the index of the field. Otherwise, it returns NSNotFound.
+ */
+- (NSUInteger)indexOfFieldInFieldList:(const MAEFieldList* _Nonnull)list
+                       replacingValue:(id _Nullable)value
+                       forPropertyKey:(NSString* _Nonnull)propertyKey
+                               toData:(NSMutableData* _Nonnull)data
+                                error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(list != NULL && propertyKey != nil && data != nil);
+
+    NSArray<id<MAEFragment> >* fragments = [self formatForCount:list->count];
+    if (!fragments) {
+        SET_ERROR(error, MAEErrorNotMatchFragmentCount,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"Expected format is %@, but got fragment count is %@",
+                                self.formatByPropertyKey, @(list->count)) });
+        return NSNotFound;
+    }
+
+    // NOTE: Each fragment except variadic corresponds to one field, and variadic is the last.
+    id<MAEFragment> fragment = nil;
+    NSUInteger index = 0;
+    for (; index < fragments.count; index++) {
+        if ([fragments[index].propertyName isEqualToString:propertyKey]) {
+            fragment = fragments[index];
+            break;
+        }
+    }
+    NSAssert(!fragment.isVariadic, @"The field of variadic fragment can not be replaced");
+    if (!fragment || fragment.isVariadic) {
+        SET_ERROR(error, MAEErrorNoConversionTarget,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"The record does not have the field of %@", propertyKey) });
+        return NSNotFound;
+    }
+
+    BOOL isFirstField = YES;
+    if (![self appendValue:value ?: NSNull.null forFragment:fragment toData:data isFirstField:&isFirstField error:error]) {
+        return NSNotFound;
+    }
+    if (isFirstField) {
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"The field of %@ can not be removed, but the value is encoded to no field", propertyKey) });
+        return NSNotFound;
+    }
+    return index;
 }
 
 /**
@@ -476,17 +3205,18 @@ static unichar const MAEDefaultSeparator = ' ';
         }
     } else { // fragments.count > count
         BOOL hasRequirementsVariadic = NO;
-        NSMutableArray<id<MAEFragment> >* filteredFragments = [fragments mutableCopy];
-        for (id<MAEFragment> fragment in fragments.reverseObjectEnumerator) {
+        NSMutableIndexSet* indexes = [NSMutableIndexSet indexSetWithIndexesInRange:NSMakeRange(0, fragments.count)];
+        for (NSUInteger i = fragments.count; i > 0; i--) {
+            id<MAEFragment> fragment = fragments[i - 1];
             if (fragment.optional) {
-                [filteredFragments removeObject:fragment];
+                [indexes removeIndex:i - 1];
             } else if (fragment.variadic) {
                 NSAssert(hasRequirementsVariadic == NO, @"Variadic is allowed only one, but there are multiple variadic");
                 hasRequirementsVariadic = YES;
             }
 
-            if (filteredFragments.count - (int)hasRequirementsVariadic == count) {
-                return filteredFragments;
+            if (indexes.count - (int)hasRequirementsVariadic == count) {
+                return [fragments objectsAtIndexes:indexes];
             }
         }
     }
@@ -524,7 +3254,7 @@ static unichar const MAEDefaultSeparator = ' ';
         }
 
         objc_property_t property = class_getProperty(modelClass, propertyKey.UTF8String);
-        if (!propertyKey) {
+        if (!property) {
             continue;
         }
 
@@ -552,6 +3282,23 @@ static unichar const MAEDefaultSeparator = ' ';
     return result;
 }
 
+/**
+ * Returns whether modelClass specifies a transformer of the property, instead of the default transformer.
+ *
+ * @param propertyKey  A property key
+ * @param modelClass   A modelClass that conforms to MAEArraySerializing
+ * @return If modelClass specifies a transformer, it returns YES. Otherwise, it returns NO.
+ */
++ (BOOL)specifiesTransformerForKey:(NSString* _Nonnull)propertyKey modelClass:(Class _Nonnull)modelClass
+{
+    NSParameterAssert(propertyKey != nil && modelClass != nil);
+
+    SEL selector = NSSelectorFromString([propertyKey stringByAppendingString:@"ArrayTransformer"]);
+    return [modelClass respondsToSelector:selector]
+        || ([modelClass respondsToSelector:@selector(arrayTransformerForKey:)]
+            && [modelClass arrayTransformerForKey:propertyKey] != nil);
+}
+
 /**
  * It returns a transformer for converting between NSString and ObjCType.
  *
@@ -571,9 +3318,10 @@ static unichar const MAEDefaultSeparator = ' ';
         || strcmp(objCType, @encode(unsigned short)) == 0
         || strcmp(objCType, @encode(unsigned long)) == 0
         || strcmp(objCType, @encode(unsigned long long)) == 0
-        || strcmp(objCType, @encode(float)) == 0
         || strcmp(objCType, @encode(double)) == 0) {
         return [self.class numberTransformer];
+    } else if (strcmp(objCType, @encode(float)) == 0) {
+        return [MAENumberTransformer floatTransformer];
     } else if (strcmp(objCType, @encode(BOOL)) == 0
                || strcmp(objCType, @encode(bool)) == 0) {
         return [self.class boolTransformer];
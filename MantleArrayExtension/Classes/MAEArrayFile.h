@@ -0,0 +1,95 @@
+//
+//  MAEArrayFile.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import <Foundation/Foundation.h>
+
+/**
+ * A read-only file of records, that converts a record to a model on demand.
+ *
+ * The file is mapped into memory, and only an index of offsets of records is created when it is opened.
+ * So opening costs as much as indexing (or loading the index), and only pages of accessed records are read.
+ * Records are separated by the same rules as MAEArrayReader. (Empty records are not counted)
+ *
+ * The index can be saved to a sidecar file, and it is loaded instead of indexing
+ * if the file has not been changed since the index was saved.
+ *
+ * The file MUST be encoded by UTF-8, and it MUST NOT be modified while it is opened.
+ * It is thread-safe.
+ */
+@interface MAEArrayFile : NSObject
+
+/// MAEArraySerializing model class
+@property (nonatomic, nonnull, strong, readonly) Class modelClass;
+/// The character that separates records. It MUST be an ASCII character.
+@property (nonatomic, assign, readonly) unichar recordTerminator;
+/// The number of records
+@property (nonatomic, assign, readonly) NSUInteger count;
+/// If it is YES, the index was loaded from the sidecar file. Otherwise, records were indexed when it was opened.
+@property (nonatomic, assign, readonly) BOOL loadedIndex;
+
+#pragma mark - Lifecycle
+
+/**
+ * Open the file, and index records.
+ *
+ * @param modelClass        MAEArraySerializing model class
+ * @param path              A path of the file
+ * @param recordTerminator  The character that separates records. (e.g. '\n')
+ * @param error             If it return nil, error information is saved here.
+ * @return An instance
+ */
+- (instancetype _Nullable)initWithModelClass:(Class _Nonnull)modelClass
+                                        path:(NSString* _Nonnull)path
+                            recordTerminator:(unichar)recordTerminator
+                                       error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Open the file, and load the index from the sidecar file.
+ *
+ * If the sidecar file does not exist or it is outdated, records are indexed and the index is saved to it.
+ * If it can not be saved, the index is only kept in memory.
+ *
+ * @param modelClass        MAEArraySerializing model class
+ * @param path              A path of the file
+ * @param recordTerminator  The character that separates records. (e.g. '\n')
+ * @param indexPath         A path of the sidecar file. If it is nil, the index is not saved.
+ * @param cacheCapacity     The maximum number of models that are cached. If it is 0, models are not cached.
+ * @param error             If it return nil, error information is saved here.
+ * @return An instance
+ */
+- (instancetype _Nullable)initWithModelClass:(Class _Nonnull)modelClass
+                                        path:(NSString* _Nonnull)path
+                            recordTerminator:(unichar)recordTerminator
+                                   indexPath:(NSString* _Nullable)indexPath
+                               cacheCapacity:(NSUInteger)cacheCapacity
+                                       error:(NSError* _Nullable* _Nullable)error;
+
+#pragma mark - Public Methods
+
+/**
+ * Convert the record at the index to a model.
+ *
+ * If models are cached, the same instance is returned for the same index while it is in the cache.
+ * So cached models MUST NOT be modified.
+ *
+ * @param index  An index of the record. It MUST be less than count.
+ * @param error  If it return nil, error information is saved here.
+ * @return A model instance
+ */
+- (id<MAEArraySerializing> _Nullable)modelAtIndex:(NSUInteger)index error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Returns the record at the index, without conversion.
+ *
+ * @param index  An index of the record. It MUST be less than count.
+ * @return If the record is not a valid UTF-8 string, it returns nil. Otherwise, it returns the record.
+ */
+- (NSString* _Nullable)recordAtIndex:(NSUInteger)index;
+
+@end
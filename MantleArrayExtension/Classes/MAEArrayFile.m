@@ -0,0 +1,574 @@
+//
+//  MAEArrayFile.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayFile.h"
+#import "MAEModelCache.h"
+#import <fcntl.h>
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <unistd.h>
+
+/// "MAEI" in little endian
+static uint32_t const MAEIndexMagic = 0x4945414D;
+static uint32_t const MAEIndexVersion = 1;
+/// The minimum number of bytes that a worker scans at once when indexing.
+static NSUInteger const MAEIndexMinimumChunkSize = 1024 * 1024;
+/// The number of chunks per processor when indexing. Chunks are scanned in parallel.
+static NSUInteger const MAEIndexChunksPerProcessor = 4;
+
+/**
+ * The header of a sidecar file. Offsets of records (uint64_t) follow it.
+ */
+typedef struct MAEIndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    /// The size of the file when it was indexed
+    uint64_t fileSize;
+    /// The modification time of the file when it was indexed
+    int64_t modifiedSeconds;
+    int64_t modifiedNanoseconds;
+    uint32_t recordTerminator;
+    uint32_t quotedOptions;
+    /// The number of records
+    uint64_t count;
+} MAEIndexHeader;
+
+/**
+ * States of scanning. It is the same state machine as MAEArrayReader.
+ */
+typedef NS_ENUM(uint8_t, MAEScanState) {
+    MAEScanStatePlain,
+    MAEScanStatePlainEscaped,
+    MAEScanStateSingleQuoted,
+    MAEScanStateSingleQuotedEscaped,
+    MAEScanStateDoubleQuoted,
+    MAEScanStateDoubleQuotedEscaped,
+    MAEScanStateCount,
+};
+
+/**
+ * Classes of bytes that change the state.
+ */
+typedef NS_ENUM(uint8_t, MAEByteClass) {
+    MAEByteClassOther,
+    MAEByteClassBackslash,
+    MAEByteClassTerminator,
+    MAEByteClassDoubleQuote,
+    MAEByteClassSingleQuote,
+    MAEByteClassCount,
+};
+
+/**
+ * A table driven scanner of records.
+ */
+typedef struct MAEScanner {
+    uint8_t classes[256];
+    uint8_t transitions[MAEScanStateCount][MAEByteClassCount];
+} MAEScanner;
+
+/**
+ * A growable list of offsets.
+ */
+typedef struct MAEOffsetList {
+    uint64_t* _Nullable offsets;
+    NSUInteger count;
+    NSUInteger capacity;
+    /// Whether the list could not grow. Offsets are not appended after that.
+    BOOL failed;
+} MAEOffsetList;
+
+#pragma mark - Functions
+
+/**
+ * Returns the last modification time of the file.
+ *
+ * @param fileStat  A status of the file
+ * @return The modification time. (st_mtimespec on Darwin, and st_mtim on other platforms)
+ */
+static inline struct timespec MAEModificationTime(const struct stat* _Nonnull fileStat)
+{
+#ifdef __APPLE__
+    return fileStat->st_mtimespec;
+#else
+    return fileStat->st_mtim;
+#endif
+}
+
+/**
+ * Initialize the scanner.
+ *
+ * @param scanner        A scanner
+ * @param terminator     The character that separates records
+ * @param quotedOptions  Quoted options of the model class
+ */
+static void MAEScannerInit(MAEScanner* _Nonnull scanner, uint8_t terminator, MAEArrayQuotedOptions quotedOptions)
+{
+    memset(scanner->classes, MAEByteClassOther, sizeof(scanner->classes));
+    scanner->classes['\\'] = MAEByteClassBackslash;
+    scanner->classes[terminator] = MAEByteClassTerminator;
+    if (quotedOptions & MAEArrayDoubleQuotedEnable) {
+        scanner->classes['"'] = MAEByteClassDoubleQuote;
+    }
+    if (quotedOptions & MAEArraySingleQuotedEnable) {
+        scanner->classes['\''] = MAEByteClassSingleQuote;
+    }
+
+    for (uint8_t state = 0; state < MAEScanStateCount; state += 2) {
+        uint8_t* transitions = scanner->transitions[state];
+        transitions[MAEByteClassOther] = state;
+        transitions[MAEByteClassBackslash] = state + 1;
+        transitions[MAEByteClassTerminator] = state;
+        transitions[MAEByteClassDoubleQuote] = state == MAEScanStatePlain
+            ? MAEScanStateDoubleQuoted
+            : (state == MAEScanStateDoubleQuoted ? MAEScanStatePlain : state);
+        transitions[MAEByteClassSingleQuote] = state == MAEScanStatePlain
+            ? MAEScanStateSingleQuoted
+            : (state == MAEScanStateSingleQuoted ? MAEScanStatePlain : state);
+
+        // NOTE: The escaped character is ignored whatever it is.
+        memset(scanner->transitions[state + 1], state, MAEByteClassCount);
+    }
+}
+
+/**
+ * Scan the bytes from all states at once, and save the state at the end for each state at the start.
+ *
+ * @param scanner    A scanner
+ * @param bytes      Bytes
+ * @param length     The number of bytes
+ * @param endStates  MAEScanStateCount states. endStates[s] is the state at the end, if the start state is s.
+ */
+static void MAEScanTransitions(const MAEScanner* _Nonnull scanner,
+                               const uint8_t* _Nonnull bytes,
+                               NSUInteger length,
+                               uint8_t* _Nonnull endStates)
+{
+    uint8_t states[MAEScanStateCount];
+    for (uint8_t state = 0; state < MAEScanStateCount; state++) {
+        states[state] = state;
+    }
+    for (NSUInteger i = 0; i < length; i++) {
+        const uint8_t byteClass = scanner->classes[bytes[i]];
+        for (uint8_t state = 0; state < MAEScanStateCount; state++) {
+            states[state] = scanner->transitions[states[state]][byteClass];
+        }
+    }
+    memcpy(endStates, states, MAEScanStateCount);
+}
+
+/**
+ * Append the offset to the list.
+ *
+ * @param list    A list
+ * @param offset  An offset
+ * @return If the list could not grow, it returns NO. Then, the list keeps the offsets appended so far.
+ */
+static inline BOOL MAEOffsetListAppend(MAEOffsetList* _Nonnull list, uint64_t offset)
+{
+    if (list->count == list->capacity) {
+        NSUInteger capacity = MAX(16, list->capacity * 2);
+        uint64_t* offsets = realloc(list->offsets, capacity * sizeof(uint64_t));
+        if (!offsets) {
+            list->failed = YES;
+            return NO;
+        }
+        list->offsets = offsets;
+        list->capacity = capacity;
+    }
+    list->offsets[list->count++] = offset;
+    return YES;
+}
+
+/**
+ * Scan the bytes, and append offsets of terminators that are not quoted nor escaped.
+ *
+ * @param scanner      A scanner
+ * @param bytes        Bytes of the whole file
+ * @param range        The range of bytes that is scanned
+ * @param state        The state at the start of the range
+ * @param terminators  A list that offsets are appended to
+ */
+static void MAEScanTerminators(const MAEScanner* _Nonnull scanner,
+                               const uint8_t* _Nonnull bytes,
+                               NSRange range,
+                               uint8_t state,
+                               MAEOffsetList* _Nonnull terminators)
+{
+    for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+        const uint8_t byteClass = scanner->classes[bytes[i]];
+        if (state == MAEScanStatePlain && byteClass == MAEByteClassTerminator) {
+            if (!MAEOffsetListAppend(terminators, i)) {
+                return;
+            }
+        }
+        state = scanner->transitions[state][byteClass];
+    }
+}
+
+@interface MAEArrayFile ()
+@property (nonatomic, nonnull, strong, readwrite) Class modelClass;
+@property (nonatomic, assign, readwrite) unichar recordTerminator;
+@property (nonatomic, assign, readwrite) NSUInteger count;
+@property (nonatomic, assign, readwrite) BOOL loadedIndex;
+@property (nonatomic, nonnull, strong) MAEArrayAdapter* adapter;
+@property (nonatomic, nullable, strong) MAEModelCache* cache;
+@end
+
+@implementation MAEArrayFile {
+    MAEScanner _scanner;
+    /// Mapped bytes of the file. It is NULL, if the file is empty.
+    const uint8_t* _bytes;
+    NSUInteger _length;
+    struct stat _fileStat;
+    /// Offsets of records. It points to either _indexBytes or memory that the receiver allocated.
+    const uint64_t* _offsets;
+    /// Mapped bytes of the sidecar file. It is NULL, if the index was not loaded.
+    void* _indexBytes;
+    NSUInteger _indexLength;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nullable)initWithModelClass:(Class _Nonnull)modelClass
+                                        path:(NSString* _Nonnull)path
+                            recordTerminator:(unichar)recordTerminator
+                                       error:(NSError* _Nullable* _Nullable)error
+{
+    return [self initWithModelClass:modelClass
+                               path:path
+                   recordTerminator:recordTerminator
+                          indexPath:nil
+                      cacheCapacity:0
+                              error:error];
+}
+
+- (instancetype _Nullable)initWithModelClass:(Class _Nonnull)modelClass
+                                        path:(NSString* _Nonnull)path
+                            recordTerminator:(unichar)recordTerminator
+                                   indexPath:(NSString* _Nullable)indexPath
+                               cacheCapacity:(NSUInteger)cacheCapacity
+                                       error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(modelClass != nil);
+    NSParameterAssert(path != nil);
+    NSAssert(recordTerminator < 0x80, @"recordTerminator MUST be an ASCII character, but got %C", recordTerminator);
+    NSAssert(recordTerminator != '\\' && recordTerminator != '"' && recordTerminator != '\'',
+             @"recordTerminator MUST NOT be a backslash nor a quote");
+
+    if (self = [super init]) {
+        self.modelClass = modelClass;
+        self.recordTerminator = recordTerminator;
+        self.adapter = [MAEArrayAdapter adapterForModelClass:modelClass];
+        MAEScannerInit(&_scanner, (uint8_t)recordTerminator, self.adapter.quotedOptions);
+
+        if (![self mapFileAtPath:path error:error]) {
+            return nil;
+        }
+        if (!(indexPath && [self loadIndexAtPath:indexPath])) {
+            if (![self buildIndexWithError:error]) {
+                return nil;
+            }
+            if (indexPath) {
+                [self saveIndexToPath:indexPath];
+            }
+        }
+        if (_bytes) {
+            madvise((void*)_bytes, _length, MADV_RANDOM);
+        }
+        if (cacheCapacity > 0) {
+            self.cache = [[MAEModelCache alloc] initWithCapacity:cacheCapacity];
+        }
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    if (_bytes) {
+        munmap((void*)_bytes, _length);
+    }
+    if (_indexBytes) {
+        munmap(_indexBytes, _indexLength);
+    } else {
+        free((void*)_offsets);
+    }
+}
+
+#pragma mark - Public Methods
+
+- (id<MAEArraySerializing> _Nullable)modelAtIndex:(NSUInteger)index error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(index < self.count);
+
+    id<MAEArraySerializing> model = [self.cache modelAtIndex:index];
+    if (model) {
+        return model;
+    }
+
+    NSRange range = [self rangeOfRecordAtIndex:index];
+    model = [self.adapter modelFromUTF8Bytes:(const char*)_bytes + range.location length:range.length error:error];
+    if (model) {
+        [self.cache setModel:model atIndex:index];
+    }
+    return model;
+}
+
+- (NSString* _Nullable)recordAtIndex:(NSUInteger)index
+{
+    NSParameterAssert(index < self.count);
+
+    NSRange range = [self rangeOfRecordAtIndex:index];
+    return [[NSString alloc] initWithBytes:_bytes + range.location length:range.length encoding:NSUTF8StringEncoding];
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Map the file into memory.
+ *
+ * @param path   A path of the file
+ * @param error  If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)mapFileAtPath:(NSString* _Nonnull)path error:(NSError* _Nullable* _Nullable)error
+{
+    int fd = open(path.fileSystemRepresentation, O_RDONLY);
+    if (fd < 0 || fstat(fd, &_fileStat) != 0) {
+        if (error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:@{ NSFilePathErrorKey : path }];
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+        return NO;
+    }
+
+    _length = (NSUInteger)_fileStat.st_size;
+    if (_length > 0) {
+        void* bytes = mmap(NULL, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (bytes == MAP_FAILED) {
+            if (error) {
+                *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:@{ NSFilePathErrorKey : path }];
+            }
+            close(fd);
+            return NO;
+        }
+        _bytes = bytes;
+    }
+    // NOTE: The mapping remains valid after the file descriptor is closed.
+    close(fd);
+    return YES;
+}
+
+/**
+ * Map the sidecar file, and use it as the index if it corresponds to the file.
+ *
+ * @param indexPath  A path of the sidecar file
+ * @return If the index is loaded, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)loadIndexAtPath:(NSString* _Nonnull)indexPath
+{
+    int fd = open(indexPath.fileSystemRepresentation, O_RDONLY);
+    if (fd < 0) {
+        return NO;
+    }
+    struct stat indexStat;
+    if (fstat(fd, &indexStat) != 0 || (NSUInteger)indexStat.st_size < sizeof(MAEIndexHeader)) {
+        close(fd);
+        return NO;
+    }
+
+    const NSUInteger indexLength = (NSUInteger)indexStat.st_size;
+    void* indexBytes = mmap(NULL, indexLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (indexBytes == MAP_FAILED) {
+        return NO;
+    }
+
+    const MAEIndexHeader* header = indexBytes;
+    if (header->magic != MAEIndexMagic || header->version != MAEIndexVersion
+        || header->fileSize != (uint64_t)_fileStat.st_size
+        || header->modifiedSeconds != (int64_t)MAEModificationTime(&_fileStat).tv_sec
+        || header->modifiedNanoseconds != (int64_t)MAEModificationTime(&_fileStat).tv_nsec
+        || header->recordTerminator != self.recordTerminator
+        || header->quotedOptions != self.adapter.quotedOptions
+        || header->count > (indexLength - sizeof(MAEIndexHeader)) / sizeof(uint64_t)
+        || indexLength != sizeof(MAEIndexHeader) + header->count * sizeof(uint64_t)) {
+        munmap(indexBytes, indexLength);
+        return NO;
+    }
+
+    _indexBytes = indexBytes;
+    _indexLength = indexLength;
+    _offsets = (const uint64_t*)(header + 1);
+    self.count = (NSUInteger)header->count;
+    self.loadedIndex = YES;
+    return YES;
+}
+
+/**
+ * Save the index to the sidecar file. If it can not be saved, it is ignored.
+ *
+ * @param indexPath  A path of the sidecar file
+ */
+- (void)saveIndexToPath:(NSString* _Nonnull)indexPath
+{
+    MAEIndexHeader header = {
+        .magic = MAEIndexMagic,
+        .version = MAEIndexVersion,
+        .fileSize = (uint64_t)_fileStat.st_size,
+        .modifiedSeconds = (int64_t)MAEModificationTime(&_fileStat).tv_sec,
+        .modifiedNanoseconds = (int64_t)MAEModificationTime(&_fileStat).tv_nsec,
+        .recordTerminator = self.recordTerminator,
+        .quotedOptions = (uint32_t)self.adapter.quotedOptions,
+        .count = self.count,
+    };
+    NSMutableData* data = [NSMutableData dataWithCapacity:sizeof(header) + self.count * sizeof(uint64_t)];
+    [data appendBytes:&header length:sizeof(header)];
+    if (self.count > 0) {
+        [data appendBytes:_offsets length:self.count * sizeof(uint64_t)];
+    }
+    [data writeToFile:indexPath atomically:YES];
+}
+
+/**
+ * Index records of the file.
+ *
+ * The file is split into chunks, and chunks are scanned in parallel twice.
+ * First, it finds the state at the end of each chunk for all possible states at the start,
+ * so the actual state at the start of each chunk is resolved without scanning preceding chunks again.
+ * Next, it finds terminators of each chunk from the actual state.
+ *
+ * @param error  If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise (e.g. memory could not be allocated), it returns NO.
+ */
+- (BOOL)buildIndexWithError:(NSError* _Nullable* _Nullable)error
+{
+    const NSUInteger length = _length;
+    if (length == 0) {
+        self.count = 0;
+        return YES;
+    }
+    const uint8_t* bytes = _bytes;
+    madvise((void*)bytes, length, MADV_SEQUENTIAL);
+
+    NSUInteger chunkCount = NSProcessInfo.processInfo.activeProcessorCount * MAEIndexChunksPerProcessor;
+    const NSUInteger chunkSize = MAX(MAEIndexMinimumChunkSize, (length + chunkCount - 1) / chunkCount);
+    chunkCount = (length + chunkSize - 1) / chunkSize;
+
+    const MAEScanner* scanner = &_scanner;
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+
+    // NOTE: The state at the end of the last chunk is not used.
+    uint8_t* endStates = malloc(chunkCount * MAEScanStateCount);
+    dispatch_apply(chunkCount - 1, queue, ^(size_t chunk) {
+        const NSUInteger start = chunk * chunkSize;
+        MAEScanTransitions(scanner, bytes + start, MIN(length, start + chunkSize) - start,
+                           endStates + chunk * MAEScanStateCount);
+    });
+
+    uint8_t* startStates = malloc(chunkCount);
+    uint8_t state = MAEScanStatePlain;
+    for (NSUInteger chunk = 0; chunk < chunkCount; chunk++) {
+        startStates[chunk] = state;
+        state = endStates[chunk * MAEScanStateCount + state];
+    }
+    free(endStates);
+
+    MAEOffsetList* terminators = calloc(chunkCount, sizeof(MAEOffsetList));
+    dispatch_apply(chunkCount, queue, ^(size_t chunk) {
+        const NSUInteger start = chunk * chunkSize;
+        MAEScanTerminators(scanner, bytes, NSMakeRange(start, MIN(length, start + chunkSize) - start),
+                           startStates[chunk], &terminators[chunk]);
+    });
+    free(startStates);
+
+    NSUInteger terminatorCount = 0;
+    BOOL failed = NO;
+    for (NSUInteger chunk = 0; chunk < chunkCount; chunk++) {
+        terminatorCount += terminators[chunk].count;
+        failed = failed || terminators[chunk].failed;
+    }
+
+    // NOTE: Empty records are skipped in the same way as MAEArrayReader.
+    uint64_t* offsets = failed ? NULL : malloc((terminatorCount + 1) * sizeof(uint64_t));
+    if (!offsets) {
+        for (NSUInteger chunk = 0; chunk < chunkCount; chunk++) {
+            free(terminators[chunk].offsets);
+        }
+        free(terminators);
+        if (error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:nil];
+        }
+        return NO;
+    }
+    NSUInteger count = 0, recordStart = 0;
+    for (NSUInteger chunk = 0; chunk < chunkCount; chunk++) {
+        for (NSUInteger i = 0; i < terminators[chunk].count; i++) {
+            const NSUInteger recordEnd = (NSUInteger)terminators[chunk].offsets[i];
+            if ([self lengthOfRecordFrom:recordStart to:recordEnd] > 0) {
+                offsets[count++] = recordStart;
+            }
+            recordStart = recordEnd + 1;
+        }
+        free(terminators[chunk].offsets);
+    }
+    free(terminators);
+    if ([self lengthOfRecordFrom:recordStart to:length] > 0) {
+        offsets[count++] = recordStart;
+    }
+
+    _offsets = offsets;
+    self.count = count;
+    return YES;
+}
+
+/**
+ * Returns the length of the record, excluding the trailing '\r' if the terminator is '\n'.
+ *
+ * @param start  The offset of the record
+ * @param end    The offset of the terminator, or the end of the file
+ * @return The length of the record
+ */
+- (NSUInteger)lengthOfRecordFrom:(NSUInteger)start to:(NSUInteger)end
+{
+    if (self.recordTerminator == '\n' && end > start && _bytes[end - 1] == '\r') {
+        end--;
+    }
+    return end - start;
+}
+
+/**
+ * Returns the byte range of the record.
+ * The end of the record is found by scanning from the start, because the index only has offsets.
+ *
+ * @param index  An index of the record
+ * @return A byte range
+ */
+- (NSRange)rangeOfRecordAtIndex:(NSUInteger)index
+{
+    const NSUInteger start = (NSUInteger)_offsets[index];
+    uint8_t state = MAEScanStatePlain;
+    NSUInteger end = start;
+    for (; end < _length; end++) {
+        const uint8_t byteClass = _scanner.classes[_bytes[end]];
+        if (state == MAEScanStatePlain && byteClass == MAEByteClassTerminator) {
+            break;
+        }
+        state = _scanner.transitions[state][byteClass];
+    }
+    return NSMakeRange(start, [self lengthOfRecordFrom:start to:end]);
+}
+
+@end
@@ -0,0 +1,134 @@
+//
+//  MAEArrayMetrics.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEErrorCode.h"
+#import <Foundation/Foundation.h>
+
+/**
+ * Phases of conversion from string (or array) to model.
+ */
+typedef NS_ENUM(NSUInteger, MAEArrayPhase) {
+    /// Splitting a string into fields. (MAETokenizer)
+    MAEArrayPhaseSeparate,
+    /// Choosing the format for the number of fields. (+chooseFormatByPropertyKey:withCount:)
+    MAEArrayPhaseChooseFormat,
+    /// Validating a field with the fragment. (MAEFragment # validateWithSeparatedString:error:)
+    MAEArrayPhaseValidateFragment,
+    /// Transforming a field to the value of the property. (+<key>ArrayTransformer)
+    MAEArrayPhaseTransform,
+    /// Creating a model. (MTLModel # modelWithDictionary:error:, or +new if properties are set by decoders)
+    MAEArrayPhaseCreateModel,
+    /// Validating a model. (MTLModel # validate:)
+    MAEArrayPhaseValidateModel,
+};
+
+/// The number of MAEArrayPhase
+#define MAEArrayPhaseCount 6
+
+/**
+ * An observer that receives metrics of conversion.
+ *
+ * Methods may be called on any thread at the same time, so they MUST be thread-safe.
+ * Please refer to MAEArrayAdapter # setMetricsObserver:
+ */
+@protocol MAEArrayMetricsObserver <NSObject>
+
+/**
+ * It is called when a phase of conversion is finished.
+ *
+ * @param phase        A phase
+ * @param modelClass   A model class that the adapter converts
+ * @param propertyKey  A property key. It is nil, unless the phase is MAEArrayPhaseTransform.
+ * @param duration     The time spent in the phase
+ */
+- (void)didFinishPhase:(MAEArrayPhase)phase
+          ofModelClass:(Class _Nonnull)modelClass
+           propertyKey:(NSString* _Nullable)propertyKey
+              duration:(NSTimeInterval)duration;
+
+/**
+ * It is called when an error of MAEErrorDomain occurs.
+ * Errors returned by transformers and models of other domains are not reported.
+ *
+ * @param code  An error code
+ */
+- (void)didFailWithErrorCode:(MAEErrorCode)code;
+
+@end
+
+/**
+ * A metrics observer that accumulates call counts and time.
+ * It is thread-safe.
+ */
+@interface MAEArrayMetrics : NSObject <MAEArrayMetricsObserver>
+
+#pragma mark - Public Methods
+
+/**
+ * Returns the number of times the phase has finished.
+ *
+ * @param phase       A phase
+ * @param modelClass  A model class
+ * @return A count
+ */
+- (NSUInteger)countOfPhase:(MAEArrayPhase)phase ofModelClass:(Class _Nonnull)modelClass;
+
+/**
+ * Returns the cumulative time spent in the phase.
+ *
+ * @param phase       A phase
+ * @param modelClass  A model class
+ * @return A cumulative time
+ */
+- (NSTimeInterval)durationOfPhase:(MAEArrayPhase)phase ofModelClass:(Class _Nonnull)modelClass;
+
+/**
+ * Returns the number of times the transformer of the property has been applied.
+ *
+ * @param propertyKey  A property key
+ * @param modelClass   A model class
+ * @return A count
+ */
+- (NSUInteger)countOfTransformerForPropertyKey:(NSString* _Nonnull)propertyKey ofModelClass:(Class _Nonnull)modelClass;
+
+/**
+ * Returns the cumulative time spent in the transformer of the property.
+ *
+ * @param propertyKey  A property key
+ * @param modelClass   A model class
+ * @return A cumulative time
+ */
+- (NSTimeInterval)durationOfTransformerForPropertyKey:(NSString* _Nonnull)propertyKey
+                                         ofModelClass:(Class _Nonnull)modelClass;
+
+/**
+ * Returns the number of errors of the code.
+ *
+ * @param code  An error code
+ * @return A count
+ */
+- (NSUInteger)countOfErrorCode:(MAEErrorCode)code;
+
+/**
+ * Returns all metrics as a dictionary that can be serialized by NSJSONSerialization.
+ *
+ * e.g.
+ *   @{ @"phases" : @{ @"Model" : @{ @"transform" : @{ @"count" : @10, @"duration" : @0.001 } } },
+ *      @"transformers" : @{ @"Model" : @{ @"name" : @{ @"count" : @10, @"duration" : @0.001 } } },
+ *      @"errors" : @{ @"2" : @1 } }
+ *
+ * @return A dictionary
+ */
+- (NSDictionary<NSString*, NSDictionary*>* _Nonnull)dictionaryValue;
+
+/**
+ * Clear all metrics.
+ */
+- (void)reset;
+
+@end
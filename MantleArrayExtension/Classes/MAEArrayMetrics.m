@@ -0,0 +1,248 @@
+//
+//  MAEArrayMetrics.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayMetrics.h"
+#import <pthread.h>
+
+/**
+ * A cumulative count and time.
+ */
+@interface MAEArrayMetricsCounter : NSObject {
+  @public
+    NSUInteger _count;
+    NSTimeInterval _duration;
+}
+@end
+
+@implementation MAEArrayMetricsCounter
+
+#pragma mark - Public Methods
+
+/**
+ * Returns the counter as a dictionary.
+ *
+ * @return A dictionary
+ */
+- (NSDictionary<NSString*, NSNumber*>* _Nonnull)dictionaryValue
+{
+    return @{ @"count" : @(_count), @"duration" : @(_duration) };
+}
+
+@end
+
+@implementation MAEArrayMetrics {
+    pthread_mutex_t _lock;
+    /// Model class -> An array of MAEArrayPhaseCount counters
+    NSMutableDictionary* _phaseCounters;
+    /// Model class -> Property key -> A counter
+    NSMutableDictionary* _transformerCounters;
+    NSCountedSet<NSNumber*>* _errorCodes;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nonnull)init
+{
+    if (self = [super init]) {
+        pthread_mutex_init(&_lock, NULL);
+        _phaseCounters = [NSMutableDictionary dictionary];
+        _transformerCounters = [NSMutableDictionary dictionary];
+        _errorCodes = [NSCountedSet set];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark - MAEArrayMetricsObserver
+
+- (void)didFinishPhase:(MAEArrayPhase)phase
+          ofModelClass:(Class _Nonnull)modelClass
+           propertyKey:(NSString* _Nullable)propertyKey
+              duration:(NSTimeInterval)duration
+{
+    NSParameterAssert(phase < MAEArrayPhaseCount);
+
+    pthread_mutex_lock(&_lock);
+    MAEArrayMetricsCounter* counter = [self phaseCountersOfModelClass:modelClass create:YES][phase];
+    counter->_count++;
+    counter->_duration += duration;
+
+    if (propertyKey) {
+        counter = [self transformerCounterForPropertyKey:propertyKey ofModelClass:modelClass create:YES];
+        counter->_count++;
+        counter->_duration += duration;
+    }
+    pthread_mutex_unlock(&_lock);
+}
+
+- (void)didFailWithErrorCode:(MAEErrorCode)code
+{
+    pthread_mutex_lock(&_lock);
+    [_errorCodes addObject:@(code)];
+    pthread_mutex_unlock(&_lock);
+}
+
+#pragma mark - Public Methods
+
+- (NSUInteger)countOfPhase:(MAEArrayPhase)phase ofModelClass:(Class _Nonnull)modelClass
+{
+    NSParameterAssert(phase < MAEArrayPhaseCount);
+
+    pthread_mutex_lock(&_lock);
+    NSUInteger count = [self phaseCountersOfModelClass:modelClass create:NO][phase]->_count;
+    pthread_mutex_unlock(&_lock);
+    return count;
+}
+
+- (NSTimeInterval)durationOfPhase:(MAEArrayPhase)phase ofModelClass:(Class _Nonnull)modelClass
+{
+    NSParameterAssert(phase < MAEArrayPhaseCount);
+
+    pthread_mutex_lock(&_lock);
+    NSTimeInterval duration = [self phaseCountersOfModelClass:modelClass create:NO][phase]->_duration;
+    pthread_mutex_unlock(&_lock);
+    return duration;
+}
+
+- (NSUInteger)countOfTransformerForPropertyKey:(NSString* _Nonnull)propertyKey ofModelClass:(Class _Nonnull)modelClass
+{
+    pthread_mutex_lock(&_lock);
+    NSUInteger count = [self transformerCounterForPropertyKey:propertyKey ofModelClass:modelClass create:NO]->_count;
+    pthread_mutex_unlock(&_lock);
+    return count;
+}
+
+- (NSTimeInterval)durationOfTransformerForPropertyKey:(NSString* _Nonnull)propertyKey
+                                         ofModelClass:(Class _Nonnull)modelClass
+{
+    pthread_mutex_lock(&_lock);
+    NSTimeInterval duration
+        = [self transformerCounterForPropertyKey:propertyKey ofModelClass:modelClass create:NO]->_duration;
+    pthread_mutex_unlock(&_lock);
+    return duration;
+}
+
+- (NSUInteger)countOfErrorCode:(MAEErrorCode)code
+{
+    pthread_mutex_lock(&_lock);
+    NSUInteger count = [_errorCodes countForObject:@(code)];
+    pthread_mutex_unlock(&_lock);
+    return count;
+}
+
+- (NSDictionary<NSString*, NSDictionary*>* _Nonnull)dictionaryValue
+{
+    static NSString* const phaseNames[MAEArrayPhaseCount] = {
+        [MAEArrayPhaseSeparate] = @"separate",
+        [MAEArrayPhaseChooseFormat] = @"chooseFormat",
+        [MAEArrayPhaseValidateFragment] = @"validateFragment",
+        [MAEArrayPhaseTransform] = @"transform",
+        [MAEArrayPhaseCreateModel] = @"createModel",
+        [MAEArrayPhaseValidateModel] = @"validateModel",
+    };
+
+    NSMutableDictionary* phases = [NSMutableDictionary dictionary];
+    NSMutableDictionary* transformers = [NSMutableDictionary dictionary];
+    NSMutableDictionary* errors = [NSMutableDictionary dictionary];
+
+    pthread_mutex_lock(&_lock);
+    for (Class modelClass in _phaseCounters) {
+        NSMutableDictionary* dictionary = [NSMutableDictionary dictionaryWithCapacity:MAEArrayPhaseCount];
+        NSArray<MAEArrayMetricsCounter*>* counters = _phaseCounters[modelClass];
+        for (NSUInteger phase = 0; phase < MAEArrayPhaseCount; phase++) {
+            if (counters[phase]->_count > 0) {
+                dictionary[phaseNames[phase]] = [counters[phase] dictionaryValue];
+            }
+        }
+        phases[NSStringFromClass(modelClass)] = dictionary;
+    }
+    for (Class modelClass in _transformerCounters) {
+        NSMutableDictionary* dictionary = [NSMutableDictionary dictionary];
+        [_transformerCounters[modelClass]
+            enumerateKeysAndObjectsUsingBlock:^(NSString* _Nonnull key, MAEArrayMetricsCounter* _Nonnull counter,
+                                                BOOL* _Nonnull stop) {
+                dictionary[key] = [counter dictionaryValue];
+            }];
+        transformers[NSStringFromClass(modelClass)] = dictionary;
+    }
+    for (NSNumber* code in _errorCodes) {
+        errors[code.stringValue] = @([_errorCodes countForObject:code]);
+    }
+    pthread_mutex_unlock(&_lock);
+
+    return @{ @"phases" : phases, @"transformers" : transformers, @"errors" : errors };
+}
+
+- (void)reset
+{
+    pthread_mutex_lock(&_lock);
+    [_phaseCounters removeAllObjects];
+    [_transformerCounters removeAllObjects];
+    [_errorCodes removeAllObjects];
+    pthread_mutex_unlock(&_lock);
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Returns counters of all phases of the model class. The lock MUST be held.
+ *
+ * @param modelClass  A model class
+ * @param create      If it is YES and there are no counters, it creates them.
+ *                    Otherwise, it returns zero counters that are not saved.
+ * @return An array of MAEArrayPhaseCount counters
+ */
+- (NSArray<MAEArrayMetricsCounter*>* _Nonnull)phaseCountersOfModelClass:(Class _Nonnull)modelClass create:(BOOL)create
+{
+    NSArray<MAEArrayMetricsCounter*>* counters = _phaseCounters[modelClass];
+    if (!counters) {
+        NSMutableArray* newCounters = [NSMutableArray arrayWithCapacity:MAEArrayPhaseCount];
+        for (NSUInteger i = 0; i < MAEArrayPhaseCount; i++) {
+            [newCounters addObject:[MAEArrayMetricsCounter new]];
+        }
+        counters = newCounters;
+        if (create) {
+            _phaseCounters[(id<NSCopying>)modelClass] = counters;
+        }
+    }
+    return counters;
+}
+
+/**
+ * Returns the counter of the transformer. The lock MUST be held.
+ *
+ * @param propertyKey  A property key
+ * @param modelClass   A model class
+ * @param create       If it is YES and there is no counter, it creates it.
+ *                     Otherwise, it returns a zero counter that is not saved.
+ * @return A counter
+ */
+- (MAEArrayMetricsCounter* _Nonnull)transformerCounterForPropertyKey:(NSString* _Nonnull)propertyKey
+                                                        ofModelClass:(Class _Nonnull)modelClass
+                                                              create:(BOOL)create
+{
+    NSMutableDictionary<NSString*, MAEArrayMetricsCounter*>* counters = _transformerCounters[modelClass];
+    MAEArrayMetricsCounter* counter = counters[propertyKey];
+    if (!counter) {
+        counter = [MAEArrayMetricsCounter new];
+        if (create) {
+            if (!counters) {
+                counters = [NSMutableDictionary dictionary];
+                _transformerCounters[(id<NSCopying>)modelClass] = counters;
+            }
+            counters[propertyKey] = counter;
+        }
+    }
+    return counter;
+}
+
+@end
@@ -0,0 +1,124 @@
+//
+//  MAEArrayReader.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import <Foundation/Foundation.h>
+
+@class MAEArrayWriter;
+
+/**
+ * A reader that converts records in a stream to models.
+ *
+ * It reads the stream by fixed-size chunks, so memory usage does not depend on the size of the stream.
+ * Records are separated by the record terminator. The terminator enclosed in quoted-string or escaped by backslash
+ * is not treated as the end of record. (It uses the same rules as MAEArraySerializing)
+ *
+ * The input MUST be encoded by UTF-8.
+ */
+@interface MAEArrayReader : NSObject
+
+/// MAEArraySerializing model class
+@property (nonatomic, nonnull, strong, readonly) Class modelClass;
+/// The character that separates records. It MUST be an ASCII character.
+@property (nonatomic, assign, readonly) unichar recordTerminator;
+/// The number of bytes read at once. Default is 64 KiB.
+@property (nonatomic, assign) NSUInteger chunkSize;
+/// The maximum number of models passed to the block at once. Default is 256.
+@property (nonatomic, assign) NSUInteger batchSize;
+/// The maximum number of bytes of a record, excluding the record terminator. Default is 16 MiB.
+/// If a record is longer than it (e.g. a quoted-string is not closed), the reading fails with MAEErrorInvalidInputData.
+@property (nonatomic, assign) NSUInteger maximumRecordLength;
+/// Filters that records MUST pass. Rejected records are skipped. (Please refer to MAEArrayAdapter # adapterWithFilters:)
+@property (nonatomic, nullable, copy) NSArray<MAERecordFilter*>* filters;
+/// A pool that models are taken from. The block can recycle models that it no longer uses.
+/// (Please refer to MAEArrayAdapter # adapterWithModelPool:)
+@property (nonatomic, nullable, strong) MAEModelPool* modelPool;
+/// The number of records that were converted to models by the last reading.
+@property (nonatomic, assign, readonly) NSUInteger acceptedCount;
+/// The number of records that were rejected by filters in the last reading.
+@property (nonatomic, assign, readonly) NSUInteger rejectedCount;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance with an input stream.
+ * If the stream has not been opened, the reader opens it.
+ *
+ * @param modelClass        MAEArraySerializing model class
+ * @param inputStream       An input stream
+ * @param recordTerminator  The character that separates records. (e.g. '\n')
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass
+                                inputStream:(NSInputStream* _Nonnull)inputStream
+                           recordTerminator:(unichar)recordTerminator;
+
+/**
+ * Create an instance with a file handle.
+ *
+ * @param modelClass        MAEArraySerializing model class
+ * @param fileHandle        A file handle
+ * @param recordTerminator  The character that separates records. (e.g. '\n')
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass
+                                 fileHandle:(NSFileHandle* _Nonnull)fileHandle
+                           recordTerminator:(unichar)recordTerminator;
+
+/**
+ * Create an instance with a file descriptor.
+ * The reader does not close the file descriptor.
+ *
+ * @param modelClass        MAEArraySerializing model class
+ * @param fileDescriptor    A file descriptor
+ * @param recordTerminator  The character that separates records. (e.g. '\n')
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass
+                             fileDescriptor:(int)fileDescriptor
+                           recordTerminator:(unichar)recordTerminator;
+
+#pragma mark - Public Methods
+
+/**
+ * Read all records and pass models to the block in batches.
+ *
+ * Empty records are ignored. If the record terminator is '\n', the trailing '\r' of each record is also ignored.
+ * Records that are rejected by filters are skipped.
+ * If a record could not be converted, models before the record are passed to the block and it returns NO.
+ *
+ * @param block  A block that receives models. If it sets YES to stop, the reading is stopped.
+ * @param error  If it return NO, error information is saved here.
+ * @return If all records are read (or it is stopped by the block), it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)readModelsUsingBlock:(void (^_Nonnull)(NSArray<id<MAEArraySerializing> >* _Nonnull models,
+                                               BOOL* _Nonnull stop))block
+                       error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Read all records, replace the field of the property in each record, and write them to the writer.
+ *
+ * Only the field is encoded, and other bytes of each record are copied as they are.
+ * (Please refer to MAEArrayAdapter # appendRecordFromUTF8Bytes:length:replacingValue:forPropertyKey:toData:error:)
+ * Empty records and the trailing '\r' are also written as they are, and filters and modelPool are not used.
+ * acceptedCount is the number of replaced records.
+ * If a record could not be replaced, records before it are written and it returns NO.
+ * Please call MAEArrayWriter # flush: after it.
+ *
+ * @param value        A new value of the property. If the fragment is optional, it MUST NOT be nil.
+ * @param propertyKey  A property key of a fragment that is not variadic
+ * @param writer       A writer. Each record is followed by its record terminator.
+ * @param error        If it return NO, error information is saved here.
+ * @return If all records are written, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)patchRecordsReplacingValue:(id _Nullable)value
+                    forPropertyKey:(NSString* _Nonnull)propertyKey
+                          toWriter:(MAEArrayWriter* _Nonnull)writer
+                             error:(NSError* _Nullable* _Nullable)error;
+
+@end
@@ -0,0 +1,351 @@
+//
+//  MAEArrayReader.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayReader.h"
+#import "MAEArrayWriter.h"
+#import "NSError+MAEErrorCode.h"
+#import <unistd.h>
+
+static NSUInteger const MAEDefaultChunkSize = 64 * 1024;
+static NSUInteger const MAEDefaultBatchSize = 256;
+static NSUInteger const MAEDefaultMaximumRecordLength = 16 * 1024 * 1024;
+
+/**
+ * It reads bytes from a source.
+ *
+ * @return The number of bytes read. It returns 0 at the end of source, and -1 when an error occurred.
+ */
+typedef NSInteger (^MAEReadBlock)(uint8_t* _Nonnull buffer, NSUInteger length, NSError* _Nullable* _Nullable error);
+
+@interface MAEArrayReader ()
+@property (nonatomic, nonnull, strong, readwrite) Class modelClass;
+@property (nonatomic, assign, readwrite) unichar recordTerminator;
+@property (nonatomic, nonnull, strong) MAEArrayAdapter* adapter;
+@property (nonatomic, assign, readwrite) NSUInteger acceptedCount;
+@property (nonatomic, assign, readwrite) NSUInteger rejectedCount;
+@property (nonatomic, nonnull, copy) MAEReadBlock readBlock;
+/// An object that must be retained while reading. (e.g. NSFileHandle)
+@property (nonatomic, nullable, strong) id source;
+@end
+
+@implementation MAEArrayReader
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass
+                                  readBlock:(MAEReadBlock _Nonnull)readBlock
+                           recordTerminator:(unichar)recordTerminator
+{
+    NSParameterAssert(modelClass != nil);
+    NSParameterAssert(readBlock != nil);
+    NSAssert(recordTerminator < 0x80, @"recordTerminator MUST be an ASCII character, but got %C", recordTerminator);
+
+    if (self = [super init]) {
+        self.modelClass = modelClass;
+        self.adapter = [MAEArrayAdapter adapterForModelClass:modelClass];
+        self.readBlock = readBlock;
+        self.recordTerminator = recordTerminator;
+        self.chunkSize = MAEDefaultChunkSize;
+        self.batchSize = MAEDefaultBatchSize;
+        self.maximumRecordLength = MAEDefaultMaximumRecordLength;
+    }
+    return self;
+}
+
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass
+                                inputStream:(NSInputStream* _Nonnull)inputStream
+                           recordTerminator:(unichar)recordTerminator
+{
+    NSParameterAssert(inputStream != nil);
+
+    MAEReadBlock readBlock = ^NSInteger(uint8_t* _Nonnull buffer, NSUInteger length, NSError* _Nullable* _Nullable error) {
+        if (inputStream.streamStatus == NSStreamStatusNotOpen) {
+            [inputStream open];
+        }
+        NSInteger n = [inputStream read:buffer maxLength:length];
+        if (n < 0 && error) {
+            *error = inputStream.streamError;
+        }
+        return n;
+    };
+
+    if (self = [self initWithModelClass:modelClass readBlock:readBlock recordTerminator:recordTerminator]) {
+        self.source = inputStream;
+    }
+    return self;
+}
+
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass
+                                 fileHandle:(NSFileHandle* _Nonnull)fileHandle
+                           recordTerminator:(unichar)recordTerminator
+{
+    NSParameterAssert(fileHandle != nil);
+
+    if (self = [self initWithModelClass:modelClass
+                         fileDescriptor:fileHandle.fileDescriptor
+                       recordTerminator:recordTerminator]) {
+        self.source = fileHandle;
+    }
+    return self;
+}
+
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass
+                             fileDescriptor:(int)fileDescriptor
+                           recordTerminator:(unichar)recordTerminator
+{
+    NSParameterAssert(fileDescriptor >= 0);
+
+    MAEReadBlock readBlock = ^NSInteger(uint8_t* _Nonnull buffer, NSUInteger length, NSError* _Nullable* _Nullable error) {
+        ssize_t n;
+        do {
+            n = read(fileDescriptor, buffer, length);
+        } while (n < 0 && errno == EINTR);
+
+        if (n < 0 && error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+        }
+        return n;
+    };
+    return [self initWithModelClass:modelClass readBlock:readBlock recordTerminator:recordTerminator];
+}
+
+#pragma mark - Public Methods
+
+- (BOOL)readModelsUsingBlock:(void (^_Nonnull)(NSArray<id<MAEArraySerializing> >* _Nonnull models,
+                                               BOOL* _Nonnull stop))block
+                       error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(block != nil);
+    NSAssert(self.batchSize > 0, @"batchSize MUST be greater than 0");
+
+    MAEArrayAdapter* adapter = [[self.adapter adapterWithFilters:self.filters] adapterWithModelPool:self.modelPool];
+    const BOOL trimsCarriageReturn = self.recordTerminator == '\n';
+    const NSUInteger batchSize = self.batchSize;
+    self.acceptedCount = 0;
+    self.rejectedCount = 0;
+
+    __block BOOL stop = NO;
+    NSMutableArray<id<MAEArraySerializing> >* models = [NSMutableArray arrayWithCapacity:batchSize];
+
+    void (^flush)(void) = ^{
+        if (models.count > 0) {
+            BOOL stopByBlock = NO;
+            block([models copy], &stopByBlock);
+            [models removeAllObjects];
+            stop |= stopByBlock;
+        }
+    };
+
+    BOOL success = [self scanRecordsUsingBlock:^BOOL(const uint8_t* _Nonnull bytes, NSUInteger length, BOOL* _Nonnull stopScanning) {
+        if (trimsCarriageReturn && length > 0 && bytes[length - 1] == '\r') {
+            length--;
+        }
+        if (length == 0) {
+            return YES;
+        }
+
+        // NOTE: The error MUST be retained out of the autorelease pool.
+        NSError* recordError = nil;
+        BOOL ok = NO;
+        @autoreleasepool {
+            NSString* record = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+            if (!record) {
+                SET_ERROR(&recordError, MAEErrorInvalidInputData,
+                          @{ NSLocalizedFailureReasonErrorKey : @"The record is not a valid UTF-8 string" });
+            } else {
+                NSError* modelError = nil;
+                id<MAEArraySerializing> model = [adapter modelFromString:record error:&modelError];
+                if (model) {
+                    [models addObject:model];
+                    self.acceptedCount++;
+                    ok = YES;
+                } else if ([modelError.domain isEqualToString:MAEErrorDomain]
+                           && modelError.code == MAEErrorRejectedByFilter) {
+                    self.rejectedCount++;
+                    ok = YES;
+                } else {
+                    recordError = modelError;
+                }
+            }
+        }
+        if (!ok) {
+            if (error) {
+                *error = recordError;
+            }
+            return NO;
+        }
+
+        if (models.count >= batchSize) {
+            flush();
+            *stopScanning = stop;
+        }
+        return YES;
+    }
+                                                 error:error];
+
+    if (!stop) {
+        flush();
+    }
+    return success;
+}
+
+- (BOOL)patchRecordsReplacingValue:(id _Nullable)value
+                    forPropertyKey:(NSString* _Nonnull)propertyKey
+                          toWriter:(MAEArrayWriter* _Nonnull)writer
+                             error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(propertyKey != nil && writer != nil);
+
+    MAEArrayAdapter* adapter = self.adapter;
+    const BOOL trimsCarriageReturn = self.recordTerminator == '\n';
+    NSMutableData* record = [NSMutableData data];
+    self.acceptedCount = 0;
+    self.rejectedCount = 0;
+
+    return [self scanRecordsUsingBlock:^BOOL(const uint8_t* _Nonnull bytes, NSUInteger length, BOOL* _Nonnull stop) {
+        NSUInteger contentLength = length;
+        if (trimsCarriageReturn && length > 0 && bytes[length - 1] == '\r') {
+            contentLength--;
+        }
+
+        record.length = 0;
+        if (contentLength > 0) {
+            if (![adapter appendRecordFromUTF8Bytes:(const char*)bytes
+                                             length:contentLength
+                                     replacingValue:value
+                                     forPropertyKey:propertyKey
+                                             toData:record
+                                              error:error]) {
+                return NO;
+            }
+            self.acceptedCount++;
+        }
+        // NOTE: The trailing '\r' is written as it is, so that line endings are not changed.
+        [record appendBytes:bytes + contentLength length:length - contentLength];
+        return [writer writeRecordFromUTF8Bytes:record.bytes length:record.length error:error];
+    }
+                                 error:error];
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Read all records and pass them to the block, without conversion.
+ *
+ * @param block  A block that receives bytes of a record, excluding the record terminator.
+ *               The bytes are valid only while the block is called. If it sets YES to stop, the reading is stopped.
+ *               If it returns NO, the reading is stopped and it returns NO.
+ * @param error  If it return NO, error information is saved here.
+ * @return If all records are read (or it is stopped by the block), it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)scanRecordsUsingBlock:(BOOL (^_Nonnull)(const uint8_t* _Nonnull bytes, NSUInteger length, BOOL* _Nonnull stop))block
+                        error:(NSError* _Nullable* _Nullable)error
+{
+    NSAssert(self.chunkSize > 0, @"chunkSize MUST be greater than 0");
+
+    const uint8_t terminator = (uint8_t)self.recordTerminator;
+    const NSUInteger maximumRecordLength = self.maximumRecordLength;
+    const BOOL doubleQuoteEnabled = (self.adapter.quotedOptions & MAEArrayDoubleQuotedEnable) != 0;
+    const BOOL singleQuoteEnabled = (self.adapter.quotedOptions & MAEArraySingleQuotedEnable) != 0;
+
+    NSUInteger capacity = self.chunkSize;
+    uint8_t* buffer = malloc(capacity);
+    // NOTE: [recordStart, length) is the incomplete record.
+    NSUInteger length = 0, recordStart = 0;
+    BOOL escaped = NO, singleQuoted = NO, doubleQuoted = NO, success = YES, stop = NO;
+
+    while (success && !stop) {
+        if (recordStart > 0) {
+            memmove(buffer, buffer + recordStart, length - recordStart);
+            length -= recordStart;
+            recordStart = 0;
+        }
+        if (capacity - length < self.chunkSize) {
+            // NOTE: It grows only when a record is longer than the chunk.
+            uint8_t* grownBuffer = realloc(buffer, length + self.chunkSize);
+            if (!grownBuffer) {
+                if (error) {
+                    *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:nil];
+                }
+                success = NO;
+                break;
+            }
+            buffer = grownBuffer;
+            capacity = length + self.chunkSize;
+        }
+
+        NSInteger n = self.readBlock(buffer + length, self.chunkSize, error);
+        if (n < 0) {
+            success = NO;
+            break;
+        } else if (n == 0) {
+            if (length - recordStart > maximumRecordLength) {
+                success = [self failWithRecordTooLongError:error];
+            } else if (length > recordStart) {
+                success = block(buffer + recordStart, length - recordStart, &stop);
+            }
+            break;
+        }
+
+        for (NSUInteger i = length; i < length + n; i++) {
+            uint8_t c = buffer[i];
+            if (escaped) {
+                escaped = NO;
+            } else if (c == '\\') {
+                escaped = YES;
+            } else if (!singleQuoted && !doubleQuoted && c == terminator) {
+                if (i - recordStart > maximumRecordLength) {
+                    success = [self failWithRecordTooLongError:error];
+                    break;
+                }
+                if (!(success = block(buffer + recordStart, i - recordStart, &stop))) {
+                    break;
+                }
+                recordStart = i + 1;
+                if (stop) {
+                    break;
+                }
+            } else if (!singleQuoted && doubleQuoteEnabled && c == '"') {
+                doubleQuoted = !doubleQuoted;
+            } else if (!doubleQuoted && singleQuoteEnabled && c == '\'') {
+                singleQuoted = !singleQuoted;
+            }
+        }
+        length += n;
+
+        // NOTE: It fails before the buffer grows, if the incomplete record never ends. (e.g. an unclosed quote)
+        if (success && !stop && length - recordStart > maximumRecordLength) {
+            success = [self failWithRecordTooLongError:error];
+        }
+    }
+
+    free(buffer);
+    return success;
+}
+
+/**
+ * Save the error that a record is longer than maximumRecordLength.
+ *
+ * @param error  Error information is saved here.
+ * @return It always returns NO.
+ */
+- (BOOL)failWithRecordTooLongError:(NSError* _Nullable* _Nullable)error
+{
+    SET_ERROR(error, MAEErrorInvalidInputData,
+              @{ NSLocalizedFailureReasonErrorKey : format(@"The record is longer than %lu bytes",
+                                                           (unsigned long)self.maximumRecordLength) });
+    return NO;
+}
+
+@end
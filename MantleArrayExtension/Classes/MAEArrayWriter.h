@@ -0,0 +1,129 @@
+//
+//  MAEArrayWriter.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import <Foundation/Foundation.h>
+
+/**
+ * A writer that converts models to records, and writes them to a buffer, a stream or a file descriptor as UTF-8.
+ *
+ * Each record is the same string as MAEArrayAdapter # stringFromModel:error:, followed by the record terminator.
+ * Fields are appended directly to one buffer, so it does not create a string per record.
+ *
+ * When it writes to a stream, the records are buffered and written when the buffer exceeds bufferSize.
+ * Please call flush: after writing all models.
+ */
+@interface MAEArrayWriter : NSObject
+
+/// The character that is written after each record. It MUST be an ASCII character.
+@property (nonatomic, assign, readonly) unichar recordTerminator;
+/// The number of bytes buffered before they are written to the stream. Default is 64 KiB.
+@property (nonatomic, assign) NSUInteger bufferSize;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance that appends records to the data.
+ *
+ * @param data              A buffer
+ * @param recordTerminator  The character that is written after each record. (e.g. '\n')
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithMutableData:(NSMutableData* _Nonnull)data
+                            recordTerminator:(unichar)recordTerminator;
+
+/**
+ * Create an instance with an output stream.
+ * If the stream has not been opened, the writer opens it.
+ *
+ * @param outputStream      An output stream
+ * @param recordTerminator  The character that is written after each record. (e.g. '\n')
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithOutputStream:(NSOutputStream* _Nonnull)outputStream
+                             recordTerminator:(unichar)recordTerminator;
+
+/**
+ * Create an instance with a file descriptor.
+ * The writer does not close the file descriptor.
+ *
+ * @param fileDescriptor    A file descriptor
+ * @param recordTerminator  The character that is written after each record. (e.g. '\n')
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithFileDescriptor:(int)fileDescriptor
+                               recordTerminator:(unichar)recordTerminator;
+
+#pragma mark - Public Methods
+
+/**
+ * Convert the model to a record and write it.
+ *
+ * @param model  a MAEArraySerializing model object
+ * @param error  If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO and nothing of the model is written.
+ */
+- (BOOL)writeModel:(id<MAEArraySerializing> _Nonnull)model
+             error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Write the record as it is, followed by the record terminator.
+ *
+ * @param bytes   UTF-8 bytes of a record. It does not need to be terminated by NUL.
+ * @param length  The number of bytes
+ * @param error   If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)writeRecordFromUTF8Bytes:(const char* _Nonnull)bytes
+                          length:(NSUInteger)length
+                           error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Convert the models to records and write them in order.
+ *
+ * If a model could not be converted, models before it are written and it returns NO.
+ *
+ * @param models  MAEArraySerializing model objects
+ * @param error   If it return NO, error information is saved here.
+ * @return If all models are written, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)writeModels:(NSArray<id<MAEArraySerializing> >* _Nonnull)models
+              error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Convert the models to records on multiple threads, and write them in the original order.
+ *
+ * Models are taken from the enumeration by chunks, and each chunk is converted into its own buffer concurrently.
+ * Chunks are written on the calling thread in order. The number of chunks that wait for writing is bounded,
+ * so if the stream is slower than conversion, models are not taken from the enumeration until chunks are written.
+ *
+ * Models of different classes can be mixed. Each model is converted by the adapter of its class.
+ * Models that could not be converted are skipped, and their errors are saved by their indexes in the enumeration.
+ * Please call flush: after writing all models.
+ *
+ * @param models  MAEArraySerializing model objects. (e.g. NSArray, NSEnumerator)
+ *                It is enumerated on the calling thread only.
+ * @param errors  Errors of models that could not be converted, keyed by their indexes. If all models are converted, it is nil.
+ * @param error   If it return NO, error information of writing is saved here.
+ * @return If records of all converted models are written, it returns YES.
+ *         If writing failed, it stops taking models and returns NO.
+ */
+- (BOOL)writeModelsConcurrently:(id<NSFastEnumeration> _Nonnull)models
+                         errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors
+                          error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Write the buffered records to the stream.
+ * If the writer appends records to data, it does nothing.
+ *
+ * @param error  If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)flush:(NSError* _Nullable* _Nullable)error;
+
+@end
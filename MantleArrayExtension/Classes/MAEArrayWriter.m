@@ -0,0 +1,365 @@
+//
+//  MAEArrayWriter.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayWriter.h"
+#import "NSError+MAEErrorCode.h"
+#import <errno.h>
+#import <unistd.h>
+
+static NSUInteger const MAEDefaultBufferSize = 64 * 1024;
+/// The number of models that are converted at once by writeModelsConcurrently:errors:error:
+static NSUInteger const MAEConcurrentChunkSize = 1024;
+/// The number of chunks per processor that may wait for writing.
+static NSUInteger const MAEPendingChunksPerProcessor = 2;
+
+/**
+ * It writes bytes to a destination.
+ *
+ * @return The number of bytes written. It returns 0 or -1 when an error occurred.
+ */
+typedef NSInteger (^MAEWriteBlock)(const uint8_t* _Nonnull bytes, NSUInteger length, NSError* _Nullable* _Nullable error);
+
+/**
+ * Models converted at once, and their records.
+ */
+@interface MAEWriterChunk : NSObject
+@property (nonatomic, nonnull, strong) NSMutableArray* models;
+/// The index of the first model in the enumeration
+@property (nonatomic, assign) NSUInteger startIndex;
+@property (nonatomic, nonnull, strong) NSMutableData* data;
+/// Errors of models keyed by their indexes. It is nil, if all models are converted.
+@property (nonatomic, nullable, strong) NSMutableDictionary<NSNumber*, NSError*>* errors;
+/// It is left, when the chunk is converted.
+@property (nonatomic, nonnull, strong) dispatch_group_t group;
+@end
+
+@implementation MAEWriterChunk
+@end
+
+@interface MAEArrayWriter ()
+@property (nonatomic, assign, readwrite) unichar recordTerminator;
+/// The data that records are appended to. If it writes to a destination, it is an internal buffer.
+@property (nonatomic, nonnull, strong) NSMutableData* buffer;
+/// A block that writes to the destination. If it is nil, records are only appended to the buffer.
+@property (nonatomic, nullable, copy) MAEWriteBlock writeBlock;
+/// The adapter used last time. Most writers write models of the same class.
+@property (nonatomic, nullable, strong) MAEArrayAdapter* adapter;
+@end
+
+@implementation MAEArrayWriter
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithMutableData:(NSMutableData* _Nonnull)data
+                            recordTerminator:(unichar)recordTerminator
+{
+    NSParameterAssert(data != nil);
+    NSAssert(recordTerminator < 0x80, @"recordTerminator MUST be an ASCII character, but got %C", recordTerminator);
+
+    if (self = [super init]) {
+        self.buffer = data;
+        self.recordTerminator = recordTerminator;
+        self.bufferSize = MAEDefaultBufferSize;
+    }
+    return self;
+}
+
+- (instancetype _Nonnull)initWithOutputStream:(NSOutputStream* _Nonnull)outputStream
+                             recordTerminator:(unichar)recordTerminator
+{
+    NSParameterAssert(outputStream != nil);
+
+    MAEWriteBlock writeBlock = ^NSInteger(const uint8_t* _Nonnull bytes, NSUInteger length, NSError* _Nullable* _Nullable error) {
+        if (outputStream.streamStatus == NSStreamStatusNotOpen) {
+            [outputStream open];
+        }
+        NSInteger n = [outputStream write:bytes maxLength:length];
+        if (n <= 0 && error) {
+            *error = outputStream.streamError;
+        }
+        return n;
+    };
+
+    if (self = [self initWithMutableData:[NSMutableData dataWithCapacity:MAEDefaultBufferSize]
+                        recordTerminator:recordTerminator]) {
+        self.writeBlock = writeBlock;
+    }
+    return self;
+}
+
+- (instancetype _Nonnull)initWithFileDescriptor:(int)fileDescriptor
+                               recordTerminator:(unichar)recordTerminator
+{
+    NSParameterAssert(fileDescriptor >= 0);
+
+    MAEWriteBlock writeBlock = ^NSInteger(const uint8_t* _Nonnull bytes, NSUInteger length, NSError* _Nullable* _Nullable error) {
+        ssize_t n;
+        do {
+            n = write(fileDescriptor, bytes, length);
+        } while (n < 0 && errno == EINTR);
+
+        if (n < 0 && error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+        }
+        return n;
+    };
+
+    if (self = [self initWithMutableData:[NSMutableData dataWithCapacity:MAEDefaultBufferSize]
+                        recordTerminator:recordTerminator]) {
+        self.writeBlock = writeBlock;
+    }
+    return self;
+}
+
+#pragma mark - Public Methods
+
+- (BOOL)writeModel:(id<MAEArraySerializing> _Nonnull)model
+             error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(model != nil);
+
+    if (self.adapter.modelClass != [model class]) {
+        self.adapter = [MAEArrayAdapter adapterForModelClass:[model class]];
+    }
+
+    if (![self.adapter appendModel:model toData:self.buffer error:error]) {
+        return NO;
+    }
+
+    const uint8_t terminator = (uint8_t)self.recordTerminator;
+    [self.buffer appendBytes:&terminator length:1];
+
+    if (self.writeBlock && self.buffer.length >= self.bufferSize) {
+        return [self flush:error];
+    }
+    return YES;
+}
+
+- (BOOL)writeRecordFromUTF8Bytes:(const char* _Nonnull)bytes
+                          length:(NSUInteger)length
+                           error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(bytes != NULL || length == 0);
+
+    [self.buffer appendBytes:bytes length:length];
+
+    const uint8_t terminator = (uint8_t)self.recordTerminator;
+    [self.buffer appendBytes:&terminator length:1];
+
+    if (self.writeBlock && self.buffer.length >= self.bufferSize) {
+        return [self flush:error];
+    }
+    return YES;
+}
+
+- (BOOL)writeModels:(NSArray<id<MAEArraySerializing> >* _Nonnull)models
+              error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(models != nil);
+
+    for (id<MAEArraySerializing> model in models) {
+        BOOL success;
+        NSError* writeError = nil;
+        @autoreleasepool {
+            success = [self writeModel:model error:&writeError];
+        }
+        if (!success) {
+            if (error) {
+                *error = writeError;
+            }
+            return NO;
+        }
+    }
+    return YES;
+}
+
+- (BOOL)writeModelsConcurrently:(id<NSFastEnumeration> _Nonnull)models
+                         errors:(NSDictionary<NSNumber*, NSError*>* _Nullable* _Nullable)errors
+                          error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(models != nil);
+
+    const NSUInteger maxPendingCount = NSProcessInfo.processInfo.activeProcessorCount * MAEPendingChunksPerProcessor;
+    NSMutableArray<MAEWriterChunk*>* pendingChunks = [NSMutableArray arrayWithCapacity:maxPendingCount];
+    NSMutableDictionary<NSNumber*, NSError*>* modelErrors = nil;
+    MAEWriterChunk* chunk = nil;
+    NSUInteger index = 0;
+    BOOL success = YES;
+
+    for (id<MAEArraySerializing> model in models) {
+        if (!chunk) {
+            chunk = [MAEWriterChunk new];
+            chunk.models = [NSMutableArray arrayWithCapacity:MAEConcurrentChunkSize];
+            chunk.startIndex = index;
+        }
+        [chunk.models addObject:model];
+        index++;
+
+        if (chunk.models.count == MAEConcurrentChunkSize) {
+            [self convertChunk:chunk];
+            [pendingChunks addObject:chunk];
+            chunk = nil;
+
+            // NOTE: Converted chunks are written without waiting, and it waits for the oldest chunk only if there are too many.
+            while (success && pendingChunks.count > 0
+                   && (pendingChunks.count >= maxPendingCount
+                       || dispatch_group_wait(pendingChunks.firstObject.group, DISPATCH_TIME_NOW) == 0)) {
+                success = [self writeChunk:pendingChunks.firstObject errors:&modelErrors error:error];
+                [pendingChunks removeObjectAtIndex:0];
+            }
+            if (!success) {
+                break;
+            }
+        }
+    }
+
+    if (success && chunk) {
+        [self convertChunk:chunk];
+        [pendingChunks addObject:chunk];
+    }
+    for (MAEWriterChunk* pendingChunk in pendingChunks) {
+        if (success) {
+            success = [self writeChunk:pendingChunk errors:&modelErrors error:error];
+        } else {
+            // NOTE: Chunks that are being converted MUST be finished before returning.
+            dispatch_group_wait(pendingChunk.group, DISPATCH_TIME_FOREVER);
+        }
+    }
+
+    if (errors) {
+        *errors = modelErrors;
+    }
+    return success;
+}
+
+- (BOOL)flush:(NSError* _Nullable* _Nullable)error
+{
+    if (!self.writeBlock) {
+        return YES;
+    }
+
+    NSUInteger written = 0;
+    BOOL success = [self writeBytes:self.buffer.bytes length:self.buffer.length written:&written error:error];
+    // NOTE: Bytes that could not be written remain in the buffer.
+    [self.buffer replaceBytesInRange:NSMakeRange(0, written) withBytes:NULL length:0];
+    return success;
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Start converting models of the chunk on a global queue.
+ *
+ * @param chunk  A chunk. Its group is left when the conversion is finished.
+ */
+- (void)convertChunk:(MAEWriterChunk* _Nonnull)chunk
+{
+    chunk.data = [NSMutableData dataWithCapacity:self.bufferSize];
+    chunk.group = dispatch_group_create();
+    const uint8_t terminator = (uint8_t)self.recordTerminator;
+
+    dispatch_group_async(chunk.group, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        @autoreleasepool {
+            MAEArrayAdapter* adapter = nil;
+            NSUInteger i = chunk.startIndex;
+            for (id<MAEArraySerializing> model in chunk.models) {
+                if (adapter.modelClass != [model class]) {
+                    adapter = [MAEArrayAdapter adapterForModelClass:[model class]];
+                }
+
+                NSError* modelError = nil;
+                if ([adapter appendModel:model toData:chunk.data error:&modelError]) {
+                    [chunk.data appendBytes:&terminator length:1];
+                } else {
+                    if (!chunk.errors) {
+                        chunk.errors = [NSMutableDictionary dictionary];
+                    }
+                    chunk.errors[@(i)] = modelError ?: [NSError mae_errorWithMAEErrorCode:MAEErrorUnknown];
+                }
+                i++;
+            }
+        }
+    });
+}
+
+/**
+ * Wait for the conversion of the chunk, and write its records.
+ *
+ * Records are appended to the buffer if they fit in it. Otherwise, the buffer is flushed and records are written directly.
+ *
+ * @param chunk   A chunk that is being converted
+ * @param errors  Errors of models of the chunk are added to it. It is created if it is necessary.
+ * @param error   If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO and bytes that were not written remain in the buffer.
+ */
+- (BOOL)writeChunk:(MAEWriterChunk* _Nonnull)chunk
+            errors:(NSMutableDictionary<NSNumber*, NSError*>* _Nullable* _Nonnull)errors
+             error:(NSError* _Nullable* _Nullable)error
+{
+    dispatch_group_wait(chunk.group, DISPATCH_TIME_FOREVER);
+    if (chunk.errors) {
+        if (!*errors) {
+            *errors = [NSMutableDictionary dictionary];
+        }
+        [*errors addEntriesFromDictionary:chunk.errors];
+    }
+
+    NSData* data = chunk.data;
+    if (!self.writeBlock || self.buffer.length + data.length < self.bufferSize) {
+        [self.buffer appendData:data];
+        return YES;
+    }
+    if (self.buffer.length > 0 && ![self flush:error]) {
+        [self.buffer appendData:data];
+        return NO;
+    }
+
+    NSUInteger written = 0;
+    if (![self writeBytes:data.bytes length:data.length written:&written error:error]) {
+        [self.buffer appendBytes:(const uint8_t*)data.bytes + written length:data.length - written];
+        return NO;
+    }
+    return YES;
+}
+
+/**
+ * Write the bytes to the destination.
+ *
+ * @param bytes    Bytes
+ * @param length   The number of bytes
+ * @param written  The number of bytes that were written is saved here.
+ * @param error    If it return NO, error information is saved here.
+ * @return If all bytes are written, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)writeBytes:(const uint8_t* _Nullable)bytes
+            length:(NSUInteger)length
+           written:(NSUInteger* _Nonnull)written
+             error:(NSError* _Nullable* _Nullable)error
+{
+    *written = 0;
+    while (*written < length) {
+        NSError* writeError = nil;
+        NSInteger n = self.writeBlock(bytes + *written, length - *written, &writeError);
+        if (n <= 0) {
+            if (error) {
+                *error = writeError ?: [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOSPC userInfo:nil];
+            }
+            return NO;
+        }
+        *written += (NSUInteger)n;
+    }
+    return YES;
+}
+
+@end
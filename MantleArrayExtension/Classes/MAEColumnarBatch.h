@@ -0,0 +1,143 @@
+//
+//  MAEColumnarBatch.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Types of values in a column.
+ */
+typedef NS_ENUM(NSUInteger, MAEColumnType) {
+    /// Integer properties that use the default number transformer. Unsigned values are stored as their bit patterns.
+    MAEColumnTypeInt64,
+    /// Floating point properties and NSNumber properties that use the default number transformer.
+    MAEColumnTypeDouble,
+    /// Bool properties that use the default bool transformer.
+    MAEColumnTypeBool,
+    /// Other properties. It holds the characters of fields (MAESeparatedString # characters) as UTF-8.
+    MAEColumnTypeString,
+};
+
+/**
+ * Values of one property in all rows, that are held in contiguous buffers.
+ *
+ * Buffers are valid while the column is alive, and they may be moved when rows are appended to the batch.
+ */
+@interface MAEColumn : NSObject
+
+@property (nonatomic, nonnull, copy, readonly) NSString* propertyKey;
+@property (nonatomic, assign, readonly) MAEColumnType type;
+/// If it is YES, a row has any number of values. (MAEVariadic)
+@property (nonatomic, assign, readonly) BOOL variadic;
+/// The number of rows
+@property (nonatomic, assign, readonly) NSUInteger rowCount;
+/// The number of values. If the column is not variadic, it equals to rowCount.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// Values of MAEColumnTypeInt64. Otherwise, it is NULL.
+@property (nonatomic, nullable, assign, readonly) const int64_t* int64Values;
+/// Values of MAEColumnTypeDouble. Otherwise, it is NULL.
+@property (nonatomic, nullable, assign, readonly) const double* doubleValues;
+/// Values of MAEColumnTypeBool. Otherwise, it is NULL.
+@property (nonatomic, nullable, assign, readonly) const BOOL* boolValues;
+/// count + 1 offsets of MAEColumnTypeString. The value at index is stringBytes[offsets[index], offsets[index + 1]).
+@property (nonatomic, nullable, assign, readonly) const NSUInteger* stringOffsets;
+/// UTF-8 bytes of all values of MAEColumnTypeString. They are not terminated by NUL.
+@property (nonatomic, nullable, assign, readonly) const uint8_t* stringBytes;
+/// rowCount + 1 offsets of a variadic column. Values of the row are [offsets[row], offsets[row + 1]).
+/// If the column is not variadic, it is NULL.
+@property (nonatomic, nullable, assign, readonly) const NSUInteger* valueOffsets;
+/// (rowCount + 7) / 8 bytes. The bit (row % 8) of the byte (row / 8) is 1, if the row has a value.
+/// A row does not have a value, if the field is omitted (MAEOptional) or the record could not be decoded.
+/// Values of such rows are 0 or empty, and a variadic row has no values.
+@property (nonatomic, nonnull, assign, readonly) const uint8_t* validityBitmap;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create a column by copying values from buffers. (e.g. To encode them by MAEArrayAdapter # dataFromColumnarBatch:recordSeparator:error:)
+ *
+ * If valueOffsets is not NULL, the column is variadic and it has valueOffsets[rowCount] values.
+ * Otherwise, it has rowCount values.
+ *
+ * @param propertyKey     A property key
+ * @param type            A type of values
+ * @param rowCount        The number of rows
+ * @param values          Values of the type (int64_t, double or BOOL).
+ *                        If the type is MAEColumnTypeString, it is count + 1 offsets of stringBytes. (stringOffsets)
+ * @param stringBytes     UTF-8 bytes of values of MAEColumnTypeString. Otherwise, it is ignored.
+ * @param valueOffsets    rowCount + 1 offsets of values of a variadic column. valueOffsets[0] MUST be 0.
+ *                        If the column is not variadic, it is NULL.
+ * @param validityBitmap  (rowCount + 7) / 8 bytes. (Please refer to validityBitmap) If it is NULL, all rows are valid.
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                        type:(MAEColumnType)type
+                                    rowCount:(NSUInteger)rowCount
+                                      values:(const void* _Nullable)values
+                                 stringBytes:(const uint8_t* _Nullable)stringBytes
+                                valueOffsets:(const NSUInteger* _Nullable)valueOffsets
+                              validityBitmap:(const uint8_t* _Nullable)validityBitmap;
+
+#pragma mark - Public Methods
+
+/**
+ * Returns whether the row has a value.
+ *
+ * @param row  A row
+ * @return If the row has a value, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)isValidAtRow:(NSUInteger)row;
+
+/**
+ * Returns the value of MAEColumnTypeString as a string.
+ * It creates a string, so please use stringOffsets and stringBytes for scanning.
+ *
+ * @param index  An index of values. If the column is not variadic, it is a row.
+ * @return A string
+ */
+- (NSString* _Nonnull)stringAtIndex:(NSUInteger)index;
+
+@end
+
+/**
+ * Records that are decoded into columns instead of models.
+ *
+ * It has a column for each property in formatByPropertyKey (or projectedKeys of the adapter), in the same order.
+ * Please refer to MAEArrayAdapter # columnarBatchFromData:recordSeparator:errors:
+ */
+@interface MAEColumnarBatch : NSObject
+
+@property (nonatomic, nonnull, strong, readonly) Class modelClass;
+/// The number of rows. It includes invalid rows, but it does not include rejected records.
+@property (nonatomic, assign, readonly) NSUInteger rowCount;
+/// The number of records that are rejected by filters of the adapter. They are not appended as rows.
+@property (nonatomic, assign, readonly) NSUInteger rejectedCount;
+@property (nonatomic, nonnull, copy, readonly) NSArray<MAEColumn*>* columns;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance.
+ *
+ * @param modelClass  MAEArraySerializing model class
+ * @param columns     Columns. They MUST have the same number of rows, and their property keys MUST be unique.
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass columns:(NSArray<MAEColumn*>* _Nonnull)columns;
+
+#pragma mark - Public Methods
+
+/**
+ * Returns the column of the property.
+ *
+ * @param propertyKey  A property key
+ * @return If the property is not in the format, it returns nil. Otherwise, it returns a column.
+ */
+- (MAEColumn* _Nullable)columnForPropertyKey:(NSString* _Nonnull)propertyKey;
+
+@end
@@ -0,0 +1,448 @@
+//
+//  MAEColumnarBatch.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEColumnarBatch+Private.h"
+
+static NSUInteger const MAEColumnBufferMinimumCapacity = 64;
+
+/**
+ * A growable buffer of bytes.
+ */
+typedef struct MAEColumnBuffer {
+    uint8_t* _Nullable bytes;
+    NSUInteger length;
+    NSUInteger capacity;
+} MAEColumnBuffer;
+
+#pragma mark - Functions
+
+/**
+ * Make sure that the buffer can hold additional bytes without reallocation.
+ *
+ * @param buffer      A buffer
+ * @param additional  The number of bytes to be appended
+ */
+static inline void MAEColumnBufferReserve(MAEColumnBuffer* _Nonnull buffer, NSUInteger additional)
+{
+    if (buffer->length + additional > buffer->capacity) {
+        NSUInteger capacity = MAX(MAX(buffer->capacity * 2, buffer->length + additional), MAEColumnBufferMinimumCapacity);
+        uint8_t* bytes = realloc(buffer->bytes, capacity);
+        if (!bytes) {
+            // NOTE: The buffer still owns the old bytes, so they are released with the column.
+            [NSException raise:NSMallocException format:@"Could not allocate %lu bytes", (unsigned long)capacity];
+        }
+        buffer->bytes = bytes;
+        buffer->capacity = capacity;
+    }
+}
+
+/**
+ * Append bytes to the buffer.
+ *
+ * @param buffer  A buffer
+ * @param bytes   Bytes
+ * @param length  The number of bytes
+ */
+static inline void MAEColumnBufferAppend(MAEColumnBuffer* _Nonnull buffer, const void* _Nullable bytes, NSUInteger length)
+{
+    if (length == 0) {
+        return;
+    }
+    MAEColumnBufferReserve(buffer, length);
+    memcpy(buffer->bytes + buffer->length, bytes, length);
+    buffer->length += length;
+}
+
+@interface MAEColumn ()
+@property (nonatomic, nonnull, copy, readwrite) NSString* propertyKey;
+@property (nonatomic, assign, readwrite) MAEColumnType type;
+@property (nonatomic, assign, readwrite) BOOL variadic;
+@property (nonatomic, assign, readwrite) NSUInteger rowCount;
+@property (nonatomic, assign, readwrite) NSUInteger count;
+
+- (void)finishRow;
+- (void)discardRow;
+@end
+
+@implementation MAEColumn {
+    BOOL _floatPrecision;
+    /// Values, or offsets of strings for MAEColumnTypeString.
+    MAEColumnBuffer _values;
+    MAEColumnBuffer _stringBytes;
+    MAEColumnBuffer _valueOffsets;
+    MAEColumnBuffer _validity;
+    /// The number of values before the current row.
+    NSUInteger _finishedCount;
+    /// The length of stringBytes before the current row.
+    NSUInteger _finishedStringLength;
+    /// Whether the current row has a value.
+    BOOL _present;
+}
+
+@synthesize floatPrecision = _floatPrecision;
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                        type:(MAEColumnType)type
+                                    variadic:(BOOL)variadic
+{
+    NSParameterAssert(propertyKey != nil);
+
+    if (self = [super init]) {
+        self.propertyKey = propertyKey;
+        self.type = type;
+        self.variadic = variadic;
+
+        const NSUInteger zero = 0;
+        if (type == MAEColumnTypeString) {
+            MAEColumnBufferAppend(&_values, &zero, sizeof(NSUInteger));
+        }
+        if (variadic) {
+            MAEColumnBufferAppend(&_valueOffsets, &zero, sizeof(NSUInteger));
+        }
+        MAEColumnBufferReserve(&_validity, 1);
+    }
+    return self;
+}
+
+- (instancetype _Nonnull)initWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                        type:(MAEColumnType)type
+                                    rowCount:(NSUInteger)rowCount
+                                      values:(const void* _Nullable)values
+                                 stringBytes:(const uint8_t* _Nullable)stringBytes
+                                valueOffsets:(const NSUInteger* _Nullable)valueOffsets
+                              validityBitmap:(const uint8_t* _Nullable)validityBitmap
+{
+    NSParameterAssert(valueOffsets == NULL || valueOffsets[0] == 0);
+
+    if (self = [self initWithPropertyKey:propertyKey type:type variadic:valueOffsets != NULL]) {
+        const NSUInteger count = valueOffsets ? valueOffsets[rowCount] : rowCount;
+        NSParameterAssert(values != NULL || (count == 0 && type != MAEColumnTypeString));
+
+        switch (type) {
+            case MAEColumnTypeInt64:
+                MAEColumnBufferAppend(&_values, values, count * sizeof(int64_t));
+                break;
+            case MAEColumnTypeDouble:
+                MAEColumnBufferAppend(&_values, values, count * sizeof(double));
+                break;
+            case MAEColumnTypeBool:
+                MAEColumnBufferAppend(&_values, values, count * sizeof(BOOL));
+                break;
+            case MAEColumnTypeString: {
+                // NOTE: Offsets are rebased, so that only the bytes of the values are copied.
+                const NSUInteger* offsets = values;
+                NSParameterAssert(stringBytes != NULL || offsets[count] == offsets[0]);
+                MAEColumnBufferReserve(&_values, count * sizeof(NSUInteger));
+                NSUInteger* rebasedOffsets = (NSUInteger*)_values.bytes;
+                for (NSUInteger i = 0; i <= count; i++) {
+                    rebasedOffsets[i] = offsets[i] - offsets[0];
+                }
+                _values.length = (count + 1) * sizeof(NSUInteger);
+                MAEColumnBufferAppend(&_stringBytes, stringBytes + offsets[0], offsets[count] - offsets[0]);
+                break;
+            }
+        }
+
+        if (valueOffsets) {
+            _valueOffsets.length = 0;
+            MAEColumnBufferAppend(&_valueOffsets, valueOffsets, (rowCount + 1) * sizeof(NSUInteger));
+        }
+
+        const NSUInteger validityLength = (rowCount + 7) / 8;
+        MAEColumnBufferReserve(&_validity, validityLength);
+        if (validityBitmap) {
+            memcpy(_validity.bytes, validityBitmap, validityLength);
+        } else {
+            memset(_validity.bytes, 0xFF, validityLength);
+        }
+        _validity.length = validityLength;
+        if (rowCount % 8 != 0) {
+            // NOTE: Bits after the last row MUST be 0, because rows appended later only set their bits.
+            _validity.bytes[validityLength - 1] &= (uint8_t)((1 << (rowCount % 8)) - 1);
+        }
+
+        self.rowCount = rowCount;
+        self.count = count;
+        _finishedCount = count;
+        _finishedStringLength = _stringBytes.length;
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_values.bytes);
+    free(_stringBytes.bytes);
+    free(_valueOffsets.bytes);
+    free(_validity.bytes);
+}
+
+#pragma mark - Custom Accessor
+
+- (const int64_t* _Nullable)int64Values
+{
+    return self.type == MAEColumnTypeInt64 ? (const int64_t*)_values.bytes : NULL;
+}
+
+- (const double* _Nullable)doubleValues
+{
+    return self.type == MAEColumnTypeDouble ? (const double*)_values.bytes : NULL;
+}
+
+- (const BOOL* _Nullable)boolValues
+{
+    return self.type == MAEColumnTypeBool ? (const BOOL*)_values.bytes : NULL;
+}
+
+- (const NSUInteger* _Nullable)stringOffsets
+{
+    return self.type == MAEColumnTypeString ? (const NSUInteger*)_values.bytes : NULL;
+}
+
+- (const uint8_t* _Nullable)stringBytes
+{
+    return self.type == MAEColumnTypeString ? _stringBytes.bytes : NULL;
+}
+
+- (const NSUInteger* _Nullable)valueOffsets
+{
+    return self.variadic ? (const NSUInteger*)_valueOffsets.bytes : NULL;
+}
+
+- (const uint8_t* _Nonnull)validityBitmap
+{
+    return _validity.bytes;
+}
+
+#pragma mark - Public Methods
+
+- (BOOL)isValidAtRow:(NSUInteger)row
+{
+    NSParameterAssert(row < self.rowCount);
+    return (_validity.bytes[row / 8] >> (row % 8)) & 1;
+}
+
+- (NSString* _Nonnull)stringAtIndex:(NSUInteger)index
+{
+    NSAssert(self.type == MAEColumnTypeString, @"%@ is not a string column", self.propertyKey);
+    NSParameterAssert(index < self.count);
+
+    const NSUInteger* offsets = self.stringOffsets;
+    return [[NSString alloc] initWithBytes:_stringBytes.bytes + offsets[index]
+                                    length:offsets[index + 1] - offsets[index]
+                                  encoding:NSUTF8StringEncoding]
+        ?: @"";
+}
+
+- (void)markPresent
+{
+    _present = YES;
+}
+
+- (void)appendInt64:(int64_t)value
+{
+    NSAssert(self.type == MAEColumnTypeInt64, @"%@ is not an int64 column", self.propertyKey);
+    MAEColumnBufferAppend(&_values, &value, sizeof(value));
+    self.count++;
+    _present = YES;
+}
+
+- (void)appendDouble:(double)value
+{
+    NSAssert(self.type == MAEColumnTypeDouble, @"%@ is not a double column", self.propertyKey);
+    MAEColumnBufferAppend(&_values, &value, sizeof(value));
+    self.count++;
+    _present = YES;
+}
+
+- (void)appendBool:(BOOL)value
+{
+    NSAssert(self.type == MAEColumnTypeBool, @"%@ is not a bool column", self.propertyKey);
+    MAEColumnBufferAppend(&_values, &value, sizeof(value));
+    self.count++;
+    _present = YES;
+}
+
+- (void)appendUTF8Bytes:(const uint8_t* _Nullable)bytes length:(NSUInteger)length
+{
+    NSAssert(self.type == MAEColumnTypeString, @"%@ is not a string column", self.propertyKey);
+    NSParameterAssert(bytes != NULL || length == 0);
+
+    MAEColumnBufferAppend(&_stringBytes, bytes, length);
+    const NSUInteger offset = _stringBytes.length;
+    MAEColumnBufferAppend(&_values, &offset, sizeof(offset));
+    self.count++;
+    _present = YES;
+}
+
+- (void)appendString:(NSString* _Nonnull)string
+{
+    NSParameterAssert(string != nil);
+
+    if (string.length > 0) {
+        NSUInteger maxLength = [string maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+        NSUInteger usedLength = 0;
+        MAEColumnBufferReserve(&_stringBytes, maxLength);
+        [string getBytes:_stringBytes.bytes + _stringBytes.length
+                 maxLength:maxLength
+                usedLength:&usedLength
+                  encoding:NSUTF8StringEncoding
+                   options:NSStringEncodingConversionAllowLossy
+                     range:NSMakeRange(0, string.length)
+            remainingRange:NULL];
+        _stringBytes.length += usedLength;
+    }
+    // NOTE: The bytes have been written, so it only appends the offset.
+    [self appendUTF8Bytes:NULL length:0];
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Finish the current row.
+ * If the row does not have a value, it is marked as invalid and a value of 0 (or empty) is appended.
+ */
+- (void)finishRow
+{
+    if (!_present && !self.variadic) {
+        switch (self.type) {
+            case MAEColumnTypeInt64:
+                [self appendInt64:0];
+                break;
+            case MAEColumnTypeDouble:
+                [self appendDouble:0];
+                break;
+            case MAEColumnTypeBool:
+                [self appendBool:NO];
+                break;
+            case MAEColumnTypeString:
+                [self appendUTF8Bytes:NULL length:0];
+                break;
+        }
+        _present = NO;
+    }
+
+    if (self.variadic) {
+        const NSUInteger count = self.count;
+        MAEColumnBufferAppend(&_valueOffsets, &count, sizeof(count));
+    }
+
+    const NSUInteger row = self.rowCount;
+    if (row % 8 == 0) {
+        const uint8_t zero = 0;
+        MAEColumnBufferAppend(&_validity, &zero, 1);
+    }
+    if (_present) {
+        _validity.bytes[row / 8] |= (uint8_t)(1 << (row % 8));
+    }
+
+    self.rowCount = row + 1;
+    _finishedCount = self.count;
+    _finishedStringLength = _stringBytes.length;
+    _present = NO;
+}
+
+/**
+ * Discard values that are appended to the current row.
+ */
+- (void)discardRow
+{
+    const NSUInteger valueSize = self.type == MAEColumnTypeInt64 ? sizeof(int64_t)
+        : self.type == MAEColumnTypeDouble                       ? sizeof(double)
+        : self.type == MAEColumnTypeBool                         ? sizeof(BOOL)
+                                                                 : sizeof(NSUInteger);
+    // NOTE: A string column has one more offset than values.
+    _values.length = (_finishedCount + (self.type == MAEColumnTypeString ? 1 : 0)) * valueSize;
+    _stringBytes.length = _finishedStringLength;
+    self.count = _finishedCount;
+    _present = NO;
+}
+
+@end
+
+@interface MAEColumnarBatch ()
+@property (nonatomic, nonnull, strong, readwrite) Class modelClass;
+@property (nonatomic, assign, readwrite) NSUInteger rowCount;
+@property (nonatomic, assign, readwrite) NSUInteger rejectedCount;
+@property (nonatomic, nonnull, copy, readwrite) NSArray<MAEColumn*>* columns;
+@property (nonatomic, nonnull, copy) NSDictionary<NSString*, MAEColumn*>* columnsByPropertyKey;
+@end
+
+@implementation MAEColumnarBatch
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass columns:(NSArray<MAEColumn*>* _Nonnull)columns
+{
+    NSParameterAssert(modelClass != nil && columns != nil);
+
+    if (self = [super init]) {
+        self.modelClass = modelClass;
+        self.columns = columns;
+        self.rowCount = columns.firstObject.rowCount;
+
+        NSMutableDictionary<NSString*, MAEColumn*>* columnsByPropertyKey =
+            [NSMutableDictionary dictionaryWithCapacity:columns.count];
+        for (MAEColumn* column in columns) {
+            NSAssert(column.rowCount == self.rowCount, @"All columns MUST have the same number of rows");
+            NSAssert(!columnsByPropertyKey[column.propertyKey], @"%@ has multiple columns", column.propertyKey);
+            columnsByPropertyKey[column.propertyKey] = column;
+        }
+        self.columnsByPropertyKey = columnsByPropertyKey;
+    }
+    return self;
+}
+
+#pragma mark - Public Methods
+
+- (MAEColumn* _Nullable)columnForPropertyKey:(NSString* _Nonnull)propertyKey
+{
+    NSParameterAssert(propertyKey != nil);
+    return self.columnsByPropertyKey[propertyKey];
+}
+
+- (void)finishRow
+{
+    for (MAEColumn* column in self.columns) {
+        [column finishRow];
+    }
+    self.rowCount++;
+}
+
+- (void)finishInvalidRow
+{
+    for (MAEColumn* column in self.columns) {
+        [column discardRow];
+        [column finishRow];
+    }
+    self.rowCount++;
+}
+
+- (void)rejectRow
+{
+    for (MAEColumn* column in self.columns) {
+        [column discardRow];
+    }
+    self.rejectedCount++;
+}
+
+@end
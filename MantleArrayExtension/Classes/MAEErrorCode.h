@@ -20,9 +20,25 @@ typedef NS_ENUM(NSUInteger, MAEErrorCode) {
     MAEErrorNotMatchFragmentCount,
     /// classForParsingArray: returns nil.
     MAEErrorNoConversionTarget,
+    /// The record was rejected by filters of the adapter.
+    MAEErrorRejectedByFilter,
 };
 
 /// The domain for errors originating from MantleArrayExtension
 extern NSString* const MAEErrorDomain;
 /// A key that stores the input data that caused the error
 extern NSString* const MAEErrorInputDataKey;
+
+/**
+ * A compact record of a conversion failure. It is returned by try-parse methods, instead of creating NSError.
+ *
+ * Please refer to MAEArrayAdapter # modelFromString:failure:
+ */
+typedef struct MAEFailure {
+    /// The error code. If the error is not in MAEErrorDomain (e.g. transformers and MTLModel # validate:), it is MAEErrorUnknown.
+    MAEErrorCode code;
+    /// The index of the fragment in formatByPropertyKey. If the failure is not caused by a fragment, it is NSNotFound.
+    NSUInteger fragmentIndex;
+    /// The range of the field(s) in the record. If the failure is not caused by a field, the location is NSNotFound.
+    NSRange range;
+} MAEFailure;
@@ -0,0 +1,42 @@
+//
+//  MAEField.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAESeparatedString.h"
+#import <Foundation/Foundation.h>
+
+/**
+ * A descriptor of one of characters separated by separator.
+ * It only has ranges in the source, so it does not hold any object.
+ *
+ * @see MAETokenizer
+ */
+typedef struct MAEField {
+    /// The range of originalCharacters. (Please refer to MAESeparatedString # originalCharacters)
+    NSRange range;
+    /// The range of characters before unescaping. (Please refer to MAESeparatedString # characters)
+    NSRange contentRange;
+    /// The type of string.
+    MAEStringType type;
+    /// If it is YES, characters contains escaped quotes. Otherwise, characters equals to the content.
+    BOOL needsUnescape;
+} MAEField;
+
+@interface MAESeparatedString (MAEField)
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance from a field.
+ *
+ * @param field   A field
+ * @param string  The string that the field was created from
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithField:(MAEField)field inString:(NSString* _Nonnull)string;
+
+@end
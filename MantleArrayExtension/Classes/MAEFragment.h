@@ -6,6 +6,7 @@
 //  Copyright © 2017年 Hinagiku Soranoba. All rights reserved.
 //
 
+#import "MAEField.h"
 #import "MAESeparatedString.h"
 #import <Foundation/Foundation.h>
 
@@ -103,6 +104,20 @@ id<MAEFragment> _Nonnull MAEVariadic(id _Nonnull);
 
 @optional
 
+/**
+ * Returns whether the field is in correct format.
+ * If it is implemented, MAEArrayAdapter calls it instead of validateWithSeparatedString:error:,
+ * so it does not need to create a separatedString.
+ *
+ * @param field   A corresponding field
+ * @param string  The string that the field was created from
+ * @param error   If it return nil, an error information is saved here.
+ * @return Returns YES, if the field is correct. Otherwise, it returns NO.
+ */
+- (BOOL)validateWithField:(MAEField)field
+                 inString:(NSString* _Nonnull)string
+                    error:(NSError* _Nullable* _Nullable)error;
+
 /**
  * You should implements, if you want to be supported by `MAEOptional`.
  *
@@ -138,4 +153,16 @@ id<MAEFragment> _Nonnull MAEVariadic(id _Nonnull);
  */
 - (instancetype _Nonnull)initWithPropertyName:(NSString* _Nonnull)propertyName;
 
+#pragma mark - Public Methods
+
+/**
+ * Returns whether the type of string is allowed in the fragment.
+ * It is the same validation as validateWithField:inString:error:, but it does not need the string.
+ *
+ * @param type   A type of string
+ * @param error  If it return nil, an error information is saved here.
+ * @return Returns YES, if the type is allowed. Otherwise, it returns NO.
+ */
+- (BOOL)validateWithStringType:(MAEStringType)type error:(NSError* _Nullable* _Nullable)error;
+
 @end
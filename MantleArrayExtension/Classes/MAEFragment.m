@@ -96,34 +96,14 @@ extern id<MAEFragment> _Nonnull MAEVariadic(id _Nonnull v)
                               error:(NSError* _Nullable* _Nullable)error
 {
     NSParameterAssert(separatedString != nil);
+    return [self validateWithStringType:separatedString.type error:error];
+}
 
-    NSString* expectedType = nil;
-    switch (self.type) {
-        case MAEFragmentDoubleQuotedString:
-            if (separatedString.type != MAEStringTypeDoubleQuoted) {
-                expectedType = @"double quoted string";
-            }
-            break;
-        case MAEFragmentSingleQuotedString:
-            if (separatedString.type != MAEStringTypeSingleQuoted) {
-                expectedType = @"single quoted string";
-            }
-            break;
-        case MAEFragmentEnumerateString:
-            if (separatedString.type != MAEStringTypeEnumerate) {
-                expectedType = @"enumerate string";
-            }
-            break;
-        default:
-            break;
-    }
-    if (expectedType) {
-        SET_ERROR(error, MAEErrorNotMatchFragmentType,
-                  @{ NSLocalizedFailureReasonErrorKey :
-                         format(@"%@ expected %@", self.propertyName, expectedType) });
-        return NO;
-    }
-    return YES;
+- (BOOL)validateWithField:(MAEField)field
+                 inString:(NSString* _Nonnull)string
+                    error:(NSError* _Nullable* _Nullable)error
+{
+    return [self validateWithStringType:field.type error:error];
 }
 
 - (MAESeparatedString* _Nullable)separatedStringFromTransformedValue:(NSString* _Nullable)transformedValue
@@ -153,6 +133,39 @@ extern id<MAEFragment> _Nonnull MAEVariadic(id _Nonnull v)
     return [[MAESeparatedString alloc] initWithCharacters:transformedValue type:type];
 }
 
+#pragma mark - Public Methods
+
+- (BOOL)validateWithStringType:(MAEStringType)type error:(NSError* _Nullable* _Nullable)error
+{
+    NSString* expectedType = nil;
+    switch (self.type) {
+        case MAEFragmentDoubleQuotedString:
+            if (type != MAEStringTypeDoubleQuoted) {
+                expectedType = @"double quoted string";
+            }
+            break;
+        case MAEFragmentSingleQuotedString:
+            if (type != MAEStringTypeSingleQuoted) {
+                expectedType = @"single quoted string";
+            }
+            break;
+        case MAEFragmentEnumerateString:
+            if (type != MAEStringTypeEnumerate) {
+                expectedType = @"enumerate string";
+            }
+            break;
+        default:
+            break;
+    }
+    if (expectedType) {
+        SET_ERROR(error, MAEErrorNotMatchFragmentType,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"%@ expected %@", self.propertyName, expectedType) });
+        return NO;
+    }
+    return YES;
+}
+
 #pragma mark - NSCopying
 
 - (id)copyWithZone:(NSZone* _Nullable)zone
@@ -0,0 +1,64 @@
+//
+//  MAEModelPool.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@protocol MAEArraySerializing;
+
+/**
+ * A pool of models that consumers hand back after using them, in order to reuse them in conversion.
+ *
+ * Adapters take models from the pool only if they set properties without MTLModel # initWithDictionary:error:.
+ * Properties that are in formatByPropertyKey are overwritten, and absent ones are reset to their defaults.
+ * A recycled model MUST NOT be used by the consumer anymore.
+ * It is thread-safe.
+ *
+ * Please refer to MAEArrayAdapter # adapterWithModelPool:
+ */
+@interface MAEModelPool : NSObject
+
+/// The maximum number of models that the pool holds for each class. Models over it are released.
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+/// The number of models that the pool holds
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance.
+ *
+ * @param capacity  The maximum number of models that the pool holds for each class
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithCapacity:(NSUInteger)capacity;
+
+#pragma mark - Public Methods
+
+/**
+ * Hand back the model to the pool.
+ *
+ * @param model  A model that is no longer used
+ */
+- (void)recycleModel:(id<MAEArraySerializing> _Nonnull)model;
+
+/**
+ * Hand back the models to the pool.
+ *
+ * @param models  Models that are no longer used. NSNull in it is ignored. (e.g. results of batch conversion)
+ */
+- (void)recycleModels:(NSArray* _Nonnull)models;
+
+/**
+ * Take a model of the class out of the pool.
+ *
+ * @param modelClass  A model class
+ * @return If there are no models of the class, it returns nil. Otherwise, it returns a recycled model.
+ */
+- (id<MAEArraySerializing> _Nullable)dequeueModelOfClass:(Class _Nonnull)modelClass;
+
+@end
@@ -0,0 +1,108 @@
+//
+//  MAEModelPool.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEModelPool.h"
+#import "NSError+MAEErrorCode.h"
+#import <pthread.h>
+
+@implementation MAEModelPool {
+    /// Recycled models for each class (Class -> NSMutableArray)
+    NSMutableDictionary* _modelsByClass;
+    NSUInteger _count;
+    pthread_mutex_t _lock;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithCapacity:(NSUInteger)capacity
+{
+    NSParameterAssert(capacity > 0);
+
+    if (self = [super init]) {
+        _capacity = capacity;
+        _modelsByClass = [NSMutableDictionary dictionary];
+        pthread_mutex_init(&_lock, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark - Custom Accessor
+
+- (NSUInteger)count
+{
+    pthread_mutex_lock(&_lock);
+    NSUInteger count = _count;
+    pthread_mutex_unlock(&_lock);
+    return count;
+}
+
+#pragma mark - Public Methods
+
+- (void)recycleModel:(id<MAEArraySerializing> _Nonnull)model
+{
+    NSParameterAssert(model != nil);
+    [self recycleModels:@[ model ]];
+}
+
+- (void)recycleModels:(NSArray* _Nonnull)models
+{
+    NSParameterAssert(models != nil);
+
+    pthread_mutex_lock(&_lock);
+    for (id model in models) {
+        if (model == NSNull.null) {
+            continue;
+        }
+        id<NSCopying> key = (id<NSCopying>)[model class];
+        NSMutableArray* recycledModels = _modelsByClass[key];
+        if (!recycledModels) {
+            recycledModels = [NSMutableArray arrayWithCapacity:self.capacity];
+            _modelsByClass[key] = recycledModels;
+        }
+        if (recycledModels.count < self.capacity) {
+            [recycledModels addObject:model];
+            _count++;
+        }
+    }
+    pthread_mutex_unlock(&_lock);
+}
+
+- (id<MAEArraySerializing> _Nullable)dequeueModelOfClass:(Class _Nonnull)modelClass
+{
+    NSParameterAssert(modelClass != nil);
+
+    pthread_mutex_lock(&_lock);
+    NSMutableArray* recycledModels = _modelsByClass[(id<NSCopying>)modelClass];
+    id model = recycledModels.lastObject;
+    if (model) {
+        [recycledModels removeLastObject];
+        _count--;
+    }
+    pthread_mutex_unlock(&_lock);
+    return model;
+}
+
+#pragma mark - NSObject (Override)
+
+- (NSString* _Nonnull)description
+{
+    return format(@"<%@: %p> count=%tu, capacity=%tu", self.class, self, self.count, self.capacity);
+}
+
+@end
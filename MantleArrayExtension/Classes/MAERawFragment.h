@@ -59,4 +59,24 @@ MAERawFragment* _Nonnull MAERawEither(NSArray<NSString*>* _Nonnull);
  */
 - (MAERawFragment* _Nonnull (^_Nonnull)(NSString* _Nullable propertyName))withProperty;
 
+/**
+ * Returns whether original characters of the field equal to one of the candidates.
+ * It does not create any object.
+ *
+ * @param field   A field
+ * @param string  The string that the field was created from
+ * @return If it is a candidate, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)isCandidateField:(MAEField)field inString:(NSString* _Nonnull)string;
+
+/**
+ * Returns whether UTF-8 bytes equal to one of the candidates.
+ * It compares lengths first, and then bytes, so it does not create any object.
+ *
+ * @param bytes   UTF-8 bytes of original characters (It includes quotes)
+ * @param length  The number of bytes
+ * @return If it is a candidate, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)isCandidateUTF8Bytes:(const uint8_t* _Nullable)bytes length:(NSUInteger)length;
+
 @end
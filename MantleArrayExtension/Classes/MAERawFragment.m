@@ -24,6 +24,10 @@ extern MAERawFragment* _Nonnull MAERawEither(NSArray<NSString*>* _Nonnull candid
 @property (nonatomic, assign, readwrite, getter=isOptional) BOOL optional;
 @property (nonatomic, assign, readwrite, getter=isVariadic) BOOL variadic;
 @property (nonatomic, nonnull, copy, readwrite) NSArray<NSString*>* candidates;
+/// A hashed set of candidates
+@property (nonatomic, nonnull, copy) NSSet<NSString*>* candidateSet;
+/// UTF-8 bytes of candidates, in the same order as candidates
+@property (nonatomic, nonnull, copy) NSArray<NSData*>* utf8Candidates;
 @end
 
 @implementation MAERawFragment
@@ -43,6 +47,13 @@ extern MAERawFragment* _Nonnull MAERawEither(NSArray<NSString*>* _Nonnull candid
 
     if (self = [super init]) {
         self.candidates = candidates;
+        self.candidateSet = [NSSet setWithArray:candidates];
+
+        NSMutableArray<NSData*>* utf8Candidates = [NSMutableArray arrayWithCapacity:candidates.count];
+        for (NSString* candidate in candidates) {
+            [utf8Candidates addObject:[candidate dataUsingEncoding:NSUTF8StringEncoding]];
+        }
+        self.utf8Candidates = utf8Candidates;
     }
     return self;
 }
@@ -57,6 +68,31 @@ extern MAERawFragment* _Nonnull MAERawEither(NSArray<NSString*>* _Nonnull candid
     };
 }
 
+- (BOOL)isCandidateField:(MAEField)field inString:(NSString* _Nonnull)string
+{
+    NSParameterAssert(string != nil);
+
+    for (NSString* candidate in self.candidates) {
+        if (candidate.length == field.range.length
+            && [string compare:candidate options:NSLiteralSearch range:field.range] == NSOrderedSame) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+- (BOOL)isCandidateUTF8Bytes:(const uint8_t* _Nullable)bytes length:(NSUInteger)length
+{
+    NSParameterAssert(bytes != NULL || length == 0);
+
+    for (NSData* candidate in self.utf8Candidates) {
+        if (candidate.length == length && (length == 0 || memcmp(candidate.bytes, bytes, length) == 0)) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
 #pragma mark - MAEFragment
 
 - (MAESeparatedString* _Nullable)separatedStringFromTransformedValue:(NSString* _Nullable)transformedValue
@@ -64,7 +100,7 @@ extern MAERawFragment* _Nonnull MAERawEither(NSArray<NSString*>* _Nonnull candid
 {
     if (transformedValue == nil) {
         return [[MAESeparatedString alloc] initWithOriginalCharacters:self.candidates.firstObject ignoreEdgeBlank:NO];
-    } else if ([self.candidates containsObject:transformedValue]) {
+    } else if ([self.candidateSet containsObject:transformedValue]) {
         return [[MAESeparatedString alloc] initWithOriginalCharacters:transformedValue ignoreEdgeBlank:NO];
     } else {
         SET_ERROR(error, MAEErrorInvalidInputData,
@@ -77,7 +113,7 @@ extern MAERawFragment* _Nonnull MAERawEither(NSArray<NSString*>* _Nonnull candid
 - (BOOL)validateWithSeparatedString:(MAESeparatedString* _Nonnull)separatedString
                               error:(NSError* _Nullable* _Nullable)error
 {
-    if (![self.candidates containsObject:separatedString.originalCharacters]) {
+    if (![self.candidateSet containsObject:separatedString.originalCharacters]) {
         SET_ERROR(error, MAEErrorInvalidInputData,
                   @{ NSLocalizedFailureReasonErrorKey :
                          format(@"expected one of (%@), but got %@", [self.candidates componentsJoinedByString:@", "], separatedString.originalCharacters) });
@@ -86,6 +122,22 @@ extern MAERawFragment* _Nonnull MAERawEither(NSArray<NSString*>* _Nonnull candid
     return YES;
 }
 
+- (BOOL)validateWithField:(MAEField)field
+                 inString:(NSString* _Nonnull)string
+                    error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(string != nil);
+
+    if ([self isCandidateField:field inString:string]) {
+        return YES;
+    }
+    SET_ERROR(error, MAEErrorInvalidInputData,
+              @{ NSLocalizedFailureReasonErrorKey :
+                     format(@"expected one of (%@), but got %@", [self.candidates componentsJoinedByString:@", "],
+                            [string substringWithRange:field.range]) });
+    return NO;
+}
+
 #pragma mark - NSCopying
 
 - (id)copyWithZone:(NSZone* _Nullable)zone
@@ -0,0 +1,75 @@
+//
+//  MAERecordFilter.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * A predicate on the characters of a field, that is tested right after separating a record.
+ *
+ * Characters are the same as MAESeparatedString # characters. (Quotes and edge blanks are removed)
+ * Rejected records are not validated nor transformed, and models are not created.
+ * Please refer to MAEArrayAdapter # adapterWithFilters:
+ */
+@interface MAERecordFilter : NSObject
+
+/// A property key of the fragment that the filter tests
+@property (nonatomic, nonnull, copy, readonly) NSString* propertyKey;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create a filter that accepts records whose field equals to the characters.
+ *
+ * @param propertyKey  A property key. The fragment MUST NOT be variadic.
+ * @param characters   Characters
+ * @return An instance
+ */
++ (instancetype _Nonnull)filterWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                     isEqualTo:(NSString* _Nonnull)characters;
+
+/**
+ * Create a filter that accepts records whose field equals to any of the characters.
+ *
+ * @param propertyKey  A property key. The fragment MUST NOT be variadic.
+ * @param characters   A set of characters
+ * @return An instance
+ */
++ (instancetype _Nonnull)filterWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                          isIn:(NSSet<NSString*>* _Nonnull)characters;
+
+/**
+ * Create a filter that accepts records whose field passes the test.
+ *
+ * @param propertyKey  A property key. The fragment MUST NOT be variadic.
+ * @param test         A block that returns YES, if the record is accepted. It may be called on any thread.
+ * @return An instance
+ */
++ (instancetype _Nonnull)filterWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                   passingTest:(BOOL (^_Nonnull)(NSString* _Nonnull characters))test;
+
+#pragma mark - Public Methods
+
+/**
+ * Returns whether the filter accepts the characters.
+ *
+ * @param characters  Characters of a field
+ * @return If it accepts, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)acceptsCharacters:(NSString* _Nonnull)characters;
+
+/**
+ * Returns whether the filter accepts the characters of UTF-8 bytes.
+ * It does not create any object, unless the filter has a block.
+ *
+ * @param bytes   UTF-8 bytes of characters
+ * @param length  The number of bytes
+ * @return If it accepts, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)acceptsUTF8Bytes:(const uint8_t* _Nullable)bytes length:(NSUInteger)length;
+
+@end
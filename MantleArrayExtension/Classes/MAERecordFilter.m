@@ -0,0 +1,125 @@
+//
+//  MAERecordFilter.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAERecordFilter.h"
+
+/// The maximum number of characters that are compared with bytes one by one. Larger sets are looked up by hash.
+static NSUInteger const MAERecordFilterLinearSearchLimit = 8;
+
+@interface MAERecordFilter ()
+@property (nonatomic, nonnull, copy, readwrite) NSString* propertyKey;
+/// Accepted characters. It is nil, if the filter has a test block.
+@property (nonatomic, nullable, copy) NSSet<NSString*>* characters;
+/// UTF-8 bytes of characters. It is nil, if there are more than MAERecordFilterLinearSearchLimit characters.
+@property (nonatomic, nullable, copy) NSArray<NSData*>* utf8Characters;
+@property (nonatomic, nullable, copy) BOOL (^test)(NSString* _Nonnull characters);
+@end
+
+@implementation MAERecordFilter
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                  characters:(NSSet<NSString*>* _Nullable)characters
+                                        test:(BOOL (^_Nullable)(NSString* _Nonnull characters))test
+{
+    NSParameterAssert(propertyKey != nil);
+    NSParameterAssert((characters != nil) != (test != nil));
+
+    if (self = [super init]) {
+        self.propertyKey = propertyKey;
+        self.characters = characters;
+        self.test = test;
+
+        if (characters && characters.count <= MAERecordFilterLinearSearchLimit) {
+            NSMutableArray<NSData*>* utf8Characters = [NSMutableArray arrayWithCapacity:characters.count];
+            for (NSString* s in characters) {
+                [utf8Characters addObject:[s dataUsingEncoding:NSUTF8StringEncoding]];
+            }
+            self.utf8Characters = utf8Characters;
+        }
+    }
+    return self;
+}
+
++ (instancetype _Nonnull)filterWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                     isEqualTo:(NSString* _Nonnull)characters
+{
+    NSParameterAssert(characters != nil);
+    return [[self alloc] initWithPropertyKey:propertyKey characters:[NSSet setWithObject:characters] test:nil];
+}
+
++ (instancetype _Nonnull)filterWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                          isIn:(NSSet<NSString*>* _Nonnull)characters
+{
+    NSParameterAssert(characters != nil);
+    return [[self alloc] initWithPropertyKey:propertyKey characters:characters test:nil];
+}
+
++ (instancetype _Nonnull)filterWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                   passingTest:(BOOL (^_Nonnull)(NSString* _Nonnull characters))test
+{
+    NSParameterAssert(test != nil);
+    return [[self alloc] initWithPropertyKey:propertyKey characters:nil test:test];
+}
+
+#pragma mark - Public Methods
+
+- (BOOL)acceptsCharacters:(NSString* _Nonnull)characters
+{
+    NSParameterAssert(characters != nil);
+
+    if (self.test) {
+        return self.test(characters);
+    }
+    return [self.characters containsObject:characters];
+}
+
+- (BOOL)acceptsUTF8Bytes:(const uint8_t* _Nullable)bytes length:(NSUInteger)length
+{
+    NSParameterAssert(bytes != NULL || length == 0);
+
+    if (self.utf8Characters) {
+        for (NSData* data in self.utf8Characters) {
+            if (data.length == length && (length == 0 || memcmp(data.bytes, bytes, length) == 0)) {
+                return YES;
+            }
+        }
+        return NO;
+    }
+
+    if (length == 0) {
+        return [self acceptsCharacters:@""];
+    }
+    if (self.test) {
+        // NOTE: The block may retain the string, so it MUST have its own bytes.
+        NSString* characters = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+        return characters && self.test(characters);
+    }
+    NSString* characters = [[NSString alloc] initWithBytesNoCopy:(void*)bytes
+                                                          length:length
+                                                        encoding:NSUTF8StringEncoding
+                                                    freeWhenDone:NO];
+    return characters && [self.characters containsObject:characters];
+}
+
+#pragma mark - NSObject (Override)
+
+- (NSString* _Nonnull)description
+{
+    return [NSString stringWithFormat:@"<%@: %p> %@ %@", self.class, self, self.propertyKey,
+                                      self.characters ?: @"(block)"];
+}
+
+@end
@@ -6,15 +6,52 @@
 //  Copyright © 2017年 Hinagiku Soranoba. All rights reserved.
 //
 
+#import "MAEField.h"
 #import "MAESeparatedString.h"
 
+typedef NS_ENUM(uint8_t, MAEUnescapeState) {
+    /// It has not been checked yet whether characters contains escaped quotes.
+    MAEUnescapeUnknown = 0,
+    MAEUnescapeNeeded,
+    MAEUnescapeNotNeeded,
+};
+
+/**
+ * Store the value to the slot, if the slot is empty.
+ *
+ * @param slot   A slot that holds a retained object.
+ * @param value  A value to store
+ * @return The value stored in the slot
+ */
+static inline NSString* _Nonnull MAEStoreOnce(void* _Nullable* _Nonnull slot, NSString* _Nonnull value)
+{
+    void* expected = NULL;
+    void* retained = (void*)CFBridgingRetain(value);
+    if (__atomic_compare_exchange_n(slot, &expected, retained, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return value;
+    }
+    CFRelease(retained);
+    return (__bridge NSString*)expected;
+}
+
 @interface MAESeparatedString ()
-@property (nonatomic, nonnull, copy, readwrite) NSString* originalCharacters;
-@property (nonatomic, nonnull, copy, readwrite) NSString* characters;
 @property (nonatomic, assign, readwrite) MAEStringType type;
 @end
 
-@implementation MAESeparatedString
+@implementation MAESeparatedString {
+    /// The string that contains original characters.
+    /// It is nil, if the instance was created from characters.
+    NSString* _source;
+    /// The range of original characters in the source.
+    NSRange _range;
+    /// The range of characters (before unescaping) in the source.
+    NSRange _contentRange;
+    MAEUnescapeState _unescapeState;
+    /// originalCharacters and characters are created on first access.
+    /// These hold objects retained by CFBridgingRetain, so they are thread-safe without lock.
+    void* _originalCharacters;
+    void* _characters;
+}
 
 #pragma mark - Lifecycle
 
@@ -30,9 +67,9 @@
     NSParameterAssert(characters != nil);
 
     if (self = [super init]) {
-        self.characters = characters;
+        _characters = (void*)CFBridgingRetain([characters copy]);
+        _unescapeState = MAEUnescapeNotNeeded;
         self.type = type;
-        self.originalCharacters = [self.class stringFromCharacters:characters withType:type];
     }
     return self;
 }
@@ -43,32 +80,94 @@
     NSParameterAssert(originalCharacters != nil);
 
     if (self = [super init]) {
-        self.originalCharacters = originalCharacters;
+        _source = [originalCharacters copy];
+        _range = NSMakeRange(0, _source.length);
 
-        NSString* characters;
+        NSUInteger start = 0, end = _range.length;
         if (ignoreEdgeBlank) {
-            NSCharacterSet* characterSet = [NSCharacterSet characterSetWithCharactersInString:@" "];
-            characters = [originalCharacters stringByTrimmingCharactersInSet:characterSet];
-        } else {
-            characters = originalCharacters;
+            while (start < end && [_source characterAtIndex:start] == ' ') {
+                start++;
+            }
+            while (start < end && [_source characterAtIndex:end - 1] == ' ') {
+                end--;
+            }
         }
 
-        if (characters.length >= 2 && [characters hasPrefix:@"\""] & [characters hasSuffix:@"\""]) {
-            characters = [characters substringWithRange:NSMakeRange(1, characters.length - 2)];
-            characters = [characters stringByReplacingOccurrencesOfString:@"\\\"" withString:@"\""];
+        unichar first = end - start >= 2 ? [_source characterAtIndex:start] : 0;
+        unichar last = end - start >= 2 ? [_source characterAtIndex:end - 1] : 0;
+        if (first == '"' && last == '"') {
             self.type = MAEStringTypeDoubleQuoted;
-        } else if (characters.length >= 2 && [characters hasPrefix:@"'"] & [characters hasSuffix:@"'"]) {
-            characters = [characters substringWithRange:NSMakeRange(1, characters.length - 2)];
-            characters = [characters stringByReplacingOccurrencesOfString:@"\\'" withString:@"'"];
+            start++, end--;
+        } else if (first == '\'' && last == '\'') {
             self.type = MAEStringTypeSingleQuoted;
+            start++, end--;
         } else {
             self.type = MAEStringTypeEnumerate;
+            _unescapeState = MAEUnescapeNotNeeded;
         }
-        self.characters = characters;
+        _contentRange = NSMakeRange(start, end - start);
+    }
+    return self;
+}
+
+- (instancetype _Nonnull)initWithField:(MAEField)field inString:(NSString* _Nonnull)string
+{
+    NSParameterAssert(string != nil);
+
+    if (self = [super init]) {
+        // NOTE: If the string is immutable, it only retains.
+        _source = [string copy];
+        _range = field.range;
+        _contentRange = field.contentRange;
+        _unescapeState = field.needsUnescape ? MAEUnescapeUnknown : MAEUnescapeNotNeeded;
+        self.type = field.type;
     }
     return self;
 }
 
+- (void)dealloc
+{
+    if (_originalCharacters) {
+        CFRelease(_originalCharacters);
+    }
+    if (_characters) {
+        CFRelease(_characters);
+    }
+}
+
+#pragma mark - Custom Accessor
+
+- (NSString* _Nonnull)originalCharacters
+{
+    void* originalCharacters = __atomic_load_n(&_originalCharacters, __ATOMIC_ACQUIRE);
+    if (originalCharacters) {
+        return (__bridge NSString*)originalCharacters;
+    }
+
+    if (!_source) {
+        return MAEStoreOnce(&_originalCharacters, [self.class stringFromCharacters:self.characters withType:self.type]);
+    } else if (_range.location == 0 && _range.length == _source.length) {
+        return _source;
+    }
+    return MAEStoreOnce(&_originalCharacters, [_source substringWithRange:_range]);
+}
+
+- (NSString* _Nonnull)characters
+{
+    void* characters = __atomic_load_n(&_characters, __ATOMIC_ACQUIRE);
+    if (characters) {
+        return (__bridge NSString*)characters;
+    }
+
+    NSString* string = [_source substringWithRange:_contentRange];
+    if ([self needsUnescape]) {
+        string = self.type == MAEStringTypeDoubleQuoted
+            ? [string stringByReplacingOccurrencesOfString:@"\\\"" withString:@"\""]
+            : [string stringByReplacingOccurrencesOfString:@"\\'" withString:@"'"];
+    }
+    return MAEStoreOnce(&_characters, string);
+}
+
 #pragma mark - Public Methods
 
 + (NSString* _Nonnull)stringFromCharacters:(NSString* _Nonnull)characters
@@ -97,7 +196,7 @@
     if ([otherString isKindOfClass:MAESeparatedString.class]) {
         MAESeparatedString* otherSeparatedString = (id)otherString;
         return self.type == otherSeparatedString.type
-            && [self.characters isEqualToString:otherSeparatedString.characters];
+            && [self isEqualToString:otherSeparatedString];
     } else if ([otherString isKindOfClass:NSString.class]) {
         return [self isEqualToSeparatedString:[[self.class alloc] initWithOriginalCharacters:otherString
                                                                              ignoreEdgeBlank:NO]];
@@ -105,16 +204,65 @@
     return NO;
 }
 
+#pragma mark - Private Methods
+
+/**
+ * Returns whether characters contains escaped quotes.
+ * It does not create any object.
+ *
+ * @return If it is YES, the content in the source MUST be unescaped.
+ */
+- (BOOL)needsUnescape
+{
+    if (_unescapeState == MAEUnescapeUnknown) {
+        NSString* escapedQuote = self.type == MAEStringTypeDoubleQuoted ? @"\\\"" : @"\\'";
+        NSRange found = [_source rangeOfString:escapedQuote options:NSLiteralSearch range:_contentRange];
+        _unescapeState = found.location == NSNotFound ? MAEUnescapeNotNeeded : MAEUnescapeNeeded;
+    }
+    return _unescapeState == MAEUnescapeNeeded;
+}
+
+/**
+ * Returns whether characters can be read from the source directly.
+ */
+- (BOOL)canReadSourceDirectly
+{
+    return _source && !__atomic_load_n(&_characters, __ATOMIC_ACQUIRE) && ![self needsUnescape];
+}
+
 #pragma mark - NSString (Override)
 
 - (NSUInteger)length
 {
+    if ([self canReadSourceDirectly]) {
+        return _contentRange.length;
+    }
     return self.characters.length;
 }
 
 - (unichar)characterAtIndex:(NSUInteger)index
 {
+    if ([self canReadSourceDirectly]) {
+        if (index >= _contentRange.length) {
+            [NSException raise:NSRangeException format:@"Index %lu out of bounds; string length %lu",
+                                                       (unsigned long)index, (unsigned long)_contentRange.length];
+        }
+        return [_source characterAtIndex:_contentRange.location + index];
+    }
     return [self.characters characterAtIndex:index];
 }
 
+- (void)getCharacters:(unichar* _Nonnull)buffer range:(NSRange)range
+{
+    if ([self canReadSourceDirectly]) {
+        if (NSMaxRange(range) > _contentRange.length) {
+            [NSException raise:NSRangeException format:@"Range %@ out of bounds; string length %lu",
+                                                       NSStringFromRange(range), (unsigned long)_contentRange.length];
+        }
+        [_source getCharacters:buffer range:NSMakeRange(_contentRange.location + range.location, range.length)];
+        return;
+    }
+    [self.characters getCharacters:buffer range:range];
+}
+
 @end
@@ -0,0 +1,124 @@
+//
+//  MAETokenizer.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import "MAEField.h"
+#import <Foundation/Foundation.h>
+
+/// The number of fields that MAEFieldList can hold without heap allocation.
+#define MAEFieldListInlineCapacity 32
+
+/**
+ * A growable list of MAEField.
+ *
+ * It MUST be initialized by MAEFieldListInit and destroyed by MAEFieldListDestroy.
+ * It MUST NOT be copied, because fields may point to inlineFields.
+ */
+typedef struct MAEFieldList {
+    /// Fields. Valid indexes are [0, count).
+    MAEField* _Nonnull fields;
+    /// The number of fields.
+    NSUInteger count;
+    /// The number of fields that can be held without reallocation.
+    NSUInteger capacity;
+    /// A storage used until the number of fields exceeds MAEFieldListInlineCapacity.
+    MAEField inlineFields[MAEFieldListInlineCapacity];
+} MAEFieldList;
+
+/**
+ * Initialize a field list.
+ *
+ * @param list  A field list
+ */
+void MAEFieldListInit(MAEFieldList* _Nonnull list);
+
+/**
+ * Release the memory that a field list holds.
+ *
+ * @param list  A field list
+ */
+void MAEFieldListDestroy(MAEFieldList* _Nonnull list);
+
+/**
+ * A tokenizer that splits a string into fields without creating any object.
+ * It uses the same rules as MAEArrayAdapter. (Please refer to MAEArraySerializing # formatByPropertyKey)
+ */
+@interface MAETokenizer : NSObject
+
+/// The separator
+@property (nonatomic, assign, readonly) unichar separator;
+/// If it is YES, the first and last spaces of fields are ignored.
+@property (nonatomic, assign, readonly) BOOL ignoreEdgeBlank;
+/// Quotes to use
+@property (nonatomic, assign, readonly) MAEArrayQuotedOptions quotedOptions;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance
+ *
+ * @param separator        A separator
+ * @param ignoreEdgeBlank  If it is YES, the first and last spaces of fields are ignored.
+ * @param quotedOptions    Quotes to use
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithSeparator:(unichar)separator
+                           ignoreEdgeBlank:(BOOL)ignoreEdgeBlank
+                             quotedOptions:(MAEArrayQuotedOptions)quotedOptions;
+
+#pragma mark - Public Methods
+
+/**
+ * Split the string into fields.
+ *
+ * It reads the characters directly if the string has an internal UTF-16 buffer.
+ * Otherwise, it copies the characters to a stack buffer (or a heap buffer, if the string is long).
+ *
+ * @param string  A string
+ * @param list    A field list. Fields are appended to it. Ranges are relative to the string.
+ * @return If the string contains unclosed-quoted, it returns NO. Otherwise, it returns YES.
+ */
+- (BOOL)tokenizeString:(NSString* _Nonnull)string intoFieldList:(MAEFieldList* _Nonnull)list;
+
+/**
+ * Split the characters in the range of the string into fields.
+ * The range is treated as a whole record, so it is used for records that are embedded in another record.
+ *
+ * @param string  A string
+ * @param range   The range of the record in the string
+ * @param list    A field list. Fields are appended to it. Ranges are relative to the string, not to the range.
+ * @return If the record contains unclosed-quoted, it returns NO. Otherwise, it returns YES.
+ */
+- (BOOL)tokenizeString:(NSString* _Nonnull)string range:(NSRange)range intoFieldList:(MAEFieldList* _Nonnull)list;
+
+/**
+ * Split the characters into fields.
+ *
+ * @param characters  UTF-16 characters
+ * @param length      The length of characters
+ * @param list        A field list. Fields are appended to it. Ranges are relative to characters.
+ * @return If the characters contains unclosed-quoted, it returns NO. Otherwise, it returns YES.
+ */
+- (BOOL)tokenizeCharacters:(const unichar* _Nonnull)characters
+                    length:(NSUInteger)length
+             intoFieldList:(MAEFieldList* _Nonnull)list;
+
+/**
+ * Split UTF-8 bytes into fields without converting them to UTF-16.
+ * The separator MUST be an ASCII character.
+ *
+ * @param bytes   UTF-8 bytes
+ * @param length  The number of bytes
+ * @param list    A field list. Fields are appended to it. Ranges are byte ranges relative to bytes.
+ * @return If the bytes contains unclosed-quoted, it returns NO. Otherwise, it returns YES.
+ */
+- (BOOL)tokenizeUTF8Bytes:(const uint8_t* _Nonnull)bytes
+                   length:(NSUInteger)length
+            intoFieldList:(MAEFieldList* _Nonnull)list;
+
+@end
@@ -0,0 +1,302 @@
+//
+//  MAETokenizer.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAECharacterScanner.h"
+#import "MAETokenizer.h"
+
+/// Strings shorter than this are copied to a stack buffer, if they do not have an internal UTF-16 buffer.
+static NSUInteger const MAEStackBufferLength = 256;
+
+#pragma mark - MAEFieldList
+
+extern void MAEFieldListInit(MAEFieldList* _Nonnull list)
+{
+    list->fields = list->inlineFields;
+    list->count = 0;
+    list->capacity = MAEFieldListInlineCapacity;
+}
+
+extern void MAEFieldListDestroy(MAEFieldList* _Nonnull list)
+{
+    if (list->fields != list->inlineFields) {
+        free(list->fields);
+    }
+    MAEFieldListInit(list);
+}
+
+static inline void MAEFieldListAppend(MAEFieldList* _Nonnull list, MAEField field)
+{
+    if (list->count == list->capacity) {
+        NSUInteger capacity = list->capacity * 2;
+        MAEField* fields;
+        if (list->fields == list->inlineFields) {
+            if ((fields = malloc(sizeof(MAEField) * capacity))) {
+                memcpy(fields, list->inlineFields, sizeof(MAEField) * list->count);
+            }
+        } else {
+            fields = realloc(list->fields, sizeof(MAEField) * capacity);
+        }
+        if (!fields) {
+            // NOTE: The list keeps the old fields, so it remains valid for MAEFieldListDestroy.
+            [NSException raise:NSMallocException format:@"Could not allocate %lu fields", (unsigned long)capacity];
+        }
+        list->fields = fields;
+        list->capacity = capacity;
+    }
+    list->fields[list->count++] = field;
+}
+
+#pragma mark - Tokenizer
+
+/**
+ * Returns the character at the index.
+ * It is inlined with a constant `wide`, so UTF-16 and UTF-8 share the same code without any branch.
+ *
+ * @param chars  UTF-16 characters if wide is YES. Otherwise, UTF-8 bytes.
+ * @param index  An index
+ * @param wide   Whether chars is UTF-16
+ * @return A character. For UTF-8, it is a byte.
+ */
+static inline __attribute__((always_inline)) unichar MAECharacterAt(const void* _Nonnull chars, NSUInteger index,
+                                                                    BOOL wide)
+{
+    return wide ? ((const unichar*)chars)[index] : ((const uint8_t*)chars)[index];
+}
+
+/**
+ * Create a field from original characters in [start, end).
+ * It has the same result as MAESeparatedString # initWithOriginalCharacters:ignoreEdgeBlank:
+ */
+static inline __attribute__((always_inline)) MAEField MAEMakeField(const void* _Nonnull chars, BOOL wide,
+                                                                   NSUInteger start, NSUInteger end,
+                                                                   BOOL ignoreEdgeBlank, BOOL hasBackslash)
+{
+    MAEField field;
+    field.range = NSMakeRange(start, end - start);
+
+    if (ignoreEdgeBlank) {
+        while (start < end && MAECharacterAt(chars, start, wide) == ' ') {
+            start++;
+        }
+        while (start < end && MAECharacterAt(chars, end - 1, wide) == ' ') {
+            end--;
+        }
+    }
+
+    if (end - start >= 2 && MAECharacterAt(chars, start, wide) == '"' && MAECharacterAt(chars, end - 1, wide) == '"') {
+        field.type = MAEStringTypeDoubleQuoted;
+        start++, end--;
+    } else if (end - start >= 2 && MAECharacterAt(chars, start, wide) == '\''
+               && MAECharacterAt(chars, end - 1, wide) == '\'') {
+        field.type = MAEStringTypeSingleQuoted;
+        start++, end--;
+    } else {
+        field.type = MAEStringTypeEnumerate;
+    }
+    field.contentRange = NSMakeRange(start, end - start);
+    field.needsUnescape = hasBackslash && field.type != MAEStringTypeEnumerate;
+    return field;
+}
+
+@interface MAETokenizer ()
+@property (nonatomic, assign, readwrite) unichar separator;
+@property (nonatomic, assign, readwrite) BOOL ignoreEdgeBlank;
+@property (nonatomic, assign, readwrite) MAEArrayQuotedOptions quotedOptions;
+@end
+
+@implementation MAETokenizer {
+    /// A function that finds the next character that may change the state. (separator, quotes and backslash)
+    MAEScanFunction _scan;
+    MAEScanBytesFunction _scanBytes;
+    MAEScanTargets _targets;
+}
+
+#pragma mark - Functions
+
+/**
+ * Split UTF-16 characters or UTF-8 bytes into fields.
+ *
+ * Separator, quotes and backslash are ASCII characters, and bytes of other UTF-8 characters are never ASCII.
+ * So the same rules can be applied to UTF-8 bytes.
+ * It is inlined with a constant `wide`, so each public method has its own specialized loop.
+ *
+ * @param self    A tokenizer
+ * @param chars   UTF-16 characters if wide is YES. Otherwise, UTF-8 bytes.
+ * @param wide    Whether chars is UTF-16
+ * @param length  The length of chars
+ * @param list    A field list. Fields are appended to it. Ranges are relative to chars.
+ * @return If the characters contains unclosed-quoted, it returns NO. Otherwise, it returns YES.
+ */
+static inline __attribute__((always_inline)) BOOL MAETokenize(MAETokenizer* _Nonnull self, const void* _Nonnull chars,
+                                                              BOOL wide, NSUInteger length,
+                                                              MAEFieldList* _Nonnull list)
+{
+    const unichar separator = self.separator;
+    const BOOL ignoreEdgeBlank = self.ignoreEdgeBlank;
+    const BOOL doubleQuoteEnabled = (self.quotedOptions & MAEArrayDoubleQuotedEnable) != 0;
+    const BOOL singleQuoteEnabled = (self.quotedOptions & MAEArraySingleQuotedEnable) != 0;
+
+    const MAEScanFunction scan = self->_scan;
+    const MAEScanBytesFunction scanBytes = self->_scanBytes;
+    const MAEScanTargets* targets = &self->_targets;
+
+    BOOL doubleQuoted = NO, singleQuoted = NO, hasBackslash = NO;
+    NSUInteger start = 0, p;
+
+    // NOTE: Other characters do not change the state, so it skips them by the scanner.
+    for (p = 0; (p = wide ? scan(chars, p, length, targets) : scanBytes(chars, p, length, targets)) < length; p++) {
+        unichar c = MAECharacterAt(chars, p, wide);
+        if (c == '\\') {
+            hasBackslash = YES;
+            if (++p == length) {
+                break;
+            }
+        } else if (!singleQuoted && !doubleQuoted && c == separator) {
+            if (c == ' ' && ignoreEdgeBlank && p + 1 < length && MAECharacterAt(chars, p + 1, wide) == ' ') {
+                // NOP
+            } else {
+                MAEFieldListAppend(list, MAEMakeField(chars, wide, start, p, ignoreEdgeBlank, hasBackslash));
+                start = p + 1;
+                hasBackslash = NO;
+            }
+        } else if (!singleQuoted && doubleQuoteEnabled && c == '"') {
+            doubleQuoted = !doubleQuoted;
+        } else if (!doubleQuoted && singleQuoteEnabled && c == '\'') {
+            singleQuoted = !singleQuoted;
+        }
+    }
+
+    if (start < length) {
+        if (doubleQuoted || singleQuoted) {
+            // NOTE: unclosed-quoted
+            return NO;
+        }
+        MAEFieldListAppend(list, MAEMakeField(chars, wide, start, length, ignoreEdgeBlank, hasBackslash));
+    }
+    return YES;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithSeparator:(unichar)separator
+                           ignoreEdgeBlank:(BOOL)ignoreEdgeBlank
+                             quotedOptions:(MAEArrayQuotedOptions)quotedOptions
+{
+    return [self initWithSeparator:separator
+                   ignoreEdgeBlank:ignoreEdgeBlank
+                     quotedOptions:quotedOptions
+                       scannerKind:MAEScannerKindAutomatic];
+}
+
+/**
+ * Create an instance with the specified scanner.
+ *
+ * @param separator        A separator
+ * @param ignoreEdgeBlank  If it is YES, the first and last spaces of fields are ignored.
+ * @param quotedOptions    Quotes to use
+ * @param scannerKind      A kind of scanner. It MUST be supported by the current CPU.
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithSeparator:(unichar)separator
+                           ignoreEdgeBlank:(BOOL)ignoreEdgeBlank
+                             quotedOptions:(MAEArrayQuotedOptions)quotedOptions
+                               scannerKind:(MAEScannerKind)scannerKind
+{
+    if (self = [super init]) {
+        self.separator = separator;
+        self.ignoreEdgeBlank = ignoreEdgeBlank;
+        self.quotedOptions = quotedOptions;
+
+        _scan = MAEScanFunctionForKind(scannerKind);
+        _scanBytes = MAEScanBytesFunctionForKind(scannerKind);
+        NSAssert(_scan != NULL && _scanBytes != NULL, @"The scanner %tu is not supported", scannerKind);
+
+        unichar targets[MAEScanTargetCount] = { separator, '\\' };
+        NSUInteger count = 2;
+        if (quotedOptions & MAEArrayDoubleQuotedEnable) {
+            targets[count++] = '"';
+        }
+        if (quotedOptions & MAEArraySingleQuotedEnable) {
+            targets[count++] = '\'';
+        }
+        _targets = MAEMakeScanTargets(targets, count);
+    }
+    return self;
+}
+
+#pragma mark - Public Methods
+
+- (BOOL)tokenizeString:(NSString* _Nonnull)string intoFieldList:(MAEFieldList* _Nonnull)list
+{
+    NSParameterAssert(string != nil);
+
+    return [self tokenizeString:string range:NSMakeRange(0, string.length) intoFieldList:list];
+}
+
+- (BOOL)tokenizeString:(NSString* _Nonnull)string range:(NSRange)range intoFieldList:(MAEFieldList* _Nonnull)list
+{
+    NSParameterAssert(string != nil);
+    NSParameterAssert(list != NULL);
+    NSParameterAssert(NSMaxRange(range) <= string.length);
+
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    const NSUInteger first = list->count;
+    BOOL result;
+
+    const unichar* chars = CFStringGetCharactersPtr(cfString);
+    if (chars) {
+        result = [self tokenizeCharacters:chars + range.location length:range.length intoFieldList:list];
+    } else if (range.length <= MAEStackBufferLength) {
+        unichar buffer[MAEStackBufferLength];
+        CFStringGetCharacters(cfString, CFRangeMake((CFIndex)range.location, (CFIndex)range.length), buffer);
+        result = [self tokenizeCharacters:buffer length:range.length intoFieldList:list];
+    } else {
+        unichar* buffer = malloc(sizeof(unichar) * range.length);
+        CFStringGetCharacters(cfString, CFRangeMake((CFIndex)range.location, (CFIndex)range.length), buffer);
+        result = [self tokenizeCharacters:buffer length:range.length intoFieldList:list];
+        free(buffer);
+    }
+
+    if (range.location > 0) {
+        for (NSUInteger i = first; i < list->count; i++) {
+            list->fields[i].range.location += range.location;
+            list->fields[i].contentRange.location += range.location;
+        }
+    }
+    return result;
+}
+
+- (BOOL)tokenizeCharacters:(const unichar* _Nonnull)chars
+                    length:(NSUInteger)length
+             intoFieldList:(MAEFieldList* _Nonnull)list
+{
+    NSParameterAssert(chars != NULL || length == 0);
+    NSParameterAssert(list != NULL);
+
+    return MAETokenize(self, chars, YES, length, list);
+}
+
+- (BOOL)tokenizeUTF8Bytes:(const uint8_t* _Nonnull)bytes
+                   length:(NSUInteger)length
+            intoFieldList:(MAEFieldList* _Nonnull)list
+{
+    NSParameterAssert(bytes != NULL || length == 0);
+    NSParameterAssert(list != NULL);
+    NSAssert(self.separator < 0x80, @"The separator MUST be an ASCII character to tokenize UTF-8 bytes, but got %C",
+             self.separator);
+
+    return MAETokenize(self, bytes, NO, length, list);
+}
+
+@end
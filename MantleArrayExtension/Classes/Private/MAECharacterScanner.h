@@ -0,0 +1,83 @@
+//
+//  MAECharacterScanner.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/// The number of characters that a scanner finds at once.
+#define MAEScanTargetCount 4
+
+typedef NS_ENUM(NSUInteger, MAEScannerKind) {
+    /// The fastest scanner supported by the current CPU
+    MAEScannerKindAutomatic = 0,
+    /// It compares one character at a time. It is supported on all CPUs.
+    MAEScannerKindScalar,
+    /// It compares 16 characters at a time with SSE2.
+    MAEScannerKindSSE2,
+    /// It compares 32 characters at a time with AVX2.
+    MAEScannerKindAVX2,
+    /// It compares 16 characters at a time with NEON.
+    MAEScannerKindNEON,
+};
+
+/**
+ * Characters that a scanner finds.
+ * If there are less than MAEScanTargetCount characters, the rest are filled with the first character.
+ */
+typedef struct {
+    unichar characters[MAEScanTargetCount];
+} MAEScanTargets;
+
+/**
+ * Returns the index of the first character in [from, length) that is one of the targets.
+ *
+ * @param chars    UTF-16 characters
+ * @param from     The index to start scanning
+ * @param length   The length of characters
+ * @param targets  Characters to find
+ * @return If it is found, it returns the index. Otherwise, it returns length.
+ */
+typedef NSUInteger (*MAEScanFunction)(const unichar* _Nonnull chars, NSUInteger from, NSUInteger length,
+                                      const MAEScanTargets* _Nonnull targets);
+
+/**
+ * Returns the index of the first byte in [from, length) that is one of the targets.
+ * Targets MUST be ASCII characters, so it can scan UTF-8 bytes.
+ *
+ * @param bytes    UTF-8 bytes
+ * @param from     The index to start scanning
+ * @param length   The length of bytes
+ * @param targets  Characters to find
+ * @return If it is found, it returns the index. Otherwise, it returns length.
+ */
+typedef NSUInteger (*MAEScanBytesFunction)(const uint8_t* _Nonnull bytes, NSUInteger from, NSUInteger length,
+                                           const MAEScanTargets* _Nonnull targets);
+
+/**
+ * Create scan targets.
+ *
+ * @param characters  Characters to find
+ * @param count       The number of characters. It MUST be in [1, MAEScanTargetCount].
+ * @return Scan targets
+ */
+extern MAEScanTargets MAEMakeScanTargets(const unichar* _Nonnull characters, NSUInteger count);
+
+/**
+ * Returns a scan function.
+ *
+ * @param kind  A kind of scanner
+ * @return If the current CPU does not support the scanner, it returns NULL. Otherwise, it returns a function.
+ */
+extern MAEScanFunction _Nullable MAEScanFunctionForKind(MAEScannerKind kind);
+
+/**
+ * Returns a scan function for UTF-8 bytes.
+ *
+ * @param kind  A kind of scanner
+ * @return If the current CPU does not support the scanner, it returns NULL. Otherwise, it returns a function.
+ */
+extern MAEScanBytesFunction _Nullable MAEScanBytesFunctionForKind(MAEScannerKind kind);
@@ -0,0 +1,304 @@
+//
+//  MAECharacterScanner.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAECharacterScanner.h"
+
+#if defined(__SSE2__)
+#import <immintrin.h>
+#define MAE_HAS_SSE2 1
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#define MAE_HAS_AVX2 1
+#endif
+#elif defined(__ARM_NEON)
+#import <arm_neon.h>
+#define MAE_HAS_NEON 1
+#endif
+
+#pragma mark - Scalar
+
+static NSUInteger MAEScanScalar(const unichar* _Nonnull chars, NSUInteger from, NSUInteger length,
+                                const MAEScanTargets* _Nonnull targets)
+{
+    const unichar t0 = targets->characters[0], t1 = targets->characters[1];
+    const unichar t2 = targets->characters[2], t3 = targets->characters[3];
+    for (NSUInteger i = from; i < length; i++) {
+        unichar c = chars[i];
+        if (c == t0 || c == t1 || c == t2 || c == t3) {
+            return i;
+        }
+    }
+    return length;
+}
+
+static NSUInteger MAEScanBytesScalar(const uint8_t* _Nonnull bytes, NSUInteger from, NSUInteger length,
+                                     const MAEScanTargets* _Nonnull targets)
+{
+    const uint8_t t0 = (uint8_t)targets->characters[0], t1 = (uint8_t)targets->characters[1];
+    const uint8_t t2 = (uint8_t)targets->characters[2], t3 = (uint8_t)targets->characters[3];
+    for (NSUInteger i = from; i < length; i++) {
+        uint8_t c = bytes[i];
+        if (c == t0 || c == t1 || c == t2 || c == t3) {
+            return i;
+        }
+    }
+    return length;
+}
+
+#pragma mark - SSE2
+
+#if MAE_HAS_SSE2
+
+/**
+ * Returns a mask that has 2 bits for each character equal to one of the targets.
+ */
+static inline uint32_t MAEMatchSSE2(const unichar* _Nonnull chars, const __m128i* _Nonnull t)
+{
+    __m128i v = _mm_loadu_si128((const __m128i*)chars);
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, t[0]), _mm_cmpeq_epi16(v, t[1])),
+                             _mm_or_si128(_mm_cmpeq_epi16(v, t[2]), _mm_cmpeq_epi16(v, t[3])));
+    return (uint32_t)_mm_movemask_epi8(m);
+}
+
+static NSUInteger MAEScanSSE2(const unichar* _Nonnull chars, NSUInteger from, NSUInteger length,
+                              const MAEScanTargets* _Nonnull targets)
+{
+    const __m128i t[MAEScanTargetCount] = {
+        _mm_set1_epi16((short)targets->characters[0]), _mm_set1_epi16((short)targets->characters[1]),
+        _mm_set1_epi16((short)targets->characters[2]), _mm_set1_epi16((short)targets->characters[3]),
+    };
+
+    NSUInteger i = from;
+    for (; i + 16 <= length; i += 16) {
+        uint32_t mask = MAEMatchSSE2(chars + i, t) | (MAEMatchSSE2(chars + i + 8, t) << 16);
+        if (mask) {
+            return i + (NSUInteger)__builtin_ctz(mask) / 2;
+        }
+    }
+    return MAEScanScalar(chars, i, length, targets);
+}
+
+static NSUInteger MAEScanBytesSSE2(const uint8_t* _Nonnull bytes, NSUInteger from, NSUInteger length,
+                                   const MAEScanTargets* _Nonnull targets)
+{
+    const __m128i t0 = _mm_set1_epi8((char)targets->characters[0]), t1 = _mm_set1_epi8((char)targets->characters[1]);
+    const __m128i t2 = _mm_set1_epi8((char)targets->characters[2]), t3 = _mm_set1_epi8((char)targets->characters[3]);
+
+    NSUInteger i = from;
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(bytes + i));
+        __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, t0), _mm_cmpeq_epi8(v, t1)),
+                                 _mm_or_si128(_mm_cmpeq_epi8(v, t2), _mm_cmpeq_epi8(v, t3)));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(m);
+        if (mask) {
+            return i + (NSUInteger)__builtin_ctz(mask);
+        }
+    }
+    return MAEScanBytesScalar(bytes, i, length, targets);
+}
+
+#endif
+
+#pragma mark - AVX2
+
+#if MAE_HAS_AVX2
+
+__attribute__((target("avx2"))) static inline uint32_t MAEMatchAVX2(const unichar* _Nonnull chars,
+                                                                    const __m256i* _Nonnull t)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i*)chars);
+    __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi16(v, t[0]), _mm256_cmpeq_epi16(v, t[1])),
+                                _mm256_or_si256(_mm256_cmpeq_epi16(v, t[2]), _mm256_cmpeq_epi16(v, t[3])));
+    return (uint32_t)_mm256_movemask_epi8(m);
+}
+
+__attribute__((target("avx2"))) static NSUInteger MAEScanAVX2(const unichar* _Nonnull chars, NSUInteger from,
+                                                              NSUInteger length, const MAEScanTargets* _Nonnull targets)
+{
+    const __m256i t[MAEScanTargetCount] = {
+        _mm256_set1_epi16((short)targets->characters[0]), _mm256_set1_epi16((short)targets->characters[1]),
+        _mm256_set1_epi16((short)targets->characters[2]), _mm256_set1_epi16((short)targets->characters[3]),
+    };
+
+    NSUInteger i = from;
+    for (; i + 32 <= length; i += 32) {
+        uint64_t mask = (uint64_t)MAEMatchAVX2(chars + i, t) | ((uint64_t)MAEMatchAVX2(chars + i + 16, t) << 32);
+        if (mask) {
+            return i + (NSUInteger)__builtin_ctzll(mask) / 2;
+        }
+    }
+    return MAEScanSSE2(chars, i, length, targets);
+}
+
+__attribute__((target("avx2"))) static NSUInteger MAEScanBytesAVX2(const uint8_t* _Nonnull bytes, NSUInteger from,
+                                                                   NSUInteger length,
+                                                                   const MAEScanTargets* _Nonnull targets)
+{
+    const __m256i t0 = _mm256_set1_epi8((char)targets->characters[0]);
+    const __m256i t1 = _mm256_set1_epi8((char)targets->characters[1]);
+    const __m256i t2 = _mm256_set1_epi8((char)targets->characters[2]);
+    const __m256i t3 = _mm256_set1_epi8((char)targets->characters[3]);
+
+    NSUInteger i = from;
+    for (; i + 32 <= length; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(bytes + i));
+        __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, t0), _mm256_cmpeq_epi8(v, t1)),
+                                    _mm256_or_si256(_mm256_cmpeq_epi8(v, t2), _mm256_cmpeq_epi8(v, t3)));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(m);
+        if (mask) {
+            return i + (NSUInteger)__builtin_ctz(mask);
+        }
+    }
+    return MAEScanBytesSSE2(bytes, i, length, targets);
+}
+
+#endif
+
+#pragma mark - NEON
+
+#if MAE_HAS_NEON
+
+/**
+ * Returns a mask that has 4 bits for each character equal to one of the targets.
+ */
+static inline uint64_t MAEMatchNEON(const unichar* _Nonnull chars, const uint16x8_t* _Nonnull t)
+{
+    uint16x8_t v = vld1q_u16(chars);
+    uint16x8_t m = vorrq_u16(vorrq_u16(vceqq_u16(v, t[0]), vceqq_u16(v, t[1])),
+                             vorrq_u16(vceqq_u16(v, t[2]), vceqq_u16(v, t[3])));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(m, 4)), 0);
+}
+
+static NSUInteger MAEScanNEON(const unichar* _Nonnull chars, NSUInteger from, NSUInteger length,
+                              const MAEScanTargets* _Nonnull targets)
+{
+    const uint16x8_t t[MAEScanTargetCount] = {
+        vdupq_n_u16(targets->characters[0]), vdupq_n_u16(targets->characters[1]),
+        vdupq_n_u16(targets->characters[2]), vdupq_n_u16(targets->characters[3]),
+    };
+
+    NSUInteger i = from;
+    for (; i + 16 <= length; i += 16) {
+        uint64_t mask = MAEMatchNEON(chars + i, t);
+        if (mask) {
+            return i + (NSUInteger)__builtin_ctzll(mask) / 8;
+        }
+        mask = MAEMatchNEON(chars + i + 8, t);
+        if (mask) {
+            return i + 8 + (NSUInteger)__builtin_ctzll(mask) / 8;
+        }
+    }
+    return MAEScanScalar(chars, i, length, targets);
+}
+
+static NSUInteger MAEScanBytesNEON(const uint8_t* _Nonnull bytes, NSUInteger from, NSUInteger length,
+                                   const MAEScanTargets* _Nonnull targets)
+{
+    const uint8x16_t t0 = vdupq_n_u8((uint8_t)targets->characters[0]), t1 = vdupq_n_u8((uint8_t)targets->characters[1]);
+    const uint8x16_t t2 = vdupq_n_u8((uint8_t)targets->characters[2]), t3 = vdupq_n_u8((uint8_t)targets->characters[3]);
+
+    NSUInteger i = from;
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t v = vld1q_u8(bytes + i);
+        uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, t0), vceqq_u8(v, t1)), vorrq_u8(vceqq_u8(v, t2), vceqq_u8(v, t3)));
+        // NOTE: It narrows the mask to 4 bits for each byte.
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (mask) {
+            return i + (NSUInteger)__builtin_ctzll(mask) / 4;
+        }
+    }
+    return MAEScanBytesScalar(bytes, i, length, targets);
+}
+
+#endif
+
+#pragma mark - Functions
+
+extern MAEScanTargets MAEMakeScanTargets(const unichar* _Nonnull characters, NSUInteger count)
+{
+    NSCParameterAssert(characters != NULL);
+    NSCAssert(count >= 1 && count <= MAEScanTargetCount, @"count MUST be in [1, %d], but got %tu",
+              MAEScanTargetCount, count);
+
+    MAEScanTargets targets;
+    for (NSUInteger i = 0; i < MAEScanTargetCount; i++) {
+        targets.characters[i] = characters[i < count ? i : 0];
+    }
+    return targets;
+}
+
+extern MAEScanFunction _Nullable MAEScanFunctionForKind(MAEScannerKind kind)
+{
+    switch (kind) {
+        case MAEScannerKindAutomatic: {
+            static MAEScanFunction function = NULL;
+            static dispatch_once_t onceToken;
+            dispatch_once(&onceToken, ^{
+                const MAEScannerKind kinds[] = { MAEScannerKindAVX2, MAEScannerKindSSE2, MAEScannerKindNEON };
+                for (size_t i = 0; i < sizeof(kinds) / sizeof(kinds[0]) && !function; i++) {
+                    function = MAEScanFunctionForKind(kinds[i]);
+                }
+                if (!function) {
+                    function = MAEScanScalar;
+                }
+            });
+            return function;
+        }
+        case MAEScannerKindScalar:
+            return MAEScanScalar;
+#if MAE_HAS_SSE2
+        case MAEScannerKindSSE2:
+            return MAEScanSSE2;
+#endif
+#if MAE_HAS_AVX2
+        case MAEScannerKindAVX2:
+            return __builtin_cpu_supports("avx2") ? MAEScanAVX2 : NULL;
+#endif
+#if MAE_HAS_NEON
+        case MAEScannerKindNEON:
+            return MAEScanNEON;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+extern MAEScanBytesFunction _Nullable MAEScanBytesFunctionForKind(MAEScannerKind kind)
+{
+    switch (kind) {
+        case MAEScannerKindAutomatic: {
+            static MAEScanBytesFunction function = NULL;
+            static dispatch_once_t onceToken;
+            dispatch_once(&onceToken, ^{
+                const MAEScannerKind kinds[] = { MAEScannerKindAVX2, MAEScannerKindSSE2, MAEScannerKindNEON };
+                for (size_t i = 0; i < sizeof(kinds) / sizeof(kinds[0]) && !function; i++) {
+                    function = MAEScanBytesFunctionForKind(kinds[i]);
+                }
+                if (!function) {
+                    function = MAEScanBytesScalar;
+                }
+            });
+            return function;
+        }
+        case MAEScannerKindScalar:
+            return MAEScanBytesScalar;
+#if MAE_HAS_SSE2
+        case MAEScannerKindSSE2:
+            return MAEScanBytesSSE2;
+#endif
+#if MAE_HAS_AVX2
+        case MAEScannerKindAVX2:
+            return __builtin_cpu_supports("avx2") ? MAEScanBytesAVX2 : NULL;
+#endif
+#if MAE_HAS_NEON
+        case MAEScannerKindNEON:
+            return MAEScanBytesNEON;
+#endif
+        default:
+            return NULL;
+    }
+}
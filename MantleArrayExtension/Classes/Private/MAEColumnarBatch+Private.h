@@ -0,0 +1,100 @@
+//
+//  MAEColumnarBatch+Private.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEColumnarBatch.h"
+
+/**
+ * Methods that are used by MAEArrayAdapter to build columns.
+ *
+ * Values are appended to the current row, and the row is finished by MAEColumnarBatch # finishRow.
+ */
+@interface MAEColumn (Private)
+
+/// If it is YES, floating point numbers of the column are parsed with float precision. (MAENumberTransformer)
+@property (nonatomic, assign) BOOL floatPrecision;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance.
+ *
+ * @param propertyKey  A property key
+ * @param type         A type of values
+ * @param variadic     Whether the fragment of the property is variadic
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithPropertyKey:(NSString* _Nonnull)propertyKey
+                                        type:(MAEColumnType)type
+                                    variadic:(BOOL)variadic;
+
+#pragma mark - Public Methods
+
+/**
+ * Mark that the current row has a value, even if no values are appended. (e.g. MAEVariadic with no fields)
+ */
+- (void)markPresent;
+
+/**
+ * Append a value to the current row. The type MUST be MAEColumnTypeInt64.
+ *
+ * @param value  A value
+ */
+- (void)appendInt64:(int64_t)value;
+
+/**
+ * Append a value to the current row. The type MUST be MAEColumnTypeDouble.
+ *
+ * @param value  A value
+ */
+- (void)appendDouble:(double)value;
+
+/**
+ * Append a value to the current row. The type MUST be MAEColumnTypeBool.
+ *
+ * @param value  A value
+ */
+- (void)appendBool:(BOOL)value;
+
+/**
+ * Append a value to the current row. The type MUST be MAEColumnTypeString.
+ *
+ * @param bytes   UTF-8 bytes
+ * @param length  The number of bytes
+ */
+- (void)appendUTF8Bytes:(const uint8_t* _Nullable)bytes length:(NSUInteger)length;
+
+/**
+ * Append a value to the current row. The type MUST be MAEColumnTypeString.
+ *
+ * @param string  A string
+ */
+- (void)appendString:(NSString* _Nonnull)string;
+
+@end
+
+@interface MAEColumnarBatch (Private)
+
+#pragma mark - Public Methods
+
+/**
+ * Finish the current row.
+ * Columns that have no values in the row are marked as invalid.
+ */
+- (void)finishRow;
+
+/**
+ * Discard values of the current row, and finish it as an invalid row in all columns.
+ */
+- (void)finishInvalidRow;
+
+/**
+ * Discard values of the current row without finishing it, and count it as a rejected record.
+ */
+- (void)rejectRow;
+
+@end
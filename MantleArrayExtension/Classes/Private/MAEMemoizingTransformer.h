@@ -0,0 +1,48 @@
+//
+//  MAEMemoizingTransformer.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import <Foundation/Foundation.h>
+#import <Mantle/MTLTransformerErrorHandling.h>
+
+/**
+ * A transformer that memoizes results of a pure transformer.
+ *
+ * Forward transformations are memoized by the original characters of MAESeparatedString
+ * (or an array of them), and reverse transformations are memoized by values. (Numbers are also keyed by their types)
+ * Other inputs of forward transformations and values that are not NSCopying are transformed without the memo.
+ * Failed transformations are not memoized. It is thread-safe.
+ *
+ * MAEArrayAdapter wraps transformers of properties that +memoizationCapacityForKey: returns a positive number.
+ */
+@interface MAEMemoizingTransformer : NSValueTransformer <MTLTransformerErrorHandling>
+
+/// A transformer that is memoized
+@property (nonatomic, nonnull, strong, readonly) NSValueTransformer* transformer;
+/// The maximum number of values that are memoized for each direction
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+/// The eviction policy of the memo
+@property (nonatomic, assign, readonly) MAEMemoizationEviction eviction;
+/// Statistics of both directions
+@property (nonatomic, assign, readonly) MAEMemoizationStatistics statistics;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance.
+ *
+ * @param transformer  A pure transformer
+ * @param capacity     The maximum number of values that are memoized for each direction
+ * @param eviction     The eviction policy of the memo
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithTransformer:(NSValueTransformer* _Nonnull)transformer
+                                    capacity:(NSUInteger)capacity
+                                    eviction:(MAEMemoizationEviction)eviction;
+
+@end
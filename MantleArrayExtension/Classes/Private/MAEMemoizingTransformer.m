@@ -0,0 +1,471 @@
+//
+//  MAEMemoizingTransformer.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEMemoizingTransformer.h"
+#import "MAESeparatedString.h"
+#import <pthread.h>
+
+/// It is memoized instead of nil, because the memo can not hold nil.
+static NSObject* MAEMemoizedNil;
+
+/**
+ * A key of a number that is equal only to numbers of the same class and objCType.
+ */
+@interface MAENumberMemoKey : NSObject <NSCopying>
+@end
+
+@implementation MAENumberMemoKey {
+    NSNumber* _number;
+    Class _numberClass;
+    const char* _objCType;
+}
+
+- (instancetype _Nonnull)initWithNumber:(NSNumber* _Nonnull)number
+{
+    if (self = [super init]) {
+        _number = number;
+        _numberClass = number.class;
+        _objCType = number.objCType;
+    }
+    return self;
+}
+
+- (BOOL)isEqual:(id _Nullable)object
+{
+    if (![object isKindOfClass:MAENumberMemoKey.class]) {
+        return NO;
+    }
+    MAENumberMemoKey* other = object;
+    return _numberClass == other->_numberClass && strcmp(_objCType, other->_objCType) == 0
+        && [_number isEqualToNumber:other->_number];
+}
+
+- (NSUInteger)hash
+{
+    return _number.hash ^ (NSUInteger)_objCType[0];
+}
+
+- (id _Nonnull)copyWithZone:(NSZone* _Nullable)zone
+{
+    // NOTE: It is immutable.
+    return self;
+}
+
+@end
+
+#pragma mark - Functions
+
+/**
+ * Returns a key of the forward memo.
+ *
+ * @param value  An input of the forward transformation
+ * @return If the value is MAESeparatedString (or an array of them), it returns its original characters.
+ *         Otherwise, it returns nil.
+ */
+static id _Nullable MAEForwardMemoKey(id _Nullable value)
+{
+    if ([value isKindOfClass:MAESeparatedString.class]) {
+        return ((MAESeparatedString*)value).originalCharacters;
+    }
+    if ([value isKindOfClass:NSArray.class]) {
+        NSMutableArray<NSString*>* key = [NSMutableArray arrayWithCapacity:[value count]];
+        for (id element in value) {
+            if (![element isKindOfClass:MAESeparatedString.class]) {
+                return nil;
+            }
+            [key addObject:((MAESeparatedString*)element).originalCharacters];
+        }
+        return key;
+    }
+    return nil;
+}
+
+/**
+ * Returns a key of the reverse memo.
+ *
+ * Equal numbers by isEqual: can have different types (e.g. @1, @1.0 and @YES), and transformers may print them
+ * differently. So numbers are keyed by their class and objCType as well as the value.
+ *
+ * @param value  An input of the reverse transformation
+ * @return If the value is not NSCopying, it returns nil. Otherwise, it returns a key.
+ */
+static id _Nullable MAEReverseMemoKey(id _Nullable value)
+{
+    if ([value isKindOfClass:NSNumber.class]) {
+        return [[MAENumberMemoKey alloc] initWithNumber:value];
+    }
+    return [value conformsToProtocol:@protocol(NSCopying)] ? value : nil;
+}
+
+/**
+ * A slot of the memo. Slots are linked from the most recently used to the least recently used.
+ */
+typedef struct MAEMemoSlot {
+    NSUInteger previous;
+    NSUInteger next;
+} MAEMemoSlot;
+
+/**
+ * A bounded table of memoized values. It is not thread-safe.
+ */
+@interface MAEMemo : NSObject
+/// The number of memoized values
+@property (nonatomic, assign, readonly) NSUInteger count;
+@end
+
+@implementation MAEMemo {
+    NSUInteger _capacity;
+    /// If it is YES, the least recently used value is evicted. Otherwise, new values are not memoized when it is full.
+    BOOL _tracksRecency;
+    MAEMemoSlot* _slots;
+    __strong id* _keys;
+    __strong id* _objects;
+    /// Slots for each key (key -> NSNumber)
+    NSMutableDictionary* _slotsByKey;
+    /// The most recently used slot. It is NSNotFound, if the memo is empty.
+    NSUInteger _head;
+    /// The least recently used slot. It is NSNotFound, if the memo is empty.
+    NSUInteger _tail;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nonnull)initWithCapacity:(NSUInteger)capacity tracksRecency:(BOOL)tracksRecency
+{
+    NSParameterAssert(capacity > 0);
+
+    if (self = [super init]) {
+        _capacity = capacity;
+        _tracksRecency = tracksRecency;
+        _slots = calloc(capacity, sizeof(MAEMemoSlot));
+        _keys = (__strong id*)calloc(capacity, sizeof(id));
+        _objects = (__strong id*)calloc(capacity, sizeof(id));
+        _slotsByKey = [NSMutableDictionary dictionary];
+        _head = _tail = NSNotFound;
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _count; i++) {
+        _keys[i] = nil;
+        _objects[i] = nil;
+    }
+    free(_keys);
+    free(_objects);
+    free(_slots);
+}
+
+#pragma mark - Public Methods
+
+/**
+ * Returns the memoized value of the key, and marks it as the most recently used.
+ *
+ * @param key  A key
+ * @return If it is not memoized, it returns nil. Otherwise, it returns the value.
+ */
+- (id _Nullable)objectForKey:(id _Nonnull)key
+{
+    NSNumber* slot = _slotsByKey[key];
+    if (!slot) {
+        return nil;
+    }
+    if (_tracksRecency) {
+        [self moveSlotToHead:slot.unsignedIntegerValue];
+    }
+    return _objects[slot.unsignedIntegerValue];
+}
+
+/**
+ * Memoize the value as the most recently used.
+ *
+ * @param object  A value
+ * @param key     A key. It is copied.
+ * @return If a value is evicted, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)setObject:(id _Nonnull)object forKey:(id<NSCopying> _Nonnull)key
+{
+    NSNumber* existingSlot = _slotsByKey[key];
+    if (existingSlot) {
+        // NOTE: Other threads may have memoized the value after the lookup failed.
+        return NO;
+    }
+
+    NSUInteger slot;
+    BOOL evicted = NO;
+    if (_count < _capacity) {
+        slot = _count++;
+    } else if (_tracksRecency) {
+        slot = _tail;
+        [self unlinkSlot:slot];
+        [_slotsByKey removeObjectForKey:_keys[slot]];
+        evicted = YES;
+    } else {
+        return NO;
+    }
+
+    key = [(id)key copy];
+    _keys[slot] = key;
+    _objects[slot] = object;
+    _slotsByKey[key] = @(slot);
+    if (_tracksRecency) {
+        [self linkSlotToHead:slot];
+    }
+    return evicted;
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Mark the slot as the most recently used.
+ *
+ * @param slot  A linked slot
+ */
+- (void)moveSlotToHead:(NSUInteger)slot
+{
+    if (slot != _head) {
+        [self unlinkSlot:slot];
+        [self linkSlotToHead:slot];
+    }
+}
+
+/**
+ * Remove the slot from the list.
+ *
+ * @param slot  A linked slot
+ */
+- (void)unlinkSlot:(NSUInteger)slot
+{
+    MAEMemoSlot* s = &_slots[slot];
+    if (s->previous != NSNotFound) {
+        _slots[s->previous].next = s->next;
+    } else {
+        _head = s->next;
+    }
+    if (s->next != NSNotFound) {
+        _slots[s->next].previous = s->previous;
+    } else {
+        _tail = s->previous;
+    }
+}
+
+/**
+ * Insert the slot at the head of the list.
+ *
+ * @param slot  A slot that is not linked
+ */
+- (void)linkSlotToHead:(NSUInteger)slot
+{
+    _slots[slot].previous = NSNotFound;
+    _slots[slot].next = _head;
+    if (_head != NSNotFound) {
+        _slots[_head].previous = slot;
+    }
+    _head = slot;
+    if (_tail == NSNotFound) {
+        _tail = slot;
+    }
+}
+
+@end
+
+@interface MAEMemoizingTransformer ()
+@property (nonatomic, nonnull, strong, readwrite) NSValueTransformer* transformer;
+@property (nonatomic, assign, readwrite) NSUInteger capacity;
+@property (nonatomic, assign, readwrite) MAEMemoizationEviction eviction;
+@end
+
+@implementation MAEMemoizingTransformer {
+    MAEMemo* _forwardMemo;
+    MAEMemo* _reverseMemo;
+    MAEMemoizationStatistics _statistics;
+    /// It guards the memos and the statistics.
+    pthread_mutex_t _lock;
+    BOOL _transformerHandlesError;
+    BOOL _transformerHandlesReverseError;
+    BOOL _transformerAllowsReverseTransformation;
+}
+
+#pragma mark - Lifecycle
+
++ (void)initialize
+{
+    if (self == MAEMemoizingTransformer.class) {
+        MAEMemoizedNil = [NSObject new];
+    }
+}
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithTransformer:(NSValueTransformer* _Nonnull)transformer
+                                    capacity:(NSUInteger)capacity
+                                    eviction:(MAEMemoizationEviction)eviction
+{
+    NSParameterAssert(transformer != nil && capacity > 0);
+
+    if (self = [super init]) {
+        self.transformer = transformer;
+        self.capacity = capacity;
+        self.eviction = eviction;
+
+        BOOL tracksRecency = eviction == MAEMemoizationEvictionLeastRecentlyUsed;
+        _forwardMemo = [[MAEMemo alloc] initWithCapacity:capacity tracksRecency:tracksRecency];
+        _reverseMemo = [[MAEMemo alloc] initWithCapacity:capacity tracksRecency:tracksRecency];
+        _transformerHandlesError = [transformer respondsToSelector:@selector(transformedValue:success:error:)];
+        _transformerHandlesReverseError = [transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)];
+        _transformerAllowsReverseTransformation = [transformer.class allowsReverseTransformation];
+        pthread_mutex_init(&_lock, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark - Custom Accessor
+
+- (MAEMemoizationStatistics)statistics
+{
+    pthread_mutex_lock(&_lock);
+    MAEMemoizationStatistics statistics = _statistics;
+    statistics.count = _forwardMemo.count + _reverseMemo.count;
+    pthread_mutex_unlock(&_lock);
+    return statistics;
+}
+
+#pragma mark - NSValueTransformer (Override)
+
++ (Class _Nonnull)transformedValueClass
+{
+    return NSObject.class;
+}
+
++ (BOOL)allowsReverseTransformation
+{
+    return YES;
+}
+
+- (id _Nullable)transformedValue:(id _Nullable)value
+{
+    return [self transformedValue:value success:NULL error:NULL];
+}
+
+- (id _Nullable)reverseTransformedValue:(id _Nullable)value
+{
+    return [self reverseTransformedValue:value success:NULL error:NULL];
+}
+
+#pragma mark - MTLTransformerErrorHandling
+
+- (id _Nullable)transformedValue:(id _Nullable)value
+                         success:(BOOL* _Nullable)success
+                           error:(NSError* _Nullable* _Nullable)error
+{
+    return [self memoizedValueOf:value
+                          forKey:MAEForwardMemoKey(value)
+                          inMemo:_forwardMemo
+                         reverse:NO
+                         success:success
+                           error:error];
+}
+
+- (id _Nullable)reverseTransformedValue:(id _Nullable)value
+                                success:(BOOL* _Nullable)success
+                                  error:(NSError* _Nullable* _Nullable)error
+{
+    if (!_transformerAllowsReverseTransformation) {
+        // NOTE: The value is used as it is, in the same way as MAEArrayAdapter does for such transformers.
+        if (success) {
+            *success = YES;
+        }
+        return value;
+    }
+
+    return [self memoizedValueOf:value
+                          forKey:MAEReverseMemoKey(value)
+                          inMemo:_reverseMemo
+                         reverse:YES
+                         success:success
+                           error:error];
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Returns the memoized value of the key. If it is not memoized, transform the value and memoize the result.
+ *
+ * @param value    An input of the transformer
+ * @param key      A key of the value. If it is nil, the value is transformed without the memo.
+ * @param memo     The memo of the direction
+ * @param reverse  If it is YES, it transforms in reverse.
+ * @param success  If the transformation fails, NO is saved here.
+ * @param error    If the transformation fails, error information is saved here.
+ * @return A transformed value
+ */
+- (id _Nullable)memoizedValueOf:(id _Nullable)value
+                         forKey:(id _Nullable)key
+                         inMemo:(MAEMemo* _Nonnull)memo
+                        reverse:(BOOL)reverse
+                        success:(BOOL* _Nullable)success
+                          error:(NSError* _Nullable* _Nullable)error
+{
+    if (key) {
+        pthread_mutex_lock(&_lock);
+        id memoized = [memo objectForKey:key];
+        if (memoized) {
+            _statistics.hitCount++;
+        } else {
+            _statistics.missCount++;
+        }
+        pthread_mutex_unlock(&_lock);
+
+        if (memoized) {
+            if (success) {
+                *success = YES;
+            }
+            return memoized == MAEMemoizedNil ? nil : memoized;
+        }
+    }
+
+    // NOTE: It transforms outside the lock, so other threads are not blocked by an expensive transformer.
+    BOOL transformed = YES;
+    id result;
+    if (reverse) {
+        result = _transformerHandlesReverseError
+            ? [(id<MTLTransformerErrorHandling>)self.transformer reverseTransformedValue:value
+                                                                                  success:&transformed
+                                                                                    error:error]
+            : [self.transformer reverseTransformedValue:value];
+    } else {
+        result = _transformerHandlesError
+            ? [(id<MTLTransformerErrorHandling>)self.transformer transformedValue:value success:&transformed error:error]
+            : [self.transformer transformedValue:value];
+    }
+
+    if (key && transformed) {
+        pthread_mutex_lock(&_lock);
+        if ([memo setObject:result ?: MAEMemoizedNil forKey:key]) {
+            _statistics.evictionCount++;
+        }
+        pthread_mutex_unlock(&_lock);
+    }
+
+    if (success) {
+        *success = transformed;
+    }
+    return result;
+}
+
+@end
@@ -0,0 +1,96 @@
+//
+//  MAEMetricsRecorder.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayMetrics.h"
+#import <Foundation/Foundation.h>
+#import <stdatomic.h>
+
+/// The observer set by MAEArrayAdapter # setMetricsObserver:. It is NULL, if metrics are disabled.
+extern _Atomic(CFTypeRef) MAEActiveMetricsObserver;
+
+/**
+ * Replace the observer, and release the old observer after reports that may be using it have finished.
+ * It MUST NOT be called from the observer, because it waits for reports to the old observer.
+ *
+ * @param observer  An observer, or nil
+ */
+extern void MAEMetricsSetObserver(id<MAEArrayMetricsObserver> _Nullable observer);
+
+/**
+ * Returns the current observer. It is safe to use it after the observer is replaced.
+ *
+ * @return An observer, or nil
+ */
+extern id<MAEArrayMetricsObserver> _Nullable MAEMetricsCurrentObserver(void);
+
+/**
+ * Returns the monotonic time. The unit depends on the platform.
+ *
+ * @return A time
+ */
+extern uint64_t MAEMetricsNow(void);
+
+/**
+ * Report the phase that started at the time to the observer.
+ *
+ * @param start        The return value of MAEMetricsNow when the phase started
+ * @param phase        A phase
+ * @param modelClass   A model class
+ * @param propertyKey  A property key, if the phase is MAEArrayPhaseTransform.
+ */
+extern void MAEMetricsRecordPhase(uint64_t start, MAEArrayPhase phase, Class _Nonnull modelClass,
+                                  NSString* _Nullable propertyKey);
+
+/**
+ * Report the error to the observer.
+ * It MUST be called only if metrics are enabled.
+ *
+ * @param code  An error code
+ */
+extern void MAEMetricsRecordError(MAEErrorCode code);
+
+/**
+ * Returns YES if metrics are enabled.
+ * When metrics are disabled, it is the only cost of recording: one load and one predictable branch.
+ */
+static inline __attribute__((always_inline)) BOOL MAEMetricsEnabled(void)
+{
+    return __builtin_expect(atomic_load_explicit(&MAEActiveMetricsObserver, memory_order_acquire) != NULL, 0);
+}
+
+/**
+ * Returns the start time of a phase.
+ *
+ * usage:
+ *    uint64_t start = MAEMetricsStart();
+ *    // do something
+ *    MAEMetricsFinish(start, MAEArrayPhaseSeparate, modelClass, nil);
+ *
+ * @return If metrics are disabled, it returns 0. Otherwise, it returns the current time (> 0).
+ */
+static inline __attribute__((always_inline)) uint64_t MAEMetricsStart(void)
+{
+    return MAEMetricsEnabled() ? MAEMetricsNow() : 0;
+}
+
+/**
+ * Report the phase to the observer, if the phase was started while metrics are enabled.
+ *
+ * @param start        The return value of MAEMetricsStart
+ * @param phase        A phase
+ * @param modelClass   A model class
+ * @param propertyKey  A property key, if the phase is MAEArrayPhaseTransform.
+ */
+static inline __attribute__((always_inline)) void MAEMetricsFinish(uint64_t start, MAEArrayPhase phase,
+                                                                   Class _Nonnull modelClass,
+                                                                   NSString* _Nullable propertyKey)
+{
+    if (start) {
+        MAEMetricsRecordPhase(start, phase, modelClass, propertyKey);
+    }
+}
@@ -0,0 +1,129 @@
+//
+//  MAEMetricsRecorder.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEMetricsRecorder.h"
+#import <pthread.h>
+#import <sched.h>
+#import <time.h>
+#ifdef __APPLE__
+#import <mach/mach_time.h>
+#endif
+
+_Atomic(CFTypeRef) MAEActiveMetricsObserver = NULL;
+
+/// Readers of the observer are counted in the slot of the current epoch (the lowest bit of MAEMetricsEpoch).
+/// When the observer is replaced, the epoch is advanced and the old observer is released after the slot is drained.
+/// So new readers never delay the release.
+static _Atomic(NSUInteger) MAEMetricsEpoch = 0;
+static _Atomic(NSUInteger) MAEMetricsReaderCounts[2];
+/// It serializes replacements of the observer.
+static pthread_mutex_t MAEMetricsObserverLock = PTHREAD_MUTEX_INITIALIZER;
+
+#pragma mark - Functions
+
+/**
+ * Start reading the observer. The observer is not released until MAEMetricsEndReading is called.
+ *
+ * @return A slot that MUST be passed to MAEMetricsEndReading
+ */
+static NSUInteger MAEMetricsBeginReading(void)
+{
+    while (YES) {
+        NSUInteger epoch = atomic_load(&MAEMetricsEpoch);
+        atomic_fetch_add(&MAEMetricsReaderCounts[epoch & 1], 1);
+        // NOTE: If the epoch was advanced, the replacing thread may have already checked the slot.
+        if (atomic_load(&MAEMetricsEpoch) == epoch) {
+            return epoch & 1;
+        }
+        atomic_fetch_sub(&MAEMetricsReaderCounts[epoch & 1], 1);
+    }
+}
+
+/**
+ * Finish reading the observer.
+ *
+ * @param slot  The return value of MAEMetricsBeginReading
+ */
+static void MAEMetricsEndReading(NSUInteger slot)
+{
+    atomic_fetch_sub(&MAEMetricsReaderCounts[slot], 1);
+}
+
+extern void MAEMetricsSetObserver(id<MAEArrayMetricsObserver> _Nullable observer)
+{
+    pthread_mutex_lock(&MAEMetricsObserverLock);
+    CFTypeRef oldObserver = atomic_exchange(&MAEActiveMetricsObserver, observer ? CFBridgingRetain(observer) : NULL);
+    NSUInteger epoch = atomic_fetch_add(&MAEMetricsEpoch, 1);
+    // NOTE: Readers that may have loaded the old observer are counted in the slot of the previous epoch.
+    while (atomic_load(&MAEMetricsReaderCounts[epoch & 1]) > 0) {
+        sched_yield();
+    }
+    pthread_mutex_unlock(&MAEMetricsObserverLock);
+
+    if (oldObserver) {
+        CFRelease(oldObserver);
+    }
+}
+
+extern id<MAEArrayMetricsObserver> _Nullable MAEMetricsCurrentObserver(void)
+{
+    NSUInteger slot = MAEMetricsBeginReading();
+    id<MAEArrayMetricsObserver> observer = (__bridge id)atomic_load(&MAEActiveMetricsObserver);
+    MAEMetricsEndReading(slot);
+    return observer;
+}
+
+extern uint64_t MAEMetricsNow(void)
+{
+#ifdef __APPLE__
+    return mach_absolute_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NSEC_PER_SEC + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * Convert the difference of MAEMetricsNow to seconds.
+ *
+ * @param ticks  A difference of MAEMetricsNow
+ * @return Seconds
+ */
+static NSTimeInterval MAEMetricsSeconds(uint64_t ticks)
+{
+#ifdef __APPLE__
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+    return (NSTimeInterval)ticks * timebase.numer / timebase.denom / NSEC_PER_SEC;
+#else
+    return (NSTimeInterval)ticks / NSEC_PER_SEC;
+#endif
+}
+
+extern void MAEMetricsRecordPhase(uint64_t start, MAEArrayPhase phase, Class _Nonnull modelClass,
+                                  NSString* _Nullable propertyKey)
+{
+    NSTimeInterval duration = MAEMetricsSeconds(MAEMetricsNow() - start);
+    // NOTE: The observer may have been removed after the phase was started.
+    NSUInteger slot = MAEMetricsBeginReading();
+    id<MAEArrayMetricsObserver> observer = (__bridge id)atomic_load(&MAEActiveMetricsObserver);
+    [observer didFinishPhase:phase ofModelClass:modelClass propertyKey:propertyKey duration:duration];
+    MAEMetricsEndReading(slot);
+}
+
+extern void MAEMetricsRecordError(MAEErrorCode code)
+{
+    NSUInteger slot = MAEMetricsBeginReading();
+    id<MAEArrayMetricsObserver> observer = (__bridge id)atomic_load(&MAEActiveMetricsObserver);
+    [observer didFailWithErrorCode:code];
+    MAEMetricsEndReading(slot);
+}
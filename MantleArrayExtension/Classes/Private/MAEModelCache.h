@@ -0,0 +1,48 @@
+//
+//  MAEModelCache.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * A bounded cache of models keyed by record indexes.
+ * If it is full, the least recently used model is released. It is thread-safe.
+ */
+@interface MAEModelCache : NSObject
+
+/// The maximum number of models that the cache holds
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance.
+ *
+ * @param capacity  The maximum number of models that the cache holds
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithCapacity:(NSUInteger)capacity;
+
+#pragma mark - Public Methods
+
+/**
+ * Returns the model of the index, and marks it as the most recently used.
+ *
+ * @param index  A record index
+ * @return If it is not cached, it returns nil. Otherwise, it returns the model.
+ */
+- (id _Nullable)modelAtIndex:(NSUInteger)index;
+
+/**
+ * Add the model as the most recently used. If the cache is full, the least recently used model is released.
+ *
+ * @param model  A model
+ * @param index  A record index
+ */
+- (void)setModel:(id _Nonnull)model atIndex:(NSUInteger)index;
+
+@end
@@ -0,0 +1,162 @@
+//
+//  MAEModelCache.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEModelCache.h"
+#import <pthread.h>
+
+/**
+ * A slot of the cache. Slots are linked from the most recently used to the least recently used.
+ */
+typedef struct MAEModelCacheSlot {
+    NSUInteger index;
+    NSUInteger previous;
+    NSUInteger next;
+} MAEModelCacheSlot;
+
+@implementation MAEModelCache {
+    MAEModelCacheSlot* _slots;
+    __strong id* _models;
+    /// Slots for each record index (NSNumber -> NSNumber)
+    NSMutableDictionary<NSNumber*, NSNumber*>* _slotsByIndex;
+    NSUInteger _count;
+    /// The most recently used slot. It is NSNotFound, if the cache is empty.
+    NSUInteger _head;
+    /// The least recently used slot. It is NSNotFound, if the cache is empty.
+    NSUInteger _tail;
+    pthread_mutex_t _lock;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithCapacity:(NSUInteger)capacity
+{
+    NSParameterAssert(capacity > 0);
+
+    if (self = [super init]) {
+        _capacity = capacity;
+        _slots = calloc(capacity, sizeof(MAEModelCacheSlot));
+        _models = (__strong id*)calloc(capacity, sizeof(id));
+        _slotsByIndex = [NSMutableDictionary dictionaryWithCapacity:capacity];
+        _head = _tail = NSNotFound;
+        pthread_mutex_init(&_lock, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _capacity; i++) {
+        _models[i] = nil;
+    }
+    free(_models);
+    free(_slots);
+    pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark - Public Methods
+
+- (id _Nullable)modelAtIndex:(NSUInteger)index
+{
+    pthread_mutex_lock(&_lock);
+    NSNumber* slot = _slotsByIndex[@(index)];
+    id model = nil;
+    if (slot) {
+        [self moveSlotToHead:slot.unsignedIntegerValue];
+        model = _models[slot.unsignedIntegerValue];
+    }
+    pthread_mutex_unlock(&_lock);
+    return model;
+}
+
+- (void)setModel:(id _Nonnull)model atIndex:(NSUInteger)index
+{
+    NSParameterAssert(model != nil);
+
+    pthread_mutex_lock(&_lock);
+    NSNumber* existingSlot = _slotsByIndex[@(index)];
+    NSUInteger slot;
+    if (existingSlot) {
+        slot = existingSlot.unsignedIntegerValue;
+        [self moveSlotToHead:slot];
+    } else {
+        if (_count < _capacity) {
+            slot = _count++;
+        } else {
+            // NOTE: The least recently used slot is reused for the new model.
+            slot = _tail;
+            [self unlinkSlot:slot];
+            [_slotsByIndex removeObjectForKey:@(_slots[slot].index)];
+        }
+        _slots[slot].index = index;
+        _slotsByIndex[@(index)] = @(slot);
+        [self linkSlotToHead:slot];
+    }
+    _models[slot] = model;
+    pthread_mutex_unlock(&_lock);
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Mark the slot as the most recently used.
+ *
+ * @param slot  A linked slot
+ */
+- (void)moveSlotToHead:(NSUInteger)slot
+{
+    if (slot != _head) {
+        [self unlinkSlot:slot];
+        [self linkSlotToHead:slot];
+    }
+}
+
+/**
+ * Remove the slot from the list.
+ *
+ * @param slot  A linked slot
+ */
+- (void)unlinkSlot:(NSUInteger)slot
+{
+    MAEModelCacheSlot* s = &_slots[slot];
+    if (s->previous != NSNotFound) {
+        _slots[s->previous].next = s->next;
+    } else {
+        _head = s->next;
+    }
+    if (s->next != NSNotFound) {
+        _slots[s->next].previous = s->previous;
+    } else {
+        _tail = s->previous;
+    }
+}
+
+/**
+ * Insert the slot at the head of the list.
+ *
+ * @param slot  A slot that is not linked
+ */
+- (void)linkSlotToHead:(NSUInteger)slot
+{
+    _slots[slot].previous = NSNotFound;
+    _slots[slot].next = _head;
+    if (_head != NSNotFound) {
+        _slots[_head].previous = slot;
+    }
+    _head = slot;
+    if (_tail == NSNotFound) {
+        _tail = slot;
+    }
+}
+
+@end
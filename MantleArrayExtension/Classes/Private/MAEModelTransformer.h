@@ -0,0 +1,44 @@
+//
+//  MAEModelTransformer.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Mantle/MTLTransformerErrorHandling.h>
+
+@class MAEArrayAdapter;
+
+/**
+ * A transformer for converting between MAEArraySerializing model and NSString (or NSArray of NSString).
+ *
+ * It is returned by MAEArrayAdapter # stringTransformerWithArrayModelClass: and
+ * MAEArrayAdapter # variadicTransformerWithArrayModelClass:.
+ * MAEArrayAdapter recognizes it, and converts nested models from the fields of the parent record directly.
+ */
+@interface MAEModelTransformer : NSValueTransformer <MTLTransformerErrorHandling>
+
+/// MAEArraySerializing model class
+@property (nonatomic, nonnull, strong, readonly) Class modelClass;
+/// If it is YES, it converts between model and NSArray. Otherwise, it converts between model and NSString.
+@property (nonatomic, assign, readonly) BOOL variadic;
+/// The adapter of modelClass. It is looked up from the cache of adapters.
+@property (nonatomic, nonnull, strong, readonly) MAEArrayAdapter* adapter;
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance.
+ *
+ * @param adapterClass  MAEArrayAdapter or its subclass, that is used to resolve the adapter.
+ * @param modelClass    MAEArraySerializing model class
+ * @param variadic      Please refer to the property with the same name.
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithAdapterClass:(Class _Nonnull)adapterClass
+                                   modelClass:(Class _Nonnull)modelClass
+                                     variadic:(BOOL)variadic;
+
+@end
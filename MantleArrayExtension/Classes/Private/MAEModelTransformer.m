@@ -0,0 +1,129 @@
+//
+//  MAEModelTransformer.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEModelTransformer.h"
+#import "MAEArrayAdapter.h"
+#import "NSError+MAEErrorCode.h"
+
+@interface MAEModelTransformer ()
+@property (nonatomic, nonnull, strong) Class adapterClass;
+@property (nonatomic, nonnull, strong, readwrite) Class modelClass;
+@property (nonatomic, assign, readwrite) BOOL variadic;
+@end
+
+@implementation MAEModelTransformer
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nonnull)initWithAdapterClass:(Class _Nonnull)adapterClass
+                                   modelClass:(Class _Nonnull)modelClass
+                                     variadic:(BOOL)variadic
+{
+    NSParameterAssert(adapterClass != nil && modelClass != nil);
+
+    if (self = [super init]) {
+        self.adapterClass = adapterClass;
+        self.modelClass = modelClass;
+        self.variadic = variadic;
+    }
+    return self;
+}
+
+#pragma mark - Custom Accessor
+
+- (MAEArrayAdapter* _Nonnull)adapter
+{
+    // NOTE: It is not kept by the transformer, because the cache of adapters may be cleared.
+    //       A model may also have a property of its own class, so it can not be resolved in the initializer.
+    return [self.adapterClass adapterForModelClass:self.modelClass];
+}
+
+#pragma mark - NSValueTransformer (Override)
+
++ (BOOL)allowsReverseTransformation
+{
+    return YES;
+}
+
+- (id _Nullable)transformedValue:(id _Nullable)value
+{
+    return [self transformedValue:value success:NULL error:NULL];
+}
+
+- (id _Nullable)reverseTransformedValue:(id _Nullable)value
+{
+    return [self reverseTransformedValue:value success:NULL error:NULL];
+}
+
+#pragma mark - MTLTransformerErrorHandling
+
+- (id _Nullable)transformedValue:(id _Nullable)value
+                         success:(BOOL* _Nullable)success
+                           error:(NSError* _Nullable* _Nullable)error
+{
+    if (success) {
+        *success = YES;
+    }
+    if (!value) {
+        return nil;
+    }
+
+    Class expectedClass = self.variadic ? NSArray.class : NSString.class;
+    if (![value isKindOfClass:expectedClass]) {
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"%s only support %@, but got %@", __FUNCTION__, expectedClass, [value class]),
+                     MAEErrorInputDataKey : value });
+        if (success) {
+            *success = NO;
+        }
+        return nil;
+    }
+
+    id model = self.variadic ? [self.adapter modelFromArray:value error:error]
+                             : [self.adapter modelFromString:value error:error];
+    if (success) {
+        *success = model != nil;
+    }
+    return model;
+}
+
+- (id _Nullable)reverseTransformedValue:(id _Nullable)value
+                                success:(BOOL* _Nullable)success
+                                  error:(NSError* _Nullable* _Nullable)error
+{
+    if (success) {
+        *success = YES;
+    }
+    if (!value) {
+        return nil;
+    }
+
+    if (!([value isKindOfClass:MTLModel.class] && [value conformsToProtocol:@protocol(MAEArraySerializing)])) {
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"%s only support MAEArraySerializing MTLModel, but got %@", __FUNCTION__, [value class]),
+                     MAEErrorInputDataKey : value });
+        if (success) {
+            *success = NO;
+        }
+        return nil;
+    }
+
+    // NOTE: The model may be an instance of another class (e.g. a subclass), so it uses the adapter of its class.
+    MAEArrayAdapter* adapter = [value isMemberOfClass:self.modelClass]
+        ? self.adapter
+        : [self.adapterClass adapterForModelClass:[value class]];
+    id result = self.variadic ? [adapter arrayFromModel:value error:error] : [adapter stringFromModel:value error:error];
+    if (success) {
+        *success = result != nil;
+    }
+    return result;
+}
+
+@end
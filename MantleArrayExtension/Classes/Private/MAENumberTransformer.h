@@ -0,0 +1,138 @@
+//
+//  MAENumberTransformer.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Mantle/MTLTransformerErrorHandling.h>
+
+typedef NS_ENUM(uint8_t, MAENumberType) {
+    MAENumberTypeSigned,
+    MAENumberTypeUnsigned,
+    MAENumberTypeFloating,
+};
+
+/**
+ * A number parsed from characters.
+ */
+typedef struct {
+    MAENumberType type;
+    union {
+        long long signedValue;
+        unsigned long long unsignedValue;
+        double floatingValue;
+    };
+} MAENumber;
+
+/**
+ * Parse a number from the string without locale.
+ *
+ * Integers are parsed as integers, if they are in the range of long long or unsigned long long.
+ * Otherwise, it is parsed as a floating point number. (e.g. "1.5", "-2e10")
+ * "NaN", "+∞" and "-∞" are parsed as floating point numbers that are not finite.
+ *
+ * @param string          A string
+ * @param floatPrecision  If it is YES, a floating point number is rounded to float precision.
+ * @param number          The parsed number is saved here.
+ * @return If the string is a valid number, it returns YES. Otherwise, it returns NO.
+ */
+extern BOOL MAEParseNumber(NSString* _Nonnull string, BOOL floatPrecision, MAENumber* _Nonnull number);
+
+/**
+ * Parse a number from UTF-8 bytes without locale.
+ * It has the same result as MAEParseNumber for the string of the bytes.
+ *
+ * @param bytes           UTF-8 bytes
+ * @param length          The number of bytes
+ * @param floatPrecision  If it is YES, a floating point number is rounded to float precision.
+ * @param number          The parsed number is saved here.
+ * @return If the bytes are a valid number, it returns YES. Otherwise, it returns NO.
+ */
+extern BOOL MAEParseNumberFromUTF8Bytes(const uint8_t* _Nonnull bytes, NSUInteger length, BOOL floatPrecision,
+                                        MAENumber* _Nonnull number);
+
+/// The size of buffer that MAEFormatNumber requires.
+#define MAENumberBufferLength 32
+
+/**
+ * Print the number without locale.
+ * Floating point numbers are printed by the shortest string that is parsed to the same value.
+ * Numbers that are not finite are printed as "NaN", "+∞" and "-∞" in the same way as NSNumberFormatter.
+ *
+ * @param number  A number
+ * @param buffer  A buffer that has MAENumberBufferLength bytes. The UTF-8 string is terminated by NUL.
+ * @return The length of the string in bytes
+ */
+extern NSUInteger MAEFormatNumber(NSNumber* _Nonnull number, char* _Nonnull buffer);
+
+/**
+ * Print the shortest string that is parsed to the same value, without locale.
+ * Values that are not finite are printed as "NaN", "+∞" and "-∞".
+ *
+ * @param value           A floating point number
+ * @param floatPrecision  If it is YES, the value is regarded as float.
+ * @param buffer          A buffer that has MAENumberBufferLength bytes. The UTF-8 string is terminated by NUL.
+ * @return The length of the string in bytes
+ */
+extern NSUInteger MAEFormatDouble(double value, BOOL floatPrecision, char* _Nonnull buffer);
+
+/**
+ * Print the integer in decimal, without locale.
+ *
+ * @param value       An integer
+ * @param isUnsigned  If it is YES, the bit pattern of the value is printed as unsigned.
+ * @param buffer      A buffer that has MAENumberBufferLength bytes. The string is terminated by NUL.
+ * @return The length of the string
+ */
+extern NSUInteger MAEFormatInt64(int64_t value, BOOL isUnsigned, char* _Nonnull buffer);
+
+/**
+ * It returns the same result as NSString # boolValue, without creating any object.
+ *
+ * @param string A string
+ * @return A bool value
+ */
+extern BOOL MAEBoolValue(NSString* _Nonnull string);
+
+/**
+ * It returns the same result as MAEBoolValue for the string of the bytes.
+ *
+ * @param bytes   UTF-8 bytes
+ * @param length  The number of bytes
+ * @return A bool value
+ */
+extern BOOL MAEBoolValueFromUTF8Bytes(const uint8_t* _Nonnull bytes, NSUInteger length);
+
+/**
+ * A transformer for converting between number and NSString without NSNumberFormatter.
+ *
+ * It does not depend on locale.
+ * Floating point numbers are printed by the shortest string that is parsed to the same value,
+ * and numbers that are not finite are converted from/to "NaN", "+∞" and "-∞".
+ */
+@interface MAENumberTransformer : NSValueTransformer <MTLTransformerErrorHandling>
+
+/// If it is YES, floating point numbers are parsed with float precision.
+@property (nonatomic, assign, readonly) BOOL floatPrecision;
+
+#pragma mark - Lifecycle
+
+/**
+ * Returns a shared transformer that parses floating point numbers with double precision.
+ *
+ * @return A transformer
+ */
++ (instancetype _Nonnull)numberTransformer;
+
+/**
+ * Returns a shared transformer that parses floating point numbers with float precision.
+ * It is used for float properties, because rounding to double and then float may differ from rounding to float.
+ *
+ * @return A transformer
+ */
++ (instancetype _Nonnull)floatTransformer;
+
+@end
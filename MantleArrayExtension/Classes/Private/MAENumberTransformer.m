@@ -0,0 +1,552 @@
+//
+//  MAENumberTransformer.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAENumberTransformer.h"
+#import <errno.h>
+#import <float.h>
+#import <locale.h>
+#import <math.h>
+#ifdef __APPLE__
+#import <xlocale.h>
+#endif
+
+/// Numbers shorter than this are copied to a stack buffer.
+static NSUInteger const MAEStackBufferLength = 64;
+
+/// Symbols of numbers that are not finite. They are the same as NSNumberFormatter, which numberTransformer used before.
+static const char* const MAENaNSymbol = "NaN";
+static const char* const MAEPositiveInfinitySymbol = "+\xE2\x88\x9E"; // +∞
+static const char* const MAENegativeInfinitySymbol = "-\xE2\x88\x9E"; // -∞
+
+#pragma mark - Functions
+
+/**
+ * Returns the C locale. It is used to make parsing and printing independent of the current locale.
+ */
+static locale_t _Nonnull MAECLocale(void)
+{
+    static locale_t locale;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        locale = newlocale(LC_ALL_MASK, "C", NULL);
+    });
+    return locale;
+}
+
+/**
+ * Parse a floating point number independent of the current locale.
+ *
+ * @param chars           A C string
+ * @param end             The end of the parsed characters is saved here, if it is not NULL.
+ * @param floatPrecision  If it is YES, it is parsed as float.
+ * @return A parsed value
+ */
+static inline double MAEStringToDouble(const char* _Nonnull chars, char* _Nullable* _Nullable end, BOOL floatPrecision)
+{
+#ifdef __APPLE__
+    return floatPrecision ? strtof_l(chars, end, MAECLocale()) : strtod_l(chars, end, MAECLocale());
+#else
+    // NOTE: strtof_l and snprintf_l are not available on all platforms (e.g. glibc),
+    //       so the C locale is set to the current thread while it is parsed.
+    locale_t oldLocale = uselocale(MAECLocale());
+    double value = floatPrecision ? strtof(chars, end) : strtod(chars, end);
+    uselocale(oldLocale);
+    return value;
+#endif
+}
+
+/**
+ * Print a floating point number with the precision independent of the current locale.
+ *
+ * @param buffer     A buffer that has MAENumberBufferLength bytes
+ * @param precision  The precision of %.*g. If it is negative, it is printed by %.0f.
+ * @param value      A value
+ * @return The number of printed characters
+ */
+static inline int MAEPrintDouble(char* _Nonnull buffer, int precision, double value)
+{
+#ifdef __APPLE__
+    return precision < 0 ? snprintf_l(buffer, MAENumberBufferLength, MAECLocale(), "%.0f", value)
+                         : snprintf_l(buffer, MAENumberBufferLength, MAECLocale(), "%.*g", precision, value);
+#else
+    locale_t oldLocale = uselocale(MAECLocale());
+    int length = precision < 0 ? snprintf(buffer, MAENumberBufferLength, "%.0f", value)
+                               : snprintf(buffer, MAENumberBufferLength, "%.*g", precision, value);
+    uselocale(oldLocale);
+    return length;
+#endif
+}
+
+/**
+ * Parse a symbol of a number that is not finite.
+ *
+ * @param bytes   UTF-8 bytes
+ * @param length  The number of bytes
+ * @param number  The parsed number is saved here.
+ * @return If the bytes are one of the symbols, it returns YES. Otherwise, it returns NO.
+ */
+static BOOL MAEParseNonFiniteSymbol(const uint8_t* _Nonnull bytes, NSUInteger length, MAENumber* _Nonnull number)
+{
+    double value;
+    if (length == strlen(MAENaNSymbol) && memcmp(bytes, MAENaNSymbol, length) == 0) {
+        value = NAN;
+    } else if (length == strlen(MAEPositiveInfinitySymbol) && memcmp(bytes, MAEPositiveInfinitySymbol, length) == 0) {
+        value = INFINITY;
+    } else if (length == strlen(MAENegativeInfinitySymbol) && memcmp(bytes, MAENegativeInfinitySymbol, length) == 0) {
+        value = -INFINITY;
+    } else {
+        return NO;
+    }
+    number->type = MAENumberTypeFloating;
+    number->floatingValue = value;
+    return YES;
+}
+
+/**
+ * Copy characters of the string to the buffer as a C string.
+ *
+ * @param string  A string
+ * @param buffer  A buffer. If the string is longer than the buffer, it allocates a new buffer.
+ * @param size    The size of buffer
+ * @return If the string contains only ASCII characters, it returns a C string. Otherwise, it returns NULL.
+ *         If it is not the buffer, it MUST be released by free.
+ */
+static char* _Nullable MAECopyASCIICharacters(NSString* _Nonnull string, char* _Nonnull buffer, NSUInteger size)
+{
+    NSUInteger length = string.length;
+    char* chars = length < size ? buffer : malloc(length + 1);
+
+    unichar characters[MAEStackBufferLength];
+    for (NSUInteger location = 0; location < length; location += MAEStackBufferLength) {
+        NSUInteger count = MIN(MAEStackBufferLength, length - location);
+        [string getCharacters:characters range:NSMakeRange(location, count)];
+        for (NSUInteger i = 0; i < count; i++) {
+            if (characters[i] == 0 || characters[i] >= 0x80) {
+                if (chars != buffer) {
+                    free(chars);
+                }
+                return NULL;
+            }
+            chars[location + i] = (char)characters[i];
+        }
+    }
+    chars[length] = '\0';
+    return chars;
+}
+
+/**
+ * Check the syntax of a decimal number. (e.g. "12", "-1.5", ".5", "1e-3")
+ * It does not accept spaces, hexadecimal, inf and nan, unlike strtod. (Symbols of them are parsed by MAEParseNonFiniteSymbol)
+ *
+ * @param chars      A C string
+ * @param isInteger  Whether the number is an integer is saved here.
+ * @return If it is a valid number, it returns YES. Otherwise, it returns NO.
+ */
+static BOOL MAEScanDecimal(const char* _Nonnull chars, BOOL* _Nonnull isInteger)
+{
+    const char* p = chars;
+    if (*p == '+' || *p == '-') {
+        p++;
+    }
+
+    NSUInteger digits = 0;
+    for (; *p >= '0' && *p <= '9'; p++) {
+        digits++;
+    }
+    *isInteger = digits > 0 && *p == '\0';
+
+    if (*p == '.') {
+        for (p++; *p >= '0' && *p <= '9'; p++) {
+            digits++;
+        }
+    }
+    if (digits == 0) {
+        return NO;
+    }
+
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        if (*p == '+' || *p == '-') {
+            p++;
+        }
+        if (!(*p >= '0' && *p <= '9')) {
+            return NO;
+        }
+        while (*p >= '0' && *p <= '9') {
+            p++;
+        }
+    }
+    return *p == '\0';
+}
+
+/**
+ * Copy UTF-8 bytes to the buffer as a C string.
+ *
+ * @param bytes   UTF-8 bytes
+ * @param length  The number of bytes
+ * @param buffer  A buffer. If the bytes are longer than the buffer, it allocates a new buffer.
+ * @param size    The size of buffer
+ * @return If the bytes contain only ASCII characters, it returns a C string. Otherwise, it returns NULL.
+ *         If it is not the buffer, it MUST be released by free.
+ */
+static char* _Nullable MAECopyASCIIBytes(const uint8_t* _Nonnull bytes, NSUInteger length, char* _Nonnull buffer,
+                                         NSUInteger size)
+{
+    for (NSUInteger i = 0; i < length; i++) {
+        if (bytes[i] == 0 || bytes[i] >= 0x80) {
+            return NULL;
+        }
+    }
+
+    char* chars = length < size ? buffer : malloc(length + 1);
+    memcpy(chars, bytes, length);
+    chars[length] = '\0';
+    return chars;
+}
+
+/**
+ * Parse a number from the C string.
+ *
+ * @param chars           A C string. If it is not the buffer, it is released.
+ * @param buffer          The stack buffer of the caller
+ * @param floatPrecision  If it is YES, a floating point number is rounded to float precision.
+ * @param number          The parsed number is saved here.
+ * @return If the string is a valid number, it returns YES. Otherwise, it returns NO.
+ */
+static BOOL MAEParseASCIICharacters(char* _Nonnull chars, const char* _Nonnull buffer, BOOL floatPrecision,
+                                    MAENumber* _Nonnull number)
+{
+    BOOL isInteger = NO, success = NO;
+    if (MAEScanDecimal(chars, &isInteger)) {
+        char* end;
+        if (isInteger) {
+            errno = 0;
+            long long signedValue = strtoll(chars, &end, 10);
+            if (errno == 0) {
+                number->type = MAENumberTypeSigned;
+                number->signedValue = signedValue;
+                success = YES;
+            } else if (chars[0] != '-') {
+                errno = 0;
+                unsigned long long unsignedValue = strtoull(chars, &end, 10);
+                if (errno == 0) {
+                    number->type = MAENumberTypeUnsigned;
+                    number->unsignedValue = unsignedValue;
+                    success = YES;
+                }
+            }
+        }
+
+        if (!success) {
+            // NOTE: ERANGE is also returned on underflow, so it only checks overflow.
+            double floatingValue = MAEStringToDouble(chars, &end, floatPrecision);
+            if (!isinf(floatingValue)) {
+                number->type = MAENumberTypeFloating;
+                number->floatingValue = floatingValue;
+                success = YES;
+            }
+        }
+    }
+
+    if (chars != buffer) {
+        free(chars);
+    }
+    return success;
+}
+
+extern BOOL MAEParseNumber(NSString* _Nonnull string, BOOL floatPrecision, MAENumber* _Nonnull number)
+{
+    NSCParameterAssert(string != nil);
+    NSCParameterAssert(number != NULL);
+
+    // NOTE: All symbols of numbers that are not finite have 2 or 3 characters.
+    NSUInteger length = string.length;
+    if ((length == 2 || length == 3) && ([string characterAtIndex:0] == 'N' || [string characterAtIndex:1] == 0x221E)) {
+        const char* utf8 = string.UTF8String;
+        return MAEParseNonFiniteSymbol((const uint8_t*)utf8, strlen(utf8), number);
+    }
+
+    char buffer[MAEStackBufferLength];
+    char* chars = MAECopyASCIICharacters(string, buffer, sizeof(buffer));
+    return chars && MAEParseASCIICharacters(chars, buffer, floatPrecision, number);
+}
+
+extern BOOL MAEParseNumberFromUTF8Bytes(const uint8_t* _Nonnull bytes, NSUInteger length, BOOL floatPrecision,
+                                        MAENumber* _Nonnull number)
+{
+    NSCParameterAssert(bytes != NULL || length == 0);
+    NSCParameterAssert(number != NULL);
+
+    if (MAEParseNonFiniteSymbol(bytes, length, number)) {
+        return YES;
+    }
+
+    char buffer[MAEStackBufferLength];
+    char* chars = MAECopyASCIIBytes(bytes, length, buffer, sizeof(buffer));
+    return chars && MAEParseASCIICharacters(chars, buffer, floatPrecision, number);
+}
+
+extern BOOL MAEBoolValue(NSString* _Nonnull string)
+{
+    NSCParameterAssert(string != nil);
+
+    NSUInteger length = string.length, i = 0;
+    while (i < length && ([string characterAtIndex:i] == ' ' || [string characterAtIndex:i] == '\t')) {
+        i++;
+    }
+    if (i < length && ([string characterAtIndex:i] == '+' || [string characterAtIndex:i] == '-')) {
+        i++;
+    }
+    while (i < length && [string characterAtIndex:i] == '0') {
+        i++;
+    }
+    if (i == length) {
+        return NO;
+    }
+
+    unichar c = [string characterAtIndex:i];
+    return c == 'Y' || c == 'y' || c == 'T' || c == 't' || (c >= '1' && c <= '9');
+}
+
+extern BOOL MAEBoolValueFromUTF8Bytes(const uint8_t* _Nonnull bytes, NSUInteger length)
+{
+    NSCParameterAssert(bytes != NULL || length == 0);
+
+    NSUInteger i = 0;
+    while (i < length && (bytes[i] == ' ' || bytes[i] == '\t')) {
+        i++;
+    }
+    if (i < length && (bytes[i] == '+' || bytes[i] == '-')) {
+        i++;
+    }
+    while (i < length && bytes[i] == '0') {
+        i++;
+    }
+    if (i == length) {
+        return NO;
+    }
+
+    uint8_t c = bytes[i];
+    return c == 'Y' || c == 'y' || c == 'T' || c == 't' || (c >= '1' && c <= '9');
+}
+
+extern NSUInteger MAEFormatDouble(double value, BOOL floatPrecision, char* _Nonnull buffer)
+{
+    NSCParameterAssert(buffer != NULL);
+
+    if (!isfinite(value)) {
+        const char* symbol = isnan(value) ? MAENaNSymbol : (value > 0 ? MAEPositiveInfinitySymbol : MAENegativeInfinitySymbol);
+        const NSUInteger length = strlen(symbol);
+        memcpy(buffer, symbol, length + 1);
+        return length;
+    }
+
+    int length = 0;
+    if (value == trunc(value) && fabs(value) < 0x1p53) {
+        // NOTE: %g uses an exponent for large integers, so integers are printed without it.
+        length = MAEPrintDouble(buffer, -1, value);
+    } else {
+        const int minDigits = floatPrecision ? FLT_DIG : DBL_DIG;
+        const int maxDigits = floatPrecision ? FLT_DECIMAL_DIG : DBL_DECIMAL_DIG;
+        for (int digits = minDigits; digits <= maxDigits; digits++) {
+            length = MAEPrintDouble(buffer, digits, value);
+            double parsedValue = MAEStringToDouble(buffer, NULL, floatPrecision);
+            if (floatPrecision ? (float)parsedValue == (float)value : parsedValue == value) {
+                break;
+            }
+        }
+    }
+    return (NSUInteger)length;
+}
+
+extern NSUInteger MAEFormatInt64(int64_t value, BOOL isUnsigned, char* _Nonnull buffer)
+{
+    NSCParameterAssert(buffer != NULL);
+
+    // NOTE: Digits are written from the end of a temporary buffer, because the length is unknown.
+    char digits[MAENumberBufferLength];
+    NSUInteger start = MAENumberBufferLength;
+    const BOOL negative = !isUnsigned && value < 0;
+    uint64_t magnitude = negative ? (uint64_t)0 - (uint64_t)value : (uint64_t)value;
+    do {
+        digits[--start] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (negative) {
+        digits[--start] = '-';
+    }
+
+    const NSUInteger length = MAENumberBufferLength - start;
+    memcpy(buffer, digits + start, length);
+    buffer[length] = '\0';
+    return length;
+}
+
+extern NSUInteger MAEFormatNumber(NSNumber* _Nonnull number, char* _Nonnull buffer)
+{
+    NSCParameterAssert(number != nil);
+    NSCParameterAssert(buffer != NULL);
+
+    switch (number.objCType[0]) {
+        case 'f':
+            return MAEFormatDouble(number.floatValue, YES, buffer);
+        case 'd':
+            return MAEFormatDouble(number.doubleValue, NO, buffer);
+        case 'C':
+        case 'S':
+        case 'I':
+        case 'L':
+        case 'Q':
+            return MAEFormatInt64((int64_t)number.unsignedLongLongValue, YES, buffer);
+        default:
+            return MAEFormatInt64(number.longLongValue, NO, buffer);
+    }
+}
+
+/**
+ * Create an error that is the same as the transformer created by MTLValueTransformer # mtl_transformerWithFormatter:forObjectClass:
+ */
+static NSError* _Nonnull MAEInvalidInputError(id _Nullable value, NSString* _Nonnull reason)
+{
+    NSMutableDictionary* userInfo = [NSMutableDictionary dictionary];
+    userInfo[NSLocalizedDescriptionKey] = NSLocalizedString(@"Could not convert number", @"");
+    userInfo[NSLocalizedFailureReasonErrorKey] = reason;
+    userInfo[MTLTransformerErrorHandlingInputValueErrorKey] = value;
+    return [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain
+                               code:MTLTransformerErrorHandlingErrorInvalidInput
+                           userInfo:userInfo];
+}
+
+@interface MAENumberTransformer ()
+@property (nonatomic, assign, readwrite) BOOL floatPrecision;
+@end
+
+@implementation MAENumberTransformer
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nonnull)initWithFloatPrecision:(BOOL)floatPrecision
+{
+    if (self = [super init]) {
+        self.floatPrecision = floatPrecision;
+    }
+    return self;
+}
+
++ (instancetype _Nonnull)numberTransformer
+{
+    static MAENumberTransformer* transformer = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        transformer = [[self alloc] initWithFloatPrecision:NO];
+    });
+    return transformer;
+}
+
++ (instancetype _Nonnull)floatTransformer
+{
+    static MAENumberTransformer* transformer = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        transformer = [[self alloc] initWithFloatPrecision:YES];
+    });
+    return transformer;
+}
+
+#pragma mark - NSValueTransformer (Override)
+
++ (Class _Nonnull)transformedValueClass
+{
+    return NSNumber.class;
+}
+
++ (BOOL)allowsReverseTransformation
+{
+    return YES;
+}
+
+- (id _Nullable)transformedValue:(id _Nullable)value
+{
+    return [self transformedValue:value success:NULL error:NULL];
+}
+
+- (id _Nullable)reverseTransformedValue:(id _Nullable)value
+{
+    return [self reverseTransformedValue:value success:NULL error:NULL];
+}
+
+#pragma mark - MTLTransformerErrorHandling
+
+- (id _Nullable)transformedValue:(id _Nullable)value
+                         success:(BOOL* _Nullable)success
+                           error:(NSError* _Nullable* _Nullable)error
+{
+    if (success) {
+        *success = YES;
+    }
+    if (!value) {
+        return nil;
+    }
+
+    MAENumber number;
+    if (![value isKindOfClass:NSString.class]) {
+        if (error) {
+            *error = MAEInvalidInputError(value, [NSString stringWithFormat:@"Expected an NSString as input, got: %@.", value]);
+        }
+    } else if (!MAEParseNumber(value, self.floatPrecision, &number)) {
+        if (error) {
+            *error = MAEInvalidInputError(value, [NSString stringWithFormat:@"Could not convert String to NSNumber. Input: %@", value]);
+        }
+    } else {
+        switch (number.type) {
+            case MAENumberTypeSigned:
+                return [NSNumber numberWithLongLong:number.signedValue];
+            case MAENumberTypeUnsigned:
+                return [NSNumber numberWithUnsignedLongLong:number.unsignedValue];
+            case MAENumberTypeFloating:
+                return self.floatPrecision ? [NSNumber numberWithFloat:(float)number.floatingValue]
+                                           : [NSNumber numberWithDouble:number.floatingValue];
+        }
+    }
+
+    if (success) {
+        *success = NO;
+    }
+    return nil;
+}
+
+- (id _Nullable)reverseTransformedValue:(id _Nullable)value
+                                success:(BOOL* _Nullable)success
+                                  error:(NSError* _Nullable* _Nullable)error
+{
+    if (success) {
+        *success = YES;
+    }
+    if (!value) {
+        return nil;
+    }
+
+    NSString* string = nil;
+    char buffer[MAENumberBufferLength];
+    NSUInteger length;
+    if ([value isKindOfClass:NSNumber.class] && (length = MAEFormatNumber(value, buffer)) > 0) {
+        string = [[NSString alloc] initWithBytes:buffer length:length encoding:NSUTF8StringEncoding];
+    }
+
+    if (!string) {
+        if (error) {
+            *error = MAEInvalidInputError(value, [NSString stringWithFormat:@"Could not convert NSNumber to String. Input: %@", value]);
+        }
+        if (success) {
+            *success = NO;
+        }
+    }
+    return string;
+}
+
+@end
@@ -0,0 +1,124 @@
+//
+//  MAEPropertyDecoder.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Returns whether the number can be set to a primitive property without wrapping around nor overflow.
+ * Both decoders and modelWithDictionary:error: use it, so that they accept the same numbers.
+ *
+ * @param number       A transformed value
+ * @param objCType     The first character of the type encoding of the property (e.g. 'i')
+ * @param propertyKey  A property key, that is used in the error
+ * @param error        If it return NO, error information is saved here.
+ * @return If it can be set, it returns YES. Otherwise, it returns NO with MAEErrorInvalidInputData.
+ */
+extern BOOL MAEValidateNumberRange(NSNumber* _Nonnull number, char objCType, NSString* _Nonnull propertyKey,
+                                   NSError* _Nullable* _Nullable error);
+
+/**
+ * A compiled step of decoding that sets a value of a fragment to a property.
+ *
+ * It resolves the setter IMP and the type of the property in advance.
+ * If the property is a primitive type and uses the default transformer, it parses the characters
+ * and calls the setter without boxing.
+ */
+@interface MAEPropertyDecoder : NSObject
+
+/// A property key
+@property (nonatomic, nonnull, copy, readonly) NSString* propertyKey;
+/// If it is YES, the decoder can parse UTF-8 bytes by decodeUTF8Bytes:length:intoModel: without creating a string.
+@property (nonatomic, assign, readonly) BOOL decodesUTF8Bytes;
+
+#pragma mark - Lifecycle
+
+/**
+ * Returns whether models of the class can be created by decoders instead of MTLModel # modelWithDictionary:error:.
+ *
+ * It returns NO, if the class overrides the initializer or KVC of MTLModel, or it has validation methods for keys.
+ * (Because these may change the value that is set to the property)
+ *
+ * @param modelClass    MAEArraySerializing model class
+ * @param propertyKeys  Property keys that are used in format
+ * @return If decoders can be used, it returns YES. Otherwise, it returns NO.
+ */
++ (BOOL)canDecodeModelClass:(Class _Nonnull)modelClass propertyKeys:(NSArray<NSString*>* _Nonnull)propertyKeys;
+
+/**
+ * Create a decoder.
+ *
+ * @param modelClass   MAEArraySerializing model class
+ * @param propertyKey  A property key
+ * @param transformer  A transformer of the property. If it is nil, the value is set as it is.
+ * @param variadic     Whether the fragment is variadic
+ * @return If the property could not be resolved, it returns nil. Otherwise, it returns an instance.
+ */
++ (instancetype _Nullable)decoderWithModelClass:(Class _Nonnull)modelClass
+                                    propertyKey:(NSString* _Nonnull)propertyKey
+                                    transformer:(NSValueTransformer* _Nullable)transformer
+                                       variadic:(BOOL)variadic;
+
+#pragma mark - Public Methods
+
+/**
+ * Transform the value and set it to the property of the model.
+ *
+ * It has the same result as transforming the value and setting it by MTLModel # initWithDictionary:error:.
+ * A number out of range of the primitive property fails with MAEErrorInvalidInputData. (Please refer to MAEValidateNumberRange)
+ * If the transformed value is nil, the property is not changed.
+ *
+ * @param value  A MAESeparatedString or an array of MAESeparatedString
+ * @param model  A model
+ * @param error  If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)decodeValue:(id _Nonnull)value
+          intoModel:(id _Nonnull)model
+              error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Set the value that has already been transformed to the property of the model.
+ * It is used if the value is transformed by the caller instead of the transformer of the decoder.
+ *
+ * @param value  A transformed value. If it is nil, the property is not changed.
+ * @param model  A model
+ * @param error  If it return NO, error information is saved here.
+ * @return If it is success, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)setTransformedValue:(id _Nullable)value
+                  intoModel:(id _Nonnull)model
+                      error:(NSError* _Nullable* _Nullable)error;
+
+/**
+ * Set the value of the property of the default model to the model.
+ * It is used to reset a model that is reused.
+ *
+ * @param model         A model
+ * @param defaultModel  A model that has default values (e.g. a model created by -init)
+ */
+- (void)resetValueInModel:(id _Nonnull)model toDefaultModel:(id _Nonnull)defaultModel;
+
+/**
+ * Parse UTF-8 bytes and set it to the property of the model.
+ * It is only available if decodesUTF8Bytes is YES.
+ *
+ * It has the same result as decodeValue:intoModel:error: for a valid value.
+ * If the bytes are invalid or out of range of the property, it does nothing and returns NO.
+ * Then please use decodeValue:intoModel:error:
+ * in order to get the same error as the transformer.
+ *
+ * @param bytes   UTF-8 bytes of the characters (Please refer to MAESeparatedString # characters)
+ * @param length  The number of bytes
+ * @param model   A model
+ * @return If it is set, it returns YES. Otherwise, it returns NO.
+ */
+- (BOOL)decodeUTF8Bytes:(const uint8_t* _Nonnull)bytes
+                 length:(NSUInteger)length
+              intoModel:(id _Nonnull)model;
+
+@end
@@ -0,0 +1,507 @@
+//
+//  MAEPropertyDecoder.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import "MAENumberTransformer.h"
+#import "MAEPropertyDecoder.h"
+#import "NSError+MAEErrorCode.h"
+#import <Mantle/EXTRuntimeExtensions.h>
+#import <float.h>
+#import <limits.h>
+#import <math.h>
+#import <objc/runtime.h>
+
+/// Types of property that decoders can set without boxing.
+static const char* const MAEPrimitiveTypes = "cCsSiIlLqQfdB";
+
+// NOTE: The number MUST be checked by MAENumberFitsType, because converting an out-of-range value may be undefined.
+#define MAE_NUMBER_AS(T, number)                                                             \
+    ((number)->type == MAENumberTypeSigned                                                   \
+         ? (T)(number)->signedValue                                                          \
+         : ((number)->type == MAENumberTypeUnsigned ? (T)(number)->unsignedValue             \
+                                                    : (T)(number)->floatingValue))
+
+#define MAE_CALL_SETTER(T, model, number) \
+    ((void (*)(id, SEL, T))self->_setterIMP)(model, self->_setter, MAE_NUMBER_AS(T, number))
+
+#pragma mark - Functions
+
+/**
+ * Returns whether the integral part of the value is in the range.
+ *
+ * @param value     A floating value
+ * @param minValue  The minimum value of an integer type
+ * @param maxValue  The maximum value of an integer type
+ * @return If the value can be converted to the integer type, it returns YES. Otherwise (including NaN), it returns NO.
+ */
+static inline BOOL MAEFloatingValueInRange(double value, double minValue, double maxValue)
+{
+    // NOTE: maxValue + 1 is a power of 2, so the comparison is exact even if maxValue is rounded by double.
+    double integralPart = trunc(value);
+    return integralPart >= minValue && integralPart < maxValue + 1.0;
+}
+
+/**
+ * Returns whether the signed value can be converted to the type without wrapping around.
+ *
+ * @param objCType  The first character of a type encoding in MAEPrimitiveTypes
+ * @param value     A signed value
+ * @return If it can be converted, it returns YES. Otherwise, it returns NO.
+ */
+static BOOL MAESignedValueFitsType(char objCType, long long value)
+{
+    switch (objCType) {
+        case 'c':
+            return value >= SCHAR_MIN && value <= SCHAR_MAX;
+        case 'C':
+            return value >= 0 && value <= UCHAR_MAX;
+        case 's':
+            return value >= SHRT_MIN && value <= SHRT_MAX;
+        case 'S':
+            return value >= 0 && value <= USHRT_MAX;
+        case 'i':
+            return value >= INT_MIN && value <= INT_MAX;
+        case 'I':
+            return value >= 0 && value <= UINT_MAX;
+        case 'l':
+            return value >= LONG_MIN && value <= LONG_MAX;
+        case 'L':
+            return value >= 0 && (unsigned long long)value <= ULONG_MAX;
+        case 'Q':
+            return value >= 0;
+        default:
+            return YES;
+    }
+}
+
+/**
+ * Returns whether the unsigned value can be converted to the type without wrapping around.
+ *
+ * @param objCType  The first character of a type encoding in MAEPrimitiveTypes
+ * @param value     An unsigned value
+ * @return If it can be converted, it returns YES. Otherwise, it returns NO.
+ */
+static BOOL MAEUnsignedValueFitsType(char objCType, unsigned long long value)
+{
+    switch (objCType) {
+        case 'c':
+            return value <= SCHAR_MAX;
+        case 'C':
+            return value <= UCHAR_MAX;
+        case 's':
+            return value <= SHRT_MAX;
+        case 'S':
+            return value <= USHRT_MAX;
+        case 'i':
+            return value <= INT_MAX;
+        case 'I':
+            return value <= UINT_MAX;
+        case 'l':
+            return value <= LONG_MAX;
+        case 'L':
+            return value <= ULONG_MAX;
+        case 'q':
+            return value <= LLONG_MAX;
+        default:
+            return YES;
+    }
+}
+
+/**
+ * Returns whether the floating value can be converted to the type without overflow.
+ * Converting an out-of-range floating value to a narrower type is undefined behavior in C.
+ *
+ * @param objCType  The first character of a type encoding in MAEPrimitiveTypes
+ * @param value     A floating value
+ * @return If it can be converted, it returns YES. Otherwise, it returns NO.
+ */
+static BOOL MAEFloatingValueFitsType(char objCType, double value)
+{
+    switch (objCType) {
+        case 'c':
+            return MAEFloatingValueInRange(value, SCHAR_MIN, SCHAR_MAX);
+        case 'C':
+            return MAEFloatingValueInRange(value, 0, UCHAR_MAX);
+        case 's':
+            return MAEFloatingValueInRange(value, SHRT_MIN, SHRT_MAX);
+        case 'S':
+            return MAEFloatingValueInRange(value, 0, USHRT_MAX);
+        case 'i':
+            return MAEFloatingValueInRange(value, INT_MIN, INT_MAX);
+        case 'I':
+            return MAEFloatingValueInRange(value, 0, UINT_MAX);
+        case 'l':
+            return MAEFloatingValueInRange(value, (double)LONG_MIN, (double)LONG_MAX);
+        case 'L':
+            return MAEFloatingValueInRange(value, 0, (double)ULONG_MAX);
+        case 'q':
+            return MAEFloatingValueInRange(value, (double)LLONG_MIN, (double)LLONG_MAX);
+        case 'Q':
+            return MAEFloatingValueInRange(value, 0, (double)ULLONG_MAX);
+        case 'f':
+            return !isfinite(value) || fabs(value) <= FLT_MAX;
+        default:
+            return YES;
+    }
+}
+
+/**
+ * Returns whether the number can be converted to the type without wrapping around nor overflow.
+ *
+ * @param objCType  The first character of a type encoding in MAEPrimitiveTypes
+ * @param number    A number
+ * @return If it can be converted, it returns YES. Otherwise, it returns NO.
+ */
+static BOOL MAENumberFitsType(char objCType, const MAENumber* _Nonnull number)
+{
+    switch (number->type) {
+        case MAENumberTypeSigned:
+            return MAESignedValueFitsType(objCType, number->signedValue);
+        case MAENumberTypeUnsigned:
+            return MAEUnsignedValueFitsType(objCType, number->unsignedValue);
+        case MAENumberTypeFloating:
+            return MAEFloatingValueFitsType(objCType, number->floatingValue);
+    }
+    return YES;
+}
+
+/**
+ * Returns whether the number object can be set to the property of the type without wrapping around nor overflow.
+ *
+ * @param number    A number
+ * @param objCType  The first character of a type encoding in MAEPrimitiveTypes
+ * @return If it can be set, it returns YES. Otherwise, it returns NO.
+ */
+static BOOL MAENumberObjectFitsType(NSNumber* _Nonnull number, char objCType)
+{
+    MAENumber value;
+    switch (number.objCType[0]) {
+        case 'f':
+        case 'd':
+            value.type = MAENumberTypeFloating;
+            value.floatingValue = number.doubleValue;
+            break;
+        case 'C':
+        case 'S':
+        case 'I':
+        case 'L':
+        case 'Q':
+            value.type = MAENumberTypeUnsigned;
+            value.unsignedValue = number.unsignedLongLongValue;
+            break;
+        default:
+            value.type = MAENumberTypeSigned;
+            value.signedValue = number.longLongValue;
+            break;
+    }
+    return MAENumberFitsType(objCType, &value);
+}
+
+/**
+ * Save the error that the value is out of range of the property.
+ *
+ * @param error        Error information is saved here.
+ * @param value        A value
+ * @param propertyKey  A property key
+ */
+static void MAESetOutOfRangeError(NSError* _Nullable* _Nullable error, id _Nonnull value, NSString* _Nonnull propertyKey)
+{
+    SET_ERROR(error, MAEErrorInvalidInputData,
+              @{ NSLocalizedFailureReasonErrorKey :
+                     format(@"%@ is out of range of the property %@", value, propertyKey) });
+}
+
+extern BOOL MAEValidateNumberRange(NSNumber* _Nonnull number, char objCType, NSString* _Nonnull propertyKey,
+                                   NSError* _Nullable* _Nullable error)
+{
+    NSCParameterAssert(number != nil);
+    NSCParameterAssert(propertyKey != nil);
+
+    if (MAENumberObjectFitsType(number, objCType)) {
+        return YES;
+    }
+    MAESetOutOfRangeError(error, number, propertyKey);
+    return NO;
+}
+
+typedef NS_ENUM(uint8_t, MAEParseMode) {
+    /// It uses the transformer.
+    MAEParseModeNone = 0,
+    /// It parses a number with MAEParseNumber.
+    MAEParseModeNumber,
+    /// It parses a bool with MAEBoolValue.
+    MAEParseModeBool,
+};
+
+@interface MAEPropertyDecoder ()
+@property (nonatomic, nonnull, copy, readwrite) NSString* propertyKey;
+@property (nonatomic, nullable, strong) NSValueTransformer* transformer;
+@end
+
+@implementation MAEPropertyDecoder {
+    /// The first character of the type encoding of the property.
+    char _objCType;
+    /// If the property is readonly, it is NULL and the value is set by KVC.
+    SEL _setter;
+    IMP _setterIMP;
+    MAEParseMode _parseMode;
+    BOOL _floatPrecision;
+    BOOL _transformerHandlesError;
+}
+
+#pragma mark - Lifecycle
+
++ (BOOL)canDecodeModelClass:(Class _Nonnull)modelClass propertyKeys:(NSArray<NSString*>* _Nonnull)propertyKeys
+{
+    NSParameterAssert(modelClass != nil);
+    NSParameterAssert(propertyKeys != nil);
+
+    if (![modelClass isSubclassOfClass:MTLModel.class]) {
+        return NO;
+    }
+
+    Class baseClass = MTLModel.class;
+    if ([modelClass methodForSelector:@selector(modelWithDictionary:error:)]
+            != [baseClass methodForSelector:@selector(modelWithDictionary:error:)]
+        || [modelClass instanceMethodForSelector:@selector(initWithDictionary:error:)]
+            != [baseClass instanceMethodForSelector:@selector(initWithDictionary:error:)]
+        || [modelClass instanceMethodForSelector:@selector(validateValue:forKey:error:)]
+            != [baseClass instanceMethodForSelector:@selector(validateValue:forKey:error:)]
+        || [modelClass instanceMethodForSelector:@selector(setValue:forKey:)]
+            != [baseClass instanceMethodForSelector:@selector(setValue:forKey:)]) {
+        return NO;
+    }
+
+    for (NSString* propertyKey in propertyKeys) {
+        if (propertyKey.length == 0) {
+            return NO;
+        }
+        NSString* selectorName = format(@"validate%@%@:error:",
+                                        [propertyKey substringToIndex:1].uppercaseString,
+                                        [propertyKey substringFromIndex:1]);
+        if ([modelClass instancesRespondToSelector:NSSelectorFromString(selectorName)]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
++ (instancetype _Nullable)decoderWithModelClass:(Class _Nonnull)modelClass
+                                    propertyKey:(NSString* _Nonnull)propertyKey
+                                    transformer:(NSValueTransformer* _Nullable)transformer
+                                       variadic:(BOOL)variadic
+{
+    NSParameterAssert(modelClass != nil);
+    NSParameterAssert(propertyKey != nil);
+
+    objc_property_t property = class_getProperty(modelClass, propertyKey.UTF8String);
+    if (!property) {
+        return nil;
+    }
+
+    MAEPropertyDecoder* decoder = [self new];
+    decoder.propertyKey = propertyKey;
+    decoder.transformer = transformer;
+    decoder->_transformerHandlesError = [transformer respondsToSelector:@selector(transformedValue:success:error:)];
+
+    mtl_propertyAttributes* attributes = mtl_copyPropertyAttributes(property);
+    const char* type = attributes->type;
+    BOOL isSimpleType = type[0] != '\0' && (type[1] == '\0' || type[0] == '@');
+    if (isSimpleType && (type[0] == '@' || strchr(MAEPrimitiveTypes, type[0]))) {
+        decoder->_objCType = type[0];
+        if (!attributes->readonly && attributes->setter && [modelClass instancesRespondToSelector:attributes->setter]) {
+            decoder->_setter = attributes->setter;
+            decoder->_setterIMP = [modelClass instanceMethodForSelector:attributes->setter];
+        }
+    }
+    free(attributes);
+
+    if (decoder->_setterIMP && decoder->_objCType != '@' && !variadic) {
+        if ([transformer isKindOfClass:MAENumberTransformer.class]) {
+            decoder->_parseMode = MAEParseModeNumber;
+            decoder->_floatPrecision = ((MAENumberTransformer*)transformer).floatPrecision;
+        } else if (transformer == [MAEArrayAdapter boolTransformer]) {
+            decoder->_parseMode = MAEParseModeBool;
+        }
+    }
+    return decoder;
+}
+
+#pragma mark - Public Methods
+
+- (BOOL)decodesUTF8Bytes
+{
+    return _parseMode != MAEParseModeNone;
+}
+
+- (BOOL)decodeValue:(id _Nonnull)value
+          intoModel:(id _Nonnull)model
+              error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(value != nil);
+    NSParameterAssert(model != nil);
+
+    if (_parseMode == MAEParseModeBool) {
+        MAENumber number = { .type = MAENumberTypeSigned, .signedValue = MAEBoolValue(value) };
+        [self setNumber:&number intoModel:model];
+        return YES;
+    } else if (_parseMode == MAEParseModeNumber) {
+        MAENumber number;
+        if (MAEParseNumber(value, _floatPrecision, &number)) {
+            if ([self setNumber:&number intoModel:model]) {
+                return YES;
+            }
+            MAESetOutOfRangeError(error, value, self.propertyKey);
+            return NO;
+        }
+        // NOTE: It uses the transformer in order to create the same error.
+    }
+
+    BOOL success = YES;
+    if (_transformerHandlesError) {
+        value = [(id<MTLTransformerErrorHandling>)self.transformer transformedValue:value success:&success error:error];
+        if (!success) {
+            return NO;
+        }
+    } else if (self.transformer) {
+        value = [self.transformer transformedValue:value];
+    }
+    return [self setTransformedValue:value intoModel:model error:error];
+}
+
+- (BOOL)setTransformedValue:(id _Nullable)value
+                  intoModel:(id _Nonnull)model
+                      error:(NSError* _Nullable* _Nullable)error
+{
+    NSParameterAssert(model != nil);
+
+    // NOTE: MTLModel # initWithDictionary: does not set the value that was removed from the dictionary,
+    //       and it sets nil instead of NSNull.
+    if (!value) {
+        return YES;
+    } else if ([value isEqual:NSNull.null]) {
+        value = nil;
+    } else if (_objCType != '@' && [value isKindOfClass:NSNumber.class]
+               && !MAEValidateNumberRange(value, _objCType, self.propertyKey, error)) {
+        return NO;
+    }
+
+    @try {
+        if (_objCType == '@' && _setterIMP) {
+            ((void (*)(id, SEL, id))_setterIMP)(model, _setter, value);
+        } else {
+            [model setValue:value forKey:self.propertyKey];
+        }
+    } @catch (NSException* exception) {
+#if DEBUG
+        @throw exception;
+#else
+        SET_ERROR(error, MAEErrorInvalidInputData,
+                  @{ NSLocalizedFailureReasonErrorKey :
+                         format(@"Caught exception setting key \"%@\" : %@", self.propertyKey, exception) });
+        return NO;
+#endif
+    }
+    return YES;
+}
+
+- (void)resetValueInModel:(id _Nonnull)model toDefaultModel:(id _Nonnull)defaultModel
+{
+    NSParameterAssert(model != nil);
+    NSParameterAssert(defaultModel != nil);
+
+    // NOTE: Default values of primitive types are usually 0, so boxing them does not allocate any object.
+    id value = [defaultModel valueForKey:self.propertyKey];
+    if (_objCType == '@' && _setterIMP) {
+        ((void (*)(id, SEL, id))_setterIMP)(model, _setter, value);
+    } else {
+        [model setValue:value forKey:self.propertyKey];
+    }
+}
+
+- (BOOL)decodeUTF8Bytes:(const uint8_t* _Nonnull)bytes
+                 length:(NSUInteger)length
+              intoModel:(id _Nonnull)model
+{
+    NSParameterAssert(bytes != NULL || length == 0);
+    NSParameterAssert(model != nil);
+    NSAssert(self.decodesUTF8Bytes, @"The decoder of %@ can not decode bytes", self.propertyKey);
+
+    MAENumber number;
+    if (_parseMode == MAEParseModeBool) {
+        number.type = MAENumberTypeSigned;
+        number.signedValue = MAEBoolValueFromUTF8Bytes(bytes, length);
+    } else if (!MAEParseNumberFromUTF8Bytes(bytes, length, _floatPrecision, &number)) {
+        return NO;
+    }
+    return [self setNumber:&number intoModel:model];
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Call the setter with the number that is converted to the type of the property.
+ *
+ * @param number  A number
+ * @param model   A model
+ * @return If the number is out of range of the type, it does nothing and returns NO. Otherwise, it returns YES.
+ */
+- (BOOL)setNumber:(const MAENumber* _Nonnull)number intoModel:(id _Nonnull)model
+{
+    if (!MAENumberFitsType(_objCType, number)) {
+        return NO;
+    }
+
+    switch (_objCType) {
+        case 'c':
+            MAE_CALL_SETTER(char, model, number);
+            break;
+        case 'C':
+            MAE_CALL_SETTER(unsigned char, model, number);
+            break;
+        case 's':
+            MAE_CALL_SETTER(short, model, number);
+            break;
+        case 'S':
+            MAE_CALL_SETTER(unsigned short, model, number);
+            break;
+        case 'i':
+            MAE_CALL_SETTER(int, model, number);
+            break;
+        case 'I':
+            MAE_CALL_SETTER(unsigned int, model, number);
+            break;
+        case 'l':
+            MAE_CALL_SETTER(long, model, number);
+            break;
+        case 'L':
+            MAE_CALL_SETTER(unsigned long, model, number);
+            break;
+        case 'q':
+            MAE_CALL_SETTER(long long, model, number);
+            break;
+        case 'Q':
+            MAE_CALL_SETTER(unsigned long long, model, number);
+            break;
+        case 'f':
+            MAE_CALL_SETTER(float, model, number);
+            break;
+        case 'd':
+            MAE_CALL_SETTER(double, model, number);
+            break;
+        case 'B':
+            MAE_CALL_SETTER(bool, model, number);
+            break;
+        default:
+            NSAssert(NO, @"Unsupported type %c", _objCType);
+            break;
+    }
+    return YES;
+}
+
+@end
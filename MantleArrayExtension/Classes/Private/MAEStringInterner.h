@@ -0,0 +1,42 @@
+//
+//  MAEStringInterner.h
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * A table that returns the same string instance for the same characters.
+ *
+ * It is keyed by raw bytes, so it does not create any object if the characters are found.
+ * It only grows, and it stops adding strings when it has maxCount strings. (High-cardinality fields)
+ * It is thread-safe, and lookups do not take any lock.
+ */
+@interface MAEStringInterner : NSObject
+
+#pragma mark - Lifecycle
+
+/**
+ * Create an instance.
+ *
+ * @param utf16     If it is YES, keys are UTF-16 characters (unichar). Otherwise, they are UTF-8 bytes.
+ * @param maxCount  The maximum number of strings that the table holds
+ * @return An instance
+ */
+- (instancetype _Nonnull)initWithUTF16:(BOOL)utf16 maxCount:(NSUInteger)maxCount;
+
+#pragma mark - Public Methods
+
+/**
+ * Returns the string of the bytes.
+ *
+ * @param bytes   UTF-8 bytes, or UTF-16 characters
+ * @param length  The number of bytes (not characters)
+ * @return If the bytes are not valid, it returns nil. Otherwise, it returns a string.
+ */
+- (NSString* _Nullable)stringWithBytes:(const void* _Nullable)bytes length:(NSUInteger)length;
+
+@end
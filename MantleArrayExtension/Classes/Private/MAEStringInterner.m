@@ -0,0 +1,152 @@
+//
+//  MAEStringInterner.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEStringInterner.h"
+#import <stdatomic.h>
+
+/**
+ * An entry of the table. It is immutable after it is published.
+ */
+typedef struct MAEInternedString {
+    uint64_t hash;
+    NSUInteger length;
+    /// A retained NSString
+    const void* _Nonnull string;
+    uint8_t bytes[];
+} MAEInternedString;
+
+#pragma mark - Functions
+
+/**
+ * Returns FNV-1a hash of the bytes.
+ *
+ * @param bytes   Bytes
+ * @param length  The number of bytes
+ * @return A hash value
+ */
+static inline uint64_t MAEHashBytes(const uint8_t* _Nullable bytes, NSUInteger length)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (NSUInteger i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+@implementation MAEStringInterner {
+    /// Open addressing slots. The number of slots is a power of 2, and more than twice maxCount.
+    _Atomic(MAEInternedString*)* _slots;
+    NSUInteger _capacity;
+    NSUInteger _maxCount;
+    atomic_size_t _count;
+    BOOL _utf16;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype _Nullable)init
+{
+    NSAssert(NO, @"%@ MUST be initialized with designated initializer", self.class);
+    return nil;
+}
+
+- (instancetype _Nonnull)initWithUTF16:(BOOL)utf16 maxCount:(NSUInteger)maxCount
+{
+    NSParameterAssert(maxCount > 0);
+
+    if (self = [super init]) {
+        _utf16 = utf16;
+        _maxCount = maxCount;
+        _capacity = 1;
+        while (_capacity < maxCount * 2) {
+            _capacity <<= 1;
+        }
+        _slots = calloc(_capacity, sizeof(*_slots));
+        atomic_init(&_count, 0);
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _capacity; i++) {
+        MAEInternedString* entry = atomic_load_explicit(&_slots[i], memory_order_relaxed);
+        if (entry) {
+            CFRelease(entry->string);
+            free(entry);
+        }
+    }
+    free(_slots);
+}
+
+#pragma mark - Public Methods
+
+- (NSString* _Nullable)stringWithBytes:(const void* _Nullable)bytes length:(NSUInteger)length
+{
+    NSParameterAssert(bytes != NULL || length == 0);
+
+    const uint64_t hash = MAEHashBytes(bytes, length);
+    const NSUInteger mask = _capacity - 1;
+    NSUInteger index = (NSUInteger)hash & mask;
+
+    for (NSUInteger probe = 0; probe < _capacity; probe++, index = (index + 1) & mask) {
+        MAEInternedString* entry = atomic_load_explicit(&_slots[index], memory_order_acquire);
+        if (!entry) {
+            NSString* string = [self newStringWithBytes:bytes length:length];
+            if (!string || atomic_load_explicit(&_count, memory_order_relaxed) >= _maxCount) {
+                return string;
+            }
+
+            MAEInternedString* newEntry = malloc(sizeof(MAEInternedString) + length);
+            newEntry->hash = hash;
+            newEntry->length = length;
+            newEntry->string = CFBridgingRetain(string);
+            if (length > 0) {
+                memcpy(newEntry->bytes, bytes, length);
+            }
+
+            MAEInternedString* expected = NULL;
+            if (atomic_compare_exchange_strong_explicit(&_slots[index], &expected, newEntry,
+                                                        memory_order_release, memory_order_acquire)) {
+                atomic_fetch_add_explicit(&_count, 1, memory_order_relaxed);
+                return string;
+            }
+            // NOTE: Another thread has published an entry to the slot, so it is compared instead.
+            CFRelease(newEntry->string);
+            free(newEntry);
+            entry = expected;
+        }
+
+        if (entry->hash == hash && entry->length == length && (length == 0 || memcmp(entry->bytes, bytes, length) == 0)) {
+            return (__bridge NSString*)entry->string;
+        }
+    }
+    return [self newStringWithBytes:bytes length:length];
+}
+
+#pragma mark - Private Methods
+
+/**
+ * Create a string of the bytes.
+ *
+ * @param bytes   UTF-8 bytes, or UTF-16 characters
+ * @param length  The number of bytes
+ * @return If the bytes are not valid, it returns nil. Otherwise, it returns a string.
+ */
+- (NSString* _Nullable)newStringWithBytes:(const void* _Nullable)bytes length:(NSUInteger)length
+{
+    if (length == 0) {
+        return @"";
+    }
+    if (_utf16) {
+        return [[NSString alloc] initWithCharacters:bytes length:length / sizeof(unichar)];
+    }
+    return [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+}
+
+@end
@@ -7,6 +7,7 @@
 //
 
 #import "MAEErrorCode.h"
+#import "MAEMetricsRecorder.h"
 #import <Foundation/Foundation.h>
 
 #define format(...) ([NSString stringWithFormat:__VA_ARGS__])
@@ -35,9 +36,30 @@
 
 @end
 
-static inline void SET_ERROR(NSError* _Nullable* _Nullable error, MAEErrorCode code, NSDictionary* _Nullable userInfo)
-{
-    if (error) {
-        *error = [NSError mae_errorWithMAEErrorCode:code userInfo:userInfo];
-    }
-}
+/// The failure that SET_ERROR records error codes into, on the current thread. It is NULL, unless failures are captured.
+extern __thread MAEFailure* _Nullable MAECapturedFailure;
+
+/**
+ * Record the error code, and create NSError if the error pointer is not NULL.
+ *
+ * It is a macro, so that the userInfo (and strings in it) is not evaluated if the error pointer is NULL.
+ *
+ * @param error  A pointer of NSError*. It may be NULL.
+ * @param code   Error code
+ * @param ...    An userInfo excluding LocalizedDescription
+ */
+#define SET_ERROR(error, code, ...)                                                     \
+    do {                                                                                \
+        NSError* _Nullable* _Nullable mae_errorPointer = (error);                       \
+        MAEErrorCode mae_errorCode = (code);                                            \
+        if (MAEMetricsEnabled()) {                                                      \
+            MAEMetricsRecordError(mae_errorCode);                                       \
+        }                                                                               \
+        if (MAECapturedFailure) {                                                       \
+            MAECapturedFailure->code = mae_errorCode;                                   \
+        }                                                                               \
+        if (mae_errorPointer) {                                                         \
+            *mae_errorPointer = [NSError mae_errorWithMAEErrorCode:mae_errorCode        \
+                                                          userInfo:(__VA_ARGS__)];      \
+        }                                                                               \
+    } while (0)
@@ -11,6 +11,8 @@
 NSString* _Nonnull const MAEErrorDomain = @"MAEErrorDomain";
 NSString* _Nonnull const MAEErrorInputDataKey = @"MAEErrorInputDataKey";
 
+__thread MAEFailure* _Nullable MAECapturedFailure = NULL;
+
 @implementation NSError (MAEErrorCode)
 
 #pragma mark - Lifecycle
@@ -53,6 +55,8 @@ NSString* _Nonnull const MAEErrorInputDataKey = @"MAEErrorInputDataKey";
             return @"The number of fragments is not allowed in format";
         case MAEErrorNoConversionTarget:
             return @"There is no target to convert";
+        case MAEErrorRejectedByFilter:
+            return @"The record was rejected by filters";
         default:
             return @"Unknown error";
     }
@@ -17,8 +17,17 @@ FOUNDATION_EXPORT const unsigned char MantleArrayExtensionVersionString[];
 // In this header, you should import all the public headers of your framework using statements like #import <MantleArrayExtension/PublicHeader.h>
 
 #import <MantleArrayExtension/MAEArrayAdapter.h>
+#import <MantleArrayExtension/MAEArrayFile.h>
+#import <MantleArrayExtension/MAEArrayMetrics.h>
+#import <MantleArrayExtension/MAEArrayReader.h>
+#import <MantleArrayExtension/MAEArrayWriter.h>
+#import <MantleArrayExtension/MAEColumnarBatch.h>
 #import <MantleArrayExtension/MAEErrorCode.h>
+#import <MantleArrayExtension/MAEField.h>
 #import <MantleArrayExtension/MAEFragment.h>
+#import <MantleArrayExtension/MAEModelPool.h>
 #import <MantleArrayExtension/MAERawFragment.h>
+#import <MantleArrayExtension/MAERecordFilter.h>
 #import <MantleArrayExtension/MAESeparatedString.h>
+#import <MantleArrayExtension/MAETokenizer.h>
 #import <MantleArrayExtension/NSArray+MAESeparatedString.h>
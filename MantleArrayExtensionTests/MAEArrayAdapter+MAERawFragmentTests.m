@@ -132,5 +132,63 @@ QuickSpecBegin(MAEArrayAdapter_MAERawFragmentTests)
             expect(error).to(beNil());
         });
     });
+
+    describe(@"interning", ^{
+        it(@"shares the same string between records", ^{
+            NSArray<MAETModelUsingRaw1*>* models = [MAEArrayAdapter modelsOfClass:MAETModelUsingRaw1.class
+                                                                       fromString:@"/command seek\n/command seek tail\n/command play"
+                                                                  recordSeparator:'\n'
+                                                                           errors:nil];
+            expect(@(models.count)).to(equal(@3));
+            expect(models[0].type).to(equal(@"seek"));
+            expect(models[1].type).to(beIdenticalTo(models[0].type));
+            expect(models[2].type).to(equal(@"play"));
+
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModelUsingRaw1.class];
+            NSData* data = [@"/command seek" dataUsingEncoding:NSUTF8StringEncoding];
+            MAETModelUsingRaw1* model1 = [adapter modelFromData:data error:nil];
+            MAETModelUsingRaw1* model2 = [adapter modelFromData:data error:nil];
+            expect(model1.type).to(equal(@"seek"));
+            expect(model2.type).to(beIdenticalTo(model1.type));
+        });
+
+        it(@"returns the same error as before, if the field is not a candidate", ^{
+            for (NSString* record in @[ @"/command stop", @"/command \"seek\"", @"/commands seek" ]) {
+                NSData* data = [record dataUsingEncoding:NSUTF8StringEncoding];
+                __block NSError* error = nil;
+                expect([MAEArrayAdapter modelOfClass:MAETModelUsingRaw1.class fromString:record error:&error]).to(beNil());
+                expect(error.code).to(equal(MAEErrorInvalidInputData));
+                error = nil;
+                expect([MAEArrayAdapter modelOfClass:MAETModelUsingRaw1.class fromData:data error:&error]).to(beNil());
+                expect(error.code).to(equal(MAEErrorInvalidInputData));
+            }
+        });
+    });
+
+    describe(@"modelFromString:failure:", ^{
+        it(@"returns the fragment and the field that is not a candidate", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModelUsingRaw1.class];
+            NSArray<NSArray*>* cases = @[
+                @[ @"/command stop", @1, @9, @4 ],
+                @[ @"/commands seek", @0, @0, @9 ],
+                @[ @"/command seek last", @2, @14, @4 ],
+            ];
+            for (NSArray* c in cases) {
+                NSData* data = [c[0] dataUsingEncoding:NSUTF8StringEncoding];
+                MAEFailure failure;
+                expect([adapter modelFromString:c[0] failure:&failure]).to(beNil());
+                expect(@(failure.code)).to(equal(@(MAEErrorInvalidInputData)));
+                expect(@(failure.fragmentIndex)).to(equal(c[1]));
+                expect(@(failure.range.location)).to(equal(c[2]));
+                expect(@(failure.range.length)).to(equal(c[3]));
+
+                failure = (MAEFailure){};
+                expect([adapter modelFromUTF8Bytes:data.bytes length:data.length failure:&failure]).to(beNil());
+                expect(@(failure.code)).to(equal(@(MAEErrorInvalidInputData)));
+                expect(@(failure.fragmentIndex)).to(equal(c[1]));
+                expect(@(failure.range.location)).to(equal(c[2]));
+            }
+        });
+    });
 }
 QuickSpecEnd
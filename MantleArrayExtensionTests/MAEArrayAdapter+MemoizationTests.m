@@ -0,0 +1,164 @@
+//
+//  MAEArrayAdapter+MemoizationTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import <Mantle/MTLValueTransformer.h>
+
+static NSUInteger MAETMemoizedTransformCount = 0;
+
+@interface MAETMemoizedModel : MTLModel <MAEArraySerializing>
+@property (nonatomic, nullable, copy) NSString* code;
+@property (nonatomic, nullable, copy) NSString* label;
+@property (nonatomic, nullable, strong) NSNumber* amount;
+@end
+
+@implementation MAETMemoizedModel
+
+#pragma mark - MAEArraySerializing
+
++ (NSArray* _Nonnull)formatByPropertyKey
+{
+    return @[ @"code", @"label", MAEOptional(@"amount") ];
+}
+
++ (NSValueTransformer* _Nonnull)codeArrayTransformer
+{
+    return [MTLValueTransformer
+        transformerUsingForwardBlock:^id(NSString* value, BOOL* success, NSError** error) {
+            MAETMemoizedTransformCount++;
+            if ([value isEqualToString:@"ng"]) {
+                *success = NO;
+                return nil;
+            }
+            return value.uppercaseString;
+        }
+        reverseBlock:^id(NSString* value, BOOL* success, NSError** error) {
+            MAETMemoizedTransformCount++;
+            return value.lowercaseString;
+        }];
+}
+
++ (NSValueTransformer* _Nonnull)amountArrayTransformer
+{
+    return [MTLValueTransformer
+        transformerUsingForwardBlock:^id(NSString* value, BOOL* success, NSError** error) {
+            return @(value.doubleValue);
+        }
+        reverseBlock:^id(NSNumber* value, BOOL* success, NSError** error) {
+            return strcmp(value.objCType, @encode(double)) == 0 ? [NSString stringWithFormat:@"%.1f", value.doubleValue]
+                                                                : value.stringValue;
+        }];
+}
+
++ (NSUInteger)memoizationCapacityForKey:(NSString* _Nonnull)key
+{
+    return [key isEqualToString:@"label"] ? 0 : 2;
+}
+
+@end
+
+@interface MAETMemoizedModel2 : MAETMemoizedModel
+@end
+
+@implementation MAETMemoizedModel2
+
++ (MAEMemoizationEviction)memoizationEvictionForKey:(NSString* _Nonnull)key
+{
+    return MAEMemoizationEvictionNone;
+}
+
+@end
+
+@interface MAEArrayAdapter ()
+- (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass;
+@end
+
+QuickSpecBegin(MAEArrayAdapter_MemoizationTests)
+{
+    beforeEach(^{
+        MAETMemoizedTransformCount = 0;
+    });
+
+    describe(@"memoizationCapacityForKey:", ^{
+        it(@"transforms the same field only once", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter alloc] initWithModelClass:MAETMemoizedModel.class];
+            MAETMemoizedModel* model1 = [adapter modelFromString:@"abc,x" error:nil];
+            MAETMemoizedModel* model2 = [adapter modelFromString:@"abc,y" error:nil];
+            expect(model1.code).to(equal(@"ABC"));
+            expect(model2.code).to(equal(@"ABC"));
+            expect(model2.label).to(equal(@"y"));
+            expect(@(MAETMemoizedTransformCount)).to(equal(@1));
+
+            MAEMemoizationStatistics statistics = [adapter memoizationStatisticsForPropertyKey:@"code"];
+            expect(@(statistics.hitCount)).to(equal(@1));
+            expect(@(statistics.missCount)).to(equal(@1));
+            expect(@(statistics.count)).to(equal(@1));
+        });
+
+        it(@"memoizes by the original characters of fields", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter alloc] initWithModelClass:MAETMemoizedModel.class];
+            expect([[adapter modelFromString:@"abc,x" error:nil] code]).to(equal(@"ABC"));
+            expect([[adapter modelFromString:@"'abc',x" error:nil] code]).to(equal(@"ABC"));
+            expect(@(MAETMemoizedTransformCount)).to(equal(@2));
+        });
+
+        it(@"memoizes reverse transformations by values", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter alloc] initWithModelClass:MAETMemoizedModel.class];
+            MAETMemoizedModel* model = [adapter modelFromString:@"abc,x" error:nil];
+            expect([adapter stringFromModel:model error:nil]).to(equal(@"abc,x"));
+            expect([adapter stringFromModel:model error:nil]).to(equal(@"abc,x"));
+            expect(@(MAETMemoizedTransformCount)).to(equal(@2));
+        });
+
+        it(@"memoizes reverse transformations of numbers by their types", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter alloc] initWithModelClass:MAETMemoizedModel.class];
+            MAETMemoizedModel* model = [adapter modelFromString:@"abc,x" error:nil];
+            model.amount = @1;
+            expect([adapter stringFromModel:model error:nil]).to(equal(@"abc,x,1"));
+            model.amount = @1.0;
+            expect([adapter stringFromModel:model error:nil]).to(equal(@"abc,x,1.0"));
+            model.amount = @1;
+            expect([adapter stringFromModel:model error:nil]).to(equal(@"abc,x,1"));
+            expect(@([adapter memoizationStatisticsForPropertyKey:@"amount"].hitCount)).to(equal(@1));
+        });
+
+        it(@"does not memoize failed transformations", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter alloc] initWithModelClass:MAETMemoizedModel.class];
+            expect([adapter modelFromString:@"ng,x" error:nil]).to(beNil());
+            expect([adapter modelFromString:@"ng,x" error:nil]).to(beNil());
+            expect(@(MAETMemoizedTransformCount)).to(equal(@2));
+            expect(@([adapter memoizationStatisticsForPropertyKey:@"code"].count)).to(equal(@0));
+        });
+
+        it(@"evicts the least recently used value", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter alloc] initWithModelClass:MAETMemoizedModel.class];
+            for (NSString* code in @[ @"a", @"b", @"a", @"c", @"a", @"b" ]) {
+                [adapter modelFromString:[code stringByAppendingString:@",x"] error:nil];
+            }
+            MAEMemoizationStatistics statistics = [adapter memoizationStatisticsForPropertyKey:@"code"];
+            expect(@(statistics.hitCount)).to(equal(@2));
+            expect(@(statistics.missCount)).to(equal(@4));
+            expect(@(statistics.evictionCount)).to(equal(@2));
+            expect(@(statistics.count)).to(equal(@2));
+            expect(@([adapter memoizationStatisticsForPropertyKey:@"label"].missCount)).to(equal(@0));
+        });
+
+        it(@"does not memoize new values when it is full, if the eviction is none", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter alloc] initWithModelClass:MAETMemoizedModel2.class];
+            for (NSString* code in @[ @"a", @"b", @"c", @"c", @"a" ]) {
+                [adapter modelFromString:[code stringByAppendingString:@",x"] error:nil];
+            }
+            MAEMemoizationStatistics statistics = [adapter memoizationStatisticsForPropertyKey:@"code"];
+            expect(@(statistics.hitCount)).to(equal(@1));
+            expect(@(statistics.missCount)).to(equal(@4));
+            expect(@(statistics.evictionCount)).to(equal(@0));
+            expect(@(statistics.count)).to(equal(@2));
+        });
+    });
+}
+QuickSpecEnd
@@ -225,6 +225,41 @@ QuickSpecBegin(MAEArrayAdapter_TransformersTests)
             expect([transformer reverseTransformedValue:@(-DBL_DIG)]).to(equal([@(-DBL_DIG) stringValue]));
         });
 
+        it(@"converts floating point numbers to the shortest string that is parsed to the same value", ^{
+            expect([transformer reverseTransformedValue:@(0.1 + 0.2)]).to(equal(@"0.30000000000000004"));
+            expect([transformer transformedValue:@"0.30000000000000004"]).to(equal(@(0.1 + 0.2)));
+
+            expect([transformer reverseTransformedValue:@(DBL_MAX)]).to(equal(@"1.7976931348623157e+308"));
+            expect([transformer transformedValue:@"1.7976931348623157e+308"]).to(equal(@(DBL_MAX)));
+
+            expect([transformer reverseTransformedValue:@1e15]).to(equal(@"1000000000000000"));
+            expect([transformer reverseTransformedValue:@(-0.5e-10)]).to(equal(@"-5e-11"));
+            expect([transformer transformedValue:@".5"]).to(equal(@0.5));
+        });
+
+        it(@"can convert between numbers that are not finite and their symbols", ^{
+            expect([transformer reverseTransformedValue:@(NAN)]).to(equal(@"NaN"));
+            expect([transformer reverseTransformedValue:@(INFINITY)]).to(equal(@"+∞"));
+            expect([transformer reverseTransformedValue:@(-INFINITY)]).to(equal(@"-∞"));
+            expect([transformer reverseTransformedValue:@((float)-INFINITY)]).to(equal(@"-∞"));
+
+            expect(@(isnan([[transformer transformedValue:@"NaN"] doubleValue]))).to(beTrue());
+            expect([transformer transformedValue:@"+∞"]).to(equal(@(INFINITY)));
+            expect([transformer transformedValue:@"-∞"]).to(equal(@(-INFINITY)));
+            expect([transformer transformedValue:@"∞"]).to(beNil());
+            expect([transformer transformedValue:@"nan"]).to(beNil());
+        });
+
+        it(@"does not depend on locale", ^{
+            expect([transformer transformedValue:@"1,5"]).to(beNil());
+            expect([transformer transformedValue:@"1 000"]).to(beNil());
+            expect([transformer transformedValue:@" 1"]).to(beNil());
+            expect([transformer transformedValue:@"0x10"]).to(beNil());
+            expect([transformer transformedValue:@"inf"]).to(beNil());
+            expect([transformer transformedValue:@"1e400"]).to(beNil());
+            expect([transformer transformedValue:@"１"]).to(beNil());
+        });
+
         it(@"sets YES to success, when the conversion is successful", ^{
             __block BOOL success = NO;
             __block NSError* error = nil;
@@ -294,6 +329,12 @@ QuickSpecBegin(MAEArrayAdapter_TransformersTests)
             expect([transformer transformedValue:@""]).to(equal(NO));
         });
 
+        it(@"returns the same result as NSString # boolValue", ^{
+            for (NSString* str in @[ @"  +0001", @"-0", @"00", @"0.5", @"\tYes", @"no", @"+", @"9x", @"- 1" ]) {
+                expect([transformer transformedValue:str]).to(equal(@([str boolValue])));
+            }
+        });
+
         it(@"can convert to string of boolean from bool", ^{
             expect([transformer reverseTransformedValue:@YES]).to(equal(@"true"));
             expect([transformer reverseTransformedValue:@NO]).to(equal(@"false"));
@@ -351,5 +392,56 @@ QuickSpecBegin(MAEArrayAdapter_TransformersTests)
             expect(error.userInfo[MAEErrorInputDataKey]).to(equal(@"1"));
         });
     });
+
+    describe(@"nested models", ^{
+        NSString* string = @"x; \"a | b, c, d\"; true; 1; -2; 1.5; 2.5";
+
+        it(@"can convert models that are nested in three levels with different separators", ^{
+            __block NSError* error = nil;
+            MAETModel9* model;
+            expect(model = [MAEArrayAdapter modelOfClass:MAETModel9.class fromString:string error:&error]).notTo(beNil());
+            expect(error).to(beNil());
+            expect(model.name).to(equal(@"x"));
+            expect(model.model4.requireString).to(equal(@"a"));
+            expect(model.model4.model3.requireString).to(equal(@"b"));
+            expect(model.model4.model3.optionalString).to(equal(@"c"));
+            expect(model.model4.model3.variadicArray).to(equal(@[ @"d" ]));
+            expect(@(model.model1.b)).to(equal(@YES));
+            expect(@(model.model1.i)).to(equal(@(-2)));
+            expect(@(model.model1.d)).to(equal(@2.5));
+
+            NSData* data = [string dataUsingEncoding:NSUTF8StringEncoding];
+            expect([MAEArrayAdapter modelOfClass:MAETModel9.class fromData:data error:&error]).to(equal(model));
+            expect([MAEArrayAdapter modelOfClass:MAETModel9.class
+                                       fromArray:@[ @"x", @"a | b, c, d", @"true", @"1", @"-2", @"1.5", @"2.5" ]
+                                           error:&error])
+                .to(equal(model));
+        });
+
+        it(@"writes nested models into the same data as stringFromModel:error:", ^{
+            MAETModel9* model = [MAEArrayAdapter modelOfClass:MAETModel9.class fromString:string error:nil];
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel9.class];
+            NSMutableData* data = [NSMutableData data];
+            expect([adapter appendModel:model toData:data error:nil]).to(beTrue());
+
+            NSString* encoded = [adapter stringFromModel:model error:nil];
+            expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]).to(equal(encoded));
+            expect([adapter modelFromString:encoded error:nil]).to(equal(model));
+        });
+
+        it(@"returns the error of the nested model", ^{
+            __block NSError* error = nil;
+            expect([MAEArrayAdapter modelOfClass:MAETModel9.class
+                                      fromString:@"x; \"a | 'b\"; true; 1; -2; 1.5; 2.5"
+                                           error:&error])
+                .to(beNil());
+            expect(error.domain).to(equal(MAEErrorDomain));
+            expect(error.code).to(equal(MAEErrorInvalidInputData));
+
+            error = nil;
+            expect([MAEArrayAdapter modelOfClass:MAETModel9.class fromString:@"x; a; true; 1" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentCount));
+        });
+    });
 }
 QuickSpecEnd
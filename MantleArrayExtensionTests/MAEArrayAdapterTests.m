@@ -14,10 +14,14 @@
 #import <Mantle/NSValueTransformer+MTLPredefinedTransformerAdditions.h>
 
 @interface MAEArrayAdapter ()
+@property (nonatomic, nonnull, copy) NSArray<id<MAEFragment> >* formatByPropertyKey;
 - (instancetype _Nonnull)initWithModelClass:(Class _Nonnull)modelClass;
 - (NSArray<MAESeparatedString*>* _Nonnull)separateString:(NSString* _Nonnull)string;
 + (NSArray<MAEFragment*>* _Nullable)chooseFormatByPropertyKey:(NSArray<MAEFragment*>* _Nullable)fragments
                                                     withCount:(NSUInteger)count;
+@property (nonatomic, nullable, copy) NSArray* decoders;
+@property (nonatomic, nullable, copy) NSArray* decodersByCount;
+- (NSArray<id<MAEFragment> >* _Nullable)formatForCount:(NSUInteger)count;
 
 + (NSDictionary* _Nonnull)valueTransformersForModelClass:(Class _Nonnull)modelClass;
 + (NSValueTransformer* _Nullable)stringTransformerForObjCType:(const char* _Nonnull)objCType;
@@ -59,6 +63,434 @@ QuickSpecBegin(MAEArrayAdapterTests)
         });
     });
 
+    describe(@"adapterForModelClass:", ^{
+        it(@"returns the same adapter for the same class", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel1.class];
+            expect(adapter).notTo(beNil());
+            expect([MAEArrayAdapter adapterForModelClass:MAETModel1.class]).to(beIdenticalTo(adapter));
+            expect([MAEArrayAdapter adapterForModelClass:MAETModel2.class]).notTo(beIdenticalTo(adapter));
+        });
+
+        it(@"returns the same adapter, even if it called from multiple threads", ^{
+            NSMutableSet* adapters = [NSMutableSet set];
+            dispatch_apply(64, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t i) {
+                MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel3.class];
+                @synchronized(adapters)
+                {
+                    [adapters addObject:[NSValue valueWithNonretainedObject:adapter]];
+                }
+            });
+            expect(adapters.count).to(equal(1));
+        });
+
+        it(@"precomputes formats for each count", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel3.class];
+            NSArray<id<MAEFragment> >* format = adapter.formatByPropertyKey;
+            for (NSUInteger count = 0; count < format.count + 3; count++) {
+                NSArray* expected = [MAEArrayAdapter chooseFormatByPropertyKey:format withCount:count];
+                NSArray* got = [adapter formatForCount:count];
+                if (expected) {
+                    expect([got valueForKey:@"propertyName"]).to(equal([expected valueForKey:@"propertyName"]));
+                } else {
+                    expect(got).to(beNil());
+                }
+            }
+        });
+    });
+
+    describe(@"decoders", ^{
+        MAEArrayAdapter* (^adapterWithoutDecoders)(Class) = ^(Class modelClass) {
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter alloc] initWithModelClass:modelClass];
+            adapter.decoders = nil;
+            adapter.decodersByCount = nil;
+            return adapter;
+        };
+
+        it(@"are compiled, if the class does not customize initialization and validation of keys", ^{
+            expect([MAEArrayAdapter adapterForModelClass:MAETModel1.class].decodersByCount).notTo(beNil());
+            expect([MAEArrayAdapter adapterForModelClass:MAETModel3.class].decodersByCount).notTo(beNil());
+            expect([MAEArrayAdapter adapterForModelClass:MAETModel4.class].decodersByCount).notTo(beNil());
+            expect([MAEArrayAdapter adapterForModelClass:MAETModel7.class].decodersByCount).to(beNil());
+        });
+
+        it(@"returns the same models as modelWithDictionary:error:", ^{
+            NSArray<NSArray*>* inputs = @[
+                @[ MAETModel1.class, @[ @"true,48765123,-1389477961,-2.5,1.797693,-9437138961",
+                                        @"0,18446744073709551615,1.5,1e3,0.1",
+                                        @"t,-1,9223372036854775807,0.30000000000000004,-0",
+                                        @"true,1,2,x,4",
+                                        @"true,1",
+                                        @"true,18446744073709551616,1,2,3",
+                                        @"true,1,9223372036854775808,2,3",
+                                        @"true,1e20,1e19,2,3" ] ],
+                @[ MAETModel2.class, @[ @"a b \"c\"", @"a \"c\"", @"a b c" ] ],
+                @[ MAETModel3.class, @[ @"a, b, c, d", @"a", @"'a, b', \"c\"" ] ],
+                @[ MAETModel4.class, @[ @"x | a, b, c", @"x", @"x | 'a" ] ],
+                @[ MAETModel6.class, @[ @"http://example.com,true", @"http://example.com,false,e" ] ],
+            ];
+
+            for (NSArray* pair in inputs) {
+                Class modelClass = pair[0];
+                MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:modelClass];
+                MAEArrayAdapter* expectedAdapter = adapterWithoutDecoders(modelClass);
+
+                for (NSString* input in pair[1]) {
+                    NSError *error = nil, *expectedError = nil;
+                    id model = [adapter modelFromString:input error:&error];
+                    id expectedModel = [expectedAdapter modelFromString:input error:&expectedError];
+
+                    if (expectedModel) {
+                        expect(model).to(equal(expectedModel));
+                        expect(error).to(beNil());
+                    } else {
+                        expect(model).to(beNil());
+                        expect(error.domain).to(equal(expectedError.domain));
+                        expect(error.code).to(equal(expectedError.code));
+                    }
+                }
+            }
+        });
+
+        it(@"returns error, if a number is out of range of the property", ^{
+            for (NSString* input in @[ @"true,1e20,1,2,3", @"true,-1.5,1,2,3", @"true,1,-1e19,2,3", @"true,-1,1,2,3",
+                                       @"true,1,9223372036854775808,2,3" ]) {
+                __block NSError* error = nil;
+                expect([MAEArrayAdapter modelOfClass:MAETModel1.class fromString:input error:&error]).to(beNil());
+                expect(error.domain).to(equal(MAEErrorDomain));
+                expect(error.code).to(equal(MAEErrorInvalidInputData));
+            }
+
+            // NOTE: MAETModel7 is created by modelWithDictionary:error:, because it has a validation method.
+            for (NSString* input in @[ @"1e20", @"9223372036854775808" ]) {
+                __block NSError* error = nil;
+                expect([MAEArrayAdapter modelOfClass:MAETModel7.class fromString:input error:&error]).to(beNil());
+                expect(error.domain).to(equal(MAEErrorDomain));
+                expect(error.code).to(equal(MAEErrorInvalidInputData));
+            }
+
+            MAETModel1* model = [MAEArrayAdapter modelOfClass:MAETModel1.class fromString:@"true,1e3,-2.5e3,2,3" error:nil];
+            expect(model.ui).to(equal(1000));
+            expect(model.i).to(equal(-2500));
+        });
+
+        it(@"uses validation methods of keys, if the class has them", ^{
+            __block MAETModel7* model = nil;
+            expect(model = [MAEArrayAdapter modelOfClass:MAETModel7.class fromString:@"-5" error:nil]).notTo(beNil());
+            expect(model.count).to(equal(0));
+        });
+    });
+
+    describe(@"modelOfClass:fromData:error:", ^{
+        it(@"returns the same models as modelOfClass:fromString:error:", ^{
+            NSArray<NSArray*>* inputs = @[
+                @[ MAETModel1.class, @[ @"true,48765123,-1389477961,-2.5,1.797693,-9437138961", @"0,1,2,\"3\",4",
+                                        @"t,-1,9223372036854775807,0.30000000000000004,-0", @"true,1,2,x,4",
+                                        @"true,1,2,３,4", @"true,1" ] ],
+                @[ MAETModel2.class, @[ @"a b \"c\"", @"日本 語 \"c \\\" d\"", @"a b c", @"a \"c" ] ],
+                @[ MAETModel3.class, @[ @"a, b, c, d", @"a", @"'a, b', \"c\"", @"🍣 , 'it\\'s' ,x" ] ],
+                @[ MAETModel4.class, @[ @"x | a, b, c", @"x", @"x | 'a" ] ],
+                @[ MAETModel5.class, @[ @"x | a, b", @"" ] ],
+                @[ MAETModel6.class, @[ @"http://example.com,true", @"http://example.com,false,e" ] ],
+            ];
+
+            for (NSArray* pair in inputs) {
+                Class modelClass = pair[0];
+                for (NSString* input in pair[1]) {
+                    NSError *error = nil, *expectedError = nil;
+                    id model = [MAEArrayAdapter modelOfClass:modelClass
+                                                    fromData:[input dataUsingEncoding:NSUTF8StringEncoding]
+                                                       error:&error];
+                    id expectedModel = [MAEArrayAdapter modelOfClass:modelClass fromString:input error:&expectedError];
+
+                    if (expectedModel) {
+                        expect(model).to(equal(expectedModel));
+                        expect(error).to(beNil());
+                    } else {
+                        expect(model).to(beNil());
+                        expect(error.domain).to(equal(expectedError.domain));
+                        expect(error.code).to(equal(expectedError.code));
+                    }
+                }
+            }
+        });
+
+        it(@"returns error, if a field is not a valid UTF-8 string", ^{
+            const char bytes[] = "a \xff \"c\"";
+            __block NSError* error = nil;
+            expect([[MAEArrayAdapter adapterForModelClass:MAETModel2.class] modelFromUTF8Bytes:bytes
+                                                                                        length:strlen(bytes)
+                                                                                         error:&error])
+                .to(beNil());
+            expect(error.domain).to(equal(MAEErrorDomain));
+            expect(error.code).to(equal(MAEErrorInvalidInputData));
+
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromData:nil error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNilInputData));
+        });
+    });
+
+    describe(@"adapterWithOptions:", ^{
+        it(@"returns the receiver, if options are the same", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel7.class];
+            expect([adapter adapterWithOptions:MAEArrayAdapterOptionNone]).to(beIdenticalTo(adapter));
+        });
+
+        it(@"does not validate models, if MAEArrayAdapterSkipValidation is set", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel7.class];
+            MAEArrayAdapter* trustedAdapter = [adapter adapterWithOptions:MAEArrayAdapterSkipValidation];
+            expect(@(trustedAdapter.options)).to(equal(@(MAEArrayAdapterSkipValidation)));
+
+            __block NSError* error = nil;
+            expect([adapter modelFromString:@"101" error:&error]).to(beNil());
+            expect(error.code).to(equal(100));
+
+            __block MAETModel7* model = nil;
+            error = nil;
+            expect(model = [trustedAdapter modelFromString:@"101" error:&error]).notTo(beNil());
+            expect(error).to(beNil());
+            expect(model.count).to(equal(101));
+        });
+    });
+
+    describe(@"adapterProjectingKeys:", ^{
+        it(@"returns the receiver, if keys are the same", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel1.class];
+            expect([adapter adapterProjectingKeys:nil]).to(beIdenticalTo(adapter));
+
+            MAEArrayAdapter* projectedAdapter = [adapter adapterProjectingKeys:[NSSet setWithObject:@"i"]];
+            expect(projectedAdapter.projectedKeys).to(equal([NSSet setWithObject:@"i"]));
+            expect([projectedAdapter adapterProjectingKeys:[NSSet setWithObject:@"i"]]).to(beIdenticalTo(projectedAdapter));
+            expect([projectedAdapter adapterWithOptions:MAEArrayAdapterSkipValidation].projectedKeys)
+                .to(equal([NSSet setWithObject:@"i"]));
+        });
+
+        it(@"converts only projected properties, and does not validate other fields", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter adapterForModelClass:MAETModel1.class]
+                adapterProjectingKeys:[NSSet setWithObjects:@"i", @"n", nil]];
+
+            __block MAETModel1* model = nil;
+            __block NSError* error = nil;
+            NSString* string = @"YES,x,3,\"4.5\",5.5,6";
+            expect(model = [adapter modelFromString:string error:&error]).notTo(beNil());
+            expect(error).to(beNil());
+            expect(model.b).to(equal(NO));
+            expect(model.ui).to(equal(0));
+            expect(model.i).to(equal(3));
+            expect(model.f).to(equal(0));
+            expect(model.n).to(equal(@6));
+
+            expect(model = [adapter modelFromData:[string dataUsingEncoding:NSUTF8StringEncoding] error:&error])
+                .notTo(beNil());
+            expect(model.ui).to(equal(0));
+            expect(model.n).to(equal(@6));
+
+            expect(model = [adapter modelFromArray:@[ @"YES", @"x", @"3", @"4.5", @"5.5" ] error:&error]).notTo(beNil());
+            expect(model.i).to(equal(3));
+            expect(model.n).to(beNil());
+
+            expect([adapter modelFromString:@"1,2,3" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentCount));
+        });
+
+        it(@"resolves optional and variadic fields by the number of all fields", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter adapterForModelClass:MAETModel3.class]
+                adapterProjectingKeys:[NSSet setWithObject:@"variadicArray"]];
+
+            __block MAETModel3* model = nil;
+            expect(model = [adapter modelFromString:@"a, b, c, d" error:nil]).notTo(beNil());
+            expect(model.requireString).to(beNil());
+            expect(model.optionalString).to(beNil());
+            expect(model.variadicArray).to(equal(@[ @"c", @"d" ]));
+
+            expect(model = [adapter modelFromString:@"a" error:nil]).notTo(beNil());
+            expect(model.variadicArray).to(equal(@[]));
+        });
+    });
+
+    describe(@"interning", ^{
+        it(@"shares the same string of enumerate strings between records", ^{
+            id mock = OCMClassMock(MAETModel2.class);
+            OCMStub([mock formatByPropertyKey]).andReturn((@[ MAEEnum(@"a"), MAESingleQuoted(@"b"), MAEQuoted(@"c") ]));
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel2.class];
+
+            __block MAETModel2* model1 = nil;
+            __block MAETModel2* model2 = nil;
+            expect(model1 = [adapter modelFromString:@"play 'b' \"c\"" error:nil]).notTo(beNil());
+            expect(model2 = [adapter modelFromString:@"play 'b' \"c\"" error:nil]).notTo(beNil());
+            expect(model1.a).to(equal(@"play"));
+            expect(model2.a).to(beIdenticalTo(model1.a));
+
+            NSData* data = [@"日本 'b' \"c\"" dataUsingEncoding:NSUTF8StringEncoding];
+            expect(model1 = [adapter modelFromData:data error:nil]).notTo(beNil());
+            expect(model2 = [adapter modelFromData:data error:nil]).notTo(beNil());
+            expect(model1.a).to(equal(@"日本"));
+            expect(model2.a).to(beIdenticalTo(model1.a));
+
+            __block NSError* error = nil;
+            expect([adapter modelFromString:@"'play' 'b' \"c\"" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentType));
+            error = nil;
+            expect([adapter modelFromData:[@"'play' 'b' \"c\"" dataUsingEncoding:NSUTF8StringEncoding] error:&error])
+                .to(beNil());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentType));
+        });
+    });
+
+    describe(@"populateModel:fromString:error:", ^{
+        it(@"overwrites properties, and resets properties of absent fields", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel1.class];
+            MAETModel1* model = [MAETModel1 new];
+
+            __block NSError* error = nil;
+            expect(@([adapter populateModel:model fromString:@"true,1,2,3.5,4.5,6" error:&error])).to(beTrue());
+            expect(error).to(beNil());
+            expect(model).to(equal([adapter modelFromString:@"true,1,2,3.5,4.5,6" error:nil]));
+
+            expect(@([adapter populateModel:model fromString:@"false,7,8,9,10" error:&error])).to(beTrue());
+            expect(model).to(equal([adapter modelFromString:@"false,7,8,9,10" error:nil]));
+            expect(model.n).to(beNil());
+
+            NSData* data = [@"true,3,4,5,6,7" dataUsingEncoding:NSUTF8StringEncoding];
+            expect(@([adapter populateModel:model fromUTF8Bytes:data.bytes length:data.length error:&error])).to(beTrue());
+            expect(model).to(equal([adapter modelFromData:data error:nil]));
+
+            expect(@([adapter populateModel:model fromString:@"true,1" error:&error])).to(beFalse());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentCount));
+            expect(@([adapter populateModel:model fromString:nil error:&error])).to(beFalse());
+            expect(error.code).to(equal(MAEErrorNilInputData));
+        });
+
+        it(@"resets properties that are projected out", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel3.class];
+            MAETModel3* model = [MAETModel3 new];
+            expect(@([adapter populateModel:model fromString:@"a, b, c" error:nil])).to(beTrue());
+
+            MAEArrayAdapter* projectedAdapter = [adapter adapterProjectingKeys:[NSSet setWithObject:@"requireString"]];
+            expect(@([projectedAdapter populateModel:model fromString:@"x, y, z" error:nil])).to(beTrue());
+            expect(model.requireString).to(equal(@"x"));
+            expect(model.optionalString).to(beNil());
+            expect(model.variadicArray).to(beNil());
+        });
+
+        it(@"copies properties of a created model, if the class has validation methods of keys", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel7.class];
+            MAETModel7* model = [MAETModel7 new];
+            expect(@([adapter populateModel:model fromString:@"5" error:nil])).to(beTrue());
+            expect(model.count).to(equal(5));
+            expect(@([adapter populateModel:model fromString:@"-5" error:nil])).to(beTrue());
+            expect(model.count).to(equal(0));
+        });
+    });
+
+    describe(@"modelFromString:failure:", ^{
+        it(@"returns the code and the location of the failure", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel1.class];
+            MAEFailure failure;
+            expect([adapter modelFromString:@"true,1,2,3.5,4.5" failure:&failure]).notTo(beNil());
+
+            expect([adapter modelFromString:@"true,1" failure:&failure]).to(beNil());
+            expect(@(failure.code)).to(equal(@(MAEErrorNotMatchFragmentCount)));
+            expect(@(failure.fragmentIndex)).to(equal(@(NSNotFound)));
+
+            expect([adapter modelFromString:@"true,x,2,3.5,4.5" failure:&failure]).to(beNil());
+            expect(@(failure.code)).to(equal(@(MAEErrorUnknown)));
+            expect(@(failure.fragmentIndex)).to(equal(@1));
+            expect(@(failure.range.location)).to(equal(@5));
+            expect(@(failure.range.length)).to(equal(@1));
+
+            NSData* data = [@"true,1,x,3.5,4.5" dataUsingEncoding:NSUTF8StringEncoding];
+            expect([adapter modelFromUTF8Bytes:data.bytes length:data.length failure:&failure]).to(beNil());
+            expect(@(failure.fragmentIndex)).to(equal(@2));
+            expect(@(failure.range.location)).to(equal(@7));
+
+            expect([adapter modelFromString:nil failure:&failure]).to(beNil());
+            expect(@(failure.code)).to(equal(@(MAEErrorNilInputData)));
+            expect([adapter modelFromString:@"true,1" failure:NULL]).to(beNil());
+        });
+
+        it(@"records the field of the parent, if a nested model fails", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel4.class];
+            MAEFailure failure;
+            expect([adapter modelFromString:@"x | \"'a\"" failure:&failure]).to(beNil());
+            expect(@(failure.fragmentIndex)).to(equal(@1));
+            expect(@(failure.range.location)).to(equal(@4));
+            expect(@(failure.range.length)).to(equal(@4));
+        });
+    });
+
+    describe(@"validateStrings:", ^{
+        it(@"counts failures by error code", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel3.class];
+            NSMutableArray<NSString*>* strings = [NSMutableArray array];
+            for (NSUInteger i = 0; i < 100; i++) {
+                [strings addObject:i % 10 == 0 ? @"'a" : @(i).stringValue];
+            }
+            expect([adapter validateStrings:strings]).to(equal(@{ @(MAEErrorInvalidInputData) : @10 }));
+            expect([adapter validateStrings:@[ @"a", @"b, c, d" ]]).to(equal(@{}));
+
+            adapter = [MAEArrayAdapter adapterForModelClass:MAETModel1.class];
+            expect([adapter validateStrings:@[ @"true,1", @"true,x,2,3,4", @"true,1,2,3,4", @"1,2", @"", @"false,1,2,3,4" ]])
+                .to(equal(@{ @(MAEErrorNotMatchFragmentCount) : @3, @(MAEErrorUnknown) : @1 }));
+        });
+    });
+
+    describe(@"stringByReplacingValue:forPropertyKey:inString:error:", ^{
+        it(@"replaces only the field of the property", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel1.class];
+            __block NSError* error = nil;
+            expect([adapter stringByReplacingValue:@(-5) forPropertyKey:@"i" inString:@"true,1,2,3.0,4.50" error:&error])
+                .to(equal(@"true,1,-5,3.0,4.50"));
+            expect([adapter stringByReplacingValue:@7 forPropertyKey:@"n" inString:@"true,1,2,3.0,4.50,6" error:&error])
+                .to(equal(@"true,1,2,3.0,4.50,7"));
+
+            adapter = [MAEArrayAdapter adapterForModelClass:MAETModel2.class];
+            expect([adapter stringByReplacingValue:@"new \"value\"" forPropertyKey:@"c" inString:@"a 'b c' 'd'" error:&error])
+                .to(equal(@"a 'b c' \"new \\\"value\\\"\""));
+            expect([adapter stringByReplacingValue:@"日本語" forPropertyKey:@"a" inString:@"🍣 'b c' \"d\"" error:&error])
+                .to(equal(@"日本語 'b c' \"d\""));
+        });
+
+        it(@"returns an error, if the record does not have the field", ^{
+            __block NSError* error = nil;
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel2.class];
+            expect([adapter stringByReplacingValue:@"x" forPropertyKey:@"b" inString:@"a \"c\"" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNoConversionTarget));
+
+            adapter = [MAEArrayAdapter adapterForModelClass:MAETModel1.class];
+            expect([adapter stringByReplacingValue:@1 forPropertyKey:@"i" inString:@"true,1" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentCount));
+            expect([adapter stringByReplacingValue:nil forPropertyKey:@"n" inString:@"true,1,2,3,4,5" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorInvalidInputData));
+        });
+    });
+
+    describe(@"appendRecordFromUTF8Bytes:length:replacingValue:forPropertyKey:toData:error:", ^{
+        it(@"appends the record whose field is replaced", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel3.class];
+            NSMutableData* data = [NSMutableData dataWithBytes:"x" length:1];
+            const char* record = " 日本語 ,  🍣 , a,b";
+            __block NSError* error = nil;
+            expect(@([adapter appendRecordFromUTF8Bytes:record
+                                                 length:strlen(record)
+                                         replacingValue:@"x y"
+                                         forPropertyKey:@"optionalString"
+                                                 toData:data
+                                                  error:&error]))
+                .to(beTrue());
+            expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]).to(equal(@"x 日本語 ,  \"x y\" , a,b"));
+
+            expect(@([adapter appendRecordFromUTF8Bytes:"'a"
+                                                 length:2
+                                         replacingValue:@"b"
+                                         forPropertyKey:@"requireString"
+                                                 toData:data
+                                                  error:&error]))
+                .to(beFalse());
+            expect(error.code).to(equal(MAEErrorInvalidInputData));
+            expect(@(data.length)).to(equal(@(1 + strlen(record) + 1)));
+        });
+    });
+
     describe(@"input data is nil", ^{
         it(@"return nil, if input data is nil", ^{
             __block NSError* error = nil;
@@ -235,6 +667,59 @@ QuickSpecBegin(MAEArrayAdapterTests)
         });
     });
 
+    describe(@"modelsOfClass:fromStrings:errors:", ^{
+        it(@"returns models in the same order as strings", ^{
+            NSMutableArray<NSString*>* strings = [NSMutableArray array];
+            for (NSUInteger i = 0; i < 1000; i++) {
+                [strings addObject:[NSString stringWithFormat:@"true,%lu,-1,2.5,1.5", (unsigned long)i]];
+            }
+
+            __block NSDictionary<NSNumber*, NSError*>* errors = nil;
+            __block NSArray<MAETModel1*>* models = nil;
+            expect(models = [MAEArrayAdapter modelsOfClass:MAETModel1.class fromStrings:strings errors:&errors]).notTo(beNil());
+            expect(errors).to(beNil());
+            expect(models.count).to(equal(strings.count));
+            for (NSUInteger i = 0; i < models.count; i++) {
+                expect(models[i].ui).to(equal(i));
+            }
+        });
+
+        it(@"reports errors by index", ^{
+            NSArray<NSString*>* strings = @[ @"true,1,-1,2.5,1.5", @"true,1", @"true,3,-1,2.5,1.5", @"'true,1,-1,2.5,1.5" ];
+
+            __block NSDictionary<NSNumber*, NSError*>* errors = nil;
+            __block NSArray* models = nil;
+            expect(models = [MAEArrayAdapter modelsOfClass:MAETModel1.class fromStrings:strings errors:&errors]).notTo(beNil());
+            expect(models.count).to(equal(4));
+            expect([models[0] ui]).to(equal(1));
+            expect(models[1]).to(equal(NSNull.null));
+            expect([models[2] ui]).to(equal(3));
+            expect(models[3]).to(equal(NSNull.null));
+
+            expect(errors.allKeys).to(contain(@1, @3));
+            expect(errors.count).to(equal(2));
+            expect(errors[@1].code).to(equal(MAEErrorNotMatchFragmentCount));
+            expect(errors[@3].code).to(equal(MAEErrorInvalidInputData));
+        });
+
+        it(@"can separate a string into records", ^{
+            __block NSDictionary<NSNumber*, NSError*>* errors = nil;
+            __block NSArray<MAETModel3*>* models = nil;
+            expect(models = [MAEArrayAdapter modelsOfClass:MAETModel3.class
+                                                fromString:@"a, b, c\r\n'x\ny', z\n\n\"q\\\"\nw\"\n'unclosed"
+                                           recordSeparator:'\n'
+                                                    errors:&errors])
+                .notTo(beNil());
+            expect(models.count).to(equal(4));
+            expect(models[0].requireString).to(equal(@"a"));
+            expect(models[0].variadicArray).to(equal(@[ @"c" ]));
+            expect(models[1].requireString).to(equal(@"x\ny"));
+            expect(models[2].requireString).to(equal(@"q\"\nw"));
+            expect(models[3]).to(equal(NSNull.null));
+            expect(errors.allKeys).to(equal(@[ @3 ]));
+        });
+    });
+
     describe(@"modelOfClass:fromArray:error:", ^{
         it(@"returns a model, if there are no invalid types when input data is NSArray of NSString", ^{
             id mock = OCMClassMock(MAETModel2.class);
@@ -329,6 +814,16 @@ QuickSpecBegin(MAEArrayAdapterTests)
             expect([MAEArrayAdapter stringTransformerForObjCType:@encode(BOOL)]).notTo(beNil());
             expect([MAEArrayAdapter stringTransformerForObjCType:@encode(boolean_t)]).notTo(beNil());
         });
+
+        it(@"chooses a transformer that has float precision for float", ^{
+            NSValueTransformer* floatTransformer = [MAEArrayAdapter stringTransformerForObjCType:@encode(float)];
+            NSValueTransformer* doubleTransformer = [MAEArrayAdapter stringTransformerForObjCType:@encode(double)];
+
+            expect([floatTransformer transformedValue:@"0.1"]).to(equal(@0.1f));
+            expect([floatTransformer reverseTransformedValue:@0.1f]).to(equal(@"0.1"));
+            expect([doubleTransformer transformedValue:@"0.1"]).to(equal(@0.1));
+            expect([doubleTransformer reverseTransformedValue:@0.1]).to(equal(@"0.1"));
+        });
     });
 
     describe(@"stringFromModel:error:", ^{
@@ -668,6 +1163,68 @@ QuickSpecBegin(MAEArrayAdapterTests)
         });
     });
 
+    describe(@"classesByDiscriminator", ^{
+        it(@"chooses the class by the field, and reuses fields if the class splits records by the same rules", ^{
+            __block NSError* error = nil;
+            MAETModel3* model3;
+            expect(model3 = [MAEArrayAdapter modelOfClass:MAETModel8.class fromString:@"text, a, b, c" error:&error])
+                .notTo(beNil());
+            expect([model3 isKindOfClass:MAETModel3.class]).to(equal(YES));
+            expect(model3.requireString).to(equal(@"text"));
+            expect(model3.optionalString).to(equal(@"a"));
+            expect(model3.variadicArray).to(equal(@[ @"b", @"c" ]));
+            expect(error).to(beNil());
+
+            MAETModel8* model8;
+            expect(model8 = [MAEArrayAdapter modelOfClass:MAETModel8.class fromString:@"\"self\", a" error:&error])
+                .notTo(beNil());
+            expect([model8 isKindOfClass:MAETModel8.class]).to(equal(YES));
+            expect(model8.value).to(equal(@"a"));
+        });
+
+        it(@"splits the record again, if the class has a different separator", ^{
+            __block NSError* error = nil;
+            MAETModel4* model;
+            expect(model = [MAEArrayAdapter modelOfClass:MAETModel8.class fromString:@"nest, a | b, c" error:&error])
+                .notTo(beNil());
+            expect([model isKindOfClass:MAETModel4.class]).to(equal(YES));
+            expect(model.requireString).to(equal(@"nest, a"));
+            expect(model.model3.requireString).to(equal(@"b"));
+            expect(error).to(beNil());
+        });
+
+        it(@"chooses the class from data and array", ^{
+            NSData* data = [@"text, a, b" dataUsingEncoding:NSUTF8StringEncoding];
+            MAETModel3* model3 = [MAEArrayAdapter modelOfClass:MAETModel8.class fromData:data error:nil];
+            expect([model3 isKindOfClass:MAETModel3.class]).to(equal(YES));
+            expect(model3.variadicArray).to(equal(@[ @"b" ]));
+
+            data = [@"nest, a | b" dataUsingEncoding:NSUTF8StringEncoding];
+            expect([[MAEArrayAdapter modelOfClass:MAETModel8.class fromData:data error:nil] class])
+                .to(equal(MAETModel4.class));
+
+            model3 = [MAEArrayAdapter modelOfClass:MAETModel8.class fromArray:@[ @"text", @"a", @"b" ] error:nil];
+            expect([model3 isKindOfClass:MAETModel3.class]).to(equal(YES));
+            expect(model3.optionalString).to(equal(@"a"));
+        });
+
+        it(@"returns nil, if there is no class for the field", ^{
+            __block NSError* error = nil;
+            expect([MAEArrayAdapter modelOfClass:MAETModel8.class fromString:@"other, a" error:&error]).to(beNil());
+            expect(error.domain).to(equal(MAEErrorDomain));
+            expect(error.code).to(equal(MAEErrorNoConversionTarget));
+
+            error = nil;
+            NSData* data = [@"" dataUsingEncoding:NSUTF8StringEncoding];
+            expect([MAEArrayAdapter modelOfClass:MAETModel8.class fromData:data error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNoConversionTarget));
+
+            error = nil;
+            expect([MAEArrayAdapter modelOfClass:MAETModel8.class fromArray:@[] error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNoConversionTarget));
+        });
+    });
+
     describe(@"separateString:", ^{
         __block id mock = nil;
 
@@ -0,0 +1,142 @@
+//
+//  MAEArrayFileTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayFile.h"
+#import "MAETModel.h"
+
+QuickSpecBegin(MAEArrayFileTests)
+{
+    NSString* (^temporaryPath)(void) = ^{
+        return [NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString];
+    };
+
+    NSString* (^writeFile)(NSString*) = ^(NSString* contents) {
+        NSString* path = temporaryPath();
+        [contents writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+        return path;
+    };
+
+    describe(@"modelAtIndex:error:", ^{
+        it(@"separates records in the same way as MAEArrayReader", ^{
+            NSString* path = writeFile(@"a, b, c\n'x\ny', z\r\n\n\"q,\\\"w\"\n日本語, 🍣\n");
+            __block NSError* error = nil;
+            MAEArrayFile* file = [[MAEArrayFile alloc] initWithModelClass:MAETModel3.class
+                                                                     path:path
+                                                         recordTerminator:'\n'
+                                                                    error:&error];
+            expect(file).notTo(beNil());
+            expect(@(file.count)).to(equal(@4));
+            expect(@(file.loadedIndex)).to(beFalse());
+
+            MAETModel3* model = [file modelAtIndex:1 error:&error];
+            expect(model.requireString).to(equal(@"x\ny"));
+            expect(model.optionalString).to(equal(@"z"));
+            expect([file modelAtIndex:2 error:&error].requireString).to(equal(@"q,\"w"));
+            expect([file modelAtIndex:3 error:&error].optionalString).to(equal(@"🍣"));
+            expect([file recordAtIndex:0]).to(equal(@"a, b, c"));
+        });
+
+        it(@"indexes large files in parallel", ^{
+            NSMutableString* contents = [NSMutableString string];
+            for (NSUInteger i = 0; i < 100000; i++) {
+                [contents appendFormat:@"%lu, 'a\n%lu', \"\\\"\n\"\n", (unsigned long)i, (unsigned long)i];
+            }
+            MAEArrayFile* file = [[MAEArrayFile alloc] initWithModelClass:MAETModel3.class
+                                                                     path:writeFile(contents)
+                                                         recordTerminator:'\n'
+                                                                    error:nil];
+            expect(@(file.count)).to(equal(@100000));
+            for (NSNumber* index in @[ @0, @1, @31337, @65536, @99999 ]) {
+                MAETModel3* model = [file modelAtIndex:index.unsignedIntegerValue error:nil];
+                expect(model.requireString).to(equal(index.stringValue));
+                expect(model.optionalString).to(equal(([NSString stringWithFormat:@"a\n%@", index])));
+                expect(model.variadicArray).to(equal(@[ @"\"\n" ]));
+            }
+        });
+
+        it(@"returns the same model while it is cached", ^{
+            MAEArrayFile* file = [[MAEArrayFile alloc] initWithModelClass:MAETModel3.class
+                                                                     path:writeFile(@"a\nb\nc\n")
+                                                         recordTerminator:'\n'
+                                                                indexPath:nil
+                                                            cacheCapacity:2
+                                                                    error:nil];
+            MAETModel3* a = [file modelAtIndex:0 error:nil];
+            expect([file modelAtIndex:0 error:nil]).to(beIdenticalTo(a));
+            [file modelAtIndex:1 error:nil];
+            [file modelAtIndex:0 error:nil];
+            [file modelAtIndex:2 error:nil];
+            expect([file modelAtIndex:0 error:nil]).to(beIdenticalTo(a));
+
+            MAETModel3* b = [file modelAtIndex:1 error:nil];
+            expect(b.requireString).to(equal(@"b"));
+            expect([file modelAtIndex:1 error:nil]).to(beIdenticalTo(b));
+        });
+
+        it(@"returns an error of the record", ^{
+            MAEArrayFile* file = [[MAEArrayFile alloc] initWithModelClass:MAETModel1.class
+                                                                     path:writeFile(@"true,1,2,3,4\ntrue,1\n")
+                                                         recordTerminator:'\n'
+                                                                    error:nil];
+            __block NSError* error = nil;
+            expect([file modelAtIndex:0 error:&error]).notTo(beNil());
+            expect([file modelAtIndex:1 error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentCount));
+        });
+    });
+
+    describe(@"initWithModelClass:path:recordTerminator:indexPath:cacheCapacity:error:", ^{
+        it(@"loads the index from the sidecar file, if the file is not changed", ^{
+            NSString* path = writeFile(@"a, b\n'c\nd'\ne\n");
+            NSString* indexPath = temporaryPath();
+            MAEArrayFile* (^openFile)(void) = ^{
+                return [[MAEArrayFile alloc] initWithModelClass:MAETModel3.class
+                                                           path:path
+                                               recordTerminator:'\n'
+                                                      indexPath:indexPath
+                                                  cacheCapacity:0
+                                                          error:nil];
+            };
+
+            MAEArrayFile* file = openFile();
+            expect(@(file.loadedIndex)).to(beFalse());
+            expect(@([NSFileManager.defaultManager fileExistsAtPath:indexPath])).to(beTrue());
+
+            file = openFile();
+            expect(@(file.loadedIndex)).to(beTrue());
+            expect(@(file.count)).to(equal(@3));
+            expect([file modelAtIndex:1 error:nil].requireString).to(equal(@"c\nd"));
+
+            [@"x\ny\n" writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+            file = openFile();
+            expect(@(file.loadedIndex)).to(beFalse());
+            expect(@(file.count)).to(equal(@2));
+        });
+
+        it(@"returns an error, if the file can not be opened", ^{
+            __block NSError* error = nil;
+            expect([[MAEArrayFile alloc] initWithModelClass:MAETModel3.class
+                                                       path:temporaryPath()
+                                           recordTerminator:'\n'
+                                                      error:&error])
+                .to(beNil());
+            expect(error.domain).to(equal(NSPOSIXErrorDomain));
+            expect(error.code).to(equal(ENOENT));
+        });
+
+        it(@"opens an empty file", ^{
+            MAEArrayFile* file = [[MAEArrayFile alloc] initWithModelClass:MAETModel3.class
+                                                                     path:writeFile(@"")
+                                                         recordTerminator:'\n'
+                                                                    error:nil];
+            expect(file).notTo(beNil());
+            expect(@(file.count)).to(equal(@0));
+        });
+    });
+}
+QuickSpecEnd
@@ -0,0 +1,130 @@
+//
+//  MAEArrayMetricsTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import "MAEArrayMetrics.h"
+#import "MAETModel.h"
+
+QuickSpecBegin(MAEArrayMetricsTests)
+{
+    __block MAEArrayMetrics* metrics;
+
+    beforeEach(^{
+        metrics = [MAEArrayMetrics new];
+        [MAEArrayAdapter setMetricsObserver:metrics];
+    });
+
+    afterEach(^{
+        [MAEArrayAdapter setMetricsObserver:nil];
+    });
+
+    describe(@"setMetricsObserver:", ^{
+        it(@"returns the observer", ^{
+            expect([MAEArrayAdapter metricsObserver]).to(beIdenticalTo(metrics));
+            [MAEArrayAdapter setMetricsObserver:nil];
+            expect([MAEArrayAdapter metricsObserver]).to(beNil());
+        });
+
+        it(@"releases the old observer", ^{
+            __weak MAEArrayMetrics* oldMetrics = nil;
+            @autoreleasepool {
+                MAEArrayMetrics* newMetrics = [MAEArrayMetrics new];
+                [MAEArrayAdapter setMetricsObserver:newMetrics];
+                oldMetrics = metrics;
+                metrics = newMetrics;
+            }
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromString:@"'" error:nil]).to(beNil());
+            expect(oldMetrics).to(beNil());
+            expect([metrics dictionaryValue][@"errors"]).notTo(equal(@{}));
+        });
+
+        it(@"does not record anything, if the observer is nil", ^{
+            [MAEArrayAdapter setMetricsObserver:nil];
+            expect([MAEArrayAdapter modelOfClass:MAETModel1.class fromString:@"1,2,3,4.5,5.5" error:nil]).notTo(beNil());
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromString:@"'" error:nil]).to(beNil());
+            expect([metrics dictionaryValue]).to(equal(@{ @"phases" : @{}, @"transformers" : @{}, @"errors" : @{} }));
+        });
+    });
+
+    describe(@"phases", ^{
+        it(@"records each phase of conversion from string", ^{
+            for (NSUInteger i = 0; i < 2; i++) {
+                expect([MAEArrayAdapter modelOfClass:MAETModel1.class fromString:@"1,2,3,4.5,5.5" error:nil])
+                    .notTo(beNil());
+            }
+
+            Class modelClass = MAETModel1.class;
+            expect(@([metrics countOfPhase:MAEArrayPhaseSeparate ofModelClass:modelClass])).to(equal(@2));
+            expect(@([metrics countOfPhase:MAEArrayPhaseChooseFormat ofModelClass:modelClass])).to(equal(@2));
+            expect(@([metrics countOfPhase:MAEArrayPhaseTransform ofModelClass:modelClass])).to(equal(@10));
+            expect(@([metrics countOfPhase:MAEArrayPhaseCreateModel ofModelClass:modelClass])).to(equal(@2));
+            expect(@([metrics countOfPhase:MAEArrayPhaseValidateModel ofModelClass:modelClass])).to(equal(@2));
+            expect(@([metrics durationOfPhase:MAEArrayPhaseValidateModel ofModelClass:modelClass])).to(beGreaterThan(@0));
+
+            expect(@([metrics countOfTransformerForPropertyKey:@"d" ofModelClass:modelClass])).to(equal(@2));
+            expect(@([metrics countOfTransformerForPropertyKey:@"n" ofModelClass:modelClass])).to(equal(@0));
+        });
+
+        it(@"records phases of nested models by their own class", ^{
+            expect([MAEArrayAdapter modelOfClass:MAETModel4.class fromString:@"a | b, c, d" error:nil]).notTo(beNil());
+
+            expect(@([metrics countOfTransformerForPropertyKey:@"model3" ofModelClass:MAETModel4.class])).to(equal(@1));
+            expect(@([metrics durationOfTransformerForPropertyKey:@"model3" ofModelClass:MAETModel4.class]))
+                .to(beGreaterThan(@0));
+            expect(@([metrics countOfPhase:MAEArrayPhaseSeparate ofModelClass:MAETModel3.class])).to(equal(@1));
+            expect(@([metrics countOfTransformerForPropertyKey:@"variadicArray" ofModelClass:MAETModel3.class]))
+                .to(equal(@1));
+            expect(@([metrics countOfPhase:MAEArrayPhaseValidateFragment ofModelClass:MAETModel3.class]))
+                .to(beGreaterThan(@0));
+        });
+
+        it(@"records phases of conversion from array", ^{
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromArray:@[ @"a", @"\"c\"" ] error:nil]).notTo(beNil());
+
+            expect(@([metrics countOfPhase:MAEArrayPhaseSeparate ofModelClass:MAETModel2.class])).to(equal(@0));
+            expect(@([metrics countOfPhase:MAEArrayPhaseValidateFragment ofModelClass:MAETModel2.class])).to(equal(@2));
+            expect(@([metrics countOfPhase:MAEArrayPhaseTransform ofModelClass:MAETModel2.class])).to(equal(@2));
+        });
+    });
+
+    describe(@"errors", ^{
+        it(@"counts errors by code, even if the error is not requested", ^{
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromString:@"'" error:nil]).to(beNil());
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromString:@"a" error:nil]).to(beNil());
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromString:nil error:nil]).to(beNil());
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromString:@"b" error:nil]).to(beNil());
+
+            expect(@([metrics countOfErrorCode:MAEErrorInvalidInputData])).to(equal(@1));
+            expect(@([metrics countOfErrorCode:MAEErrorNotMatchFragmentCount])).to(equal(@2));
+            expect(@([metrics countOfErrorCode:MAEErrorNilInputData])).to(equal(@1));
+            expect(@([metrics countOfErrorCode:MAEErrorNotMatchFragmentType])).to(equal(@0));
+        });
+    });
+
+    describe(@"dictionaryValue", ^{
+        it(@"can be serialized to JSON", ^{
+            expect([MAEArrayAdapter modelOfClass:MAETModel4.class fromString:@"a | b, c, d" error:nil]).notTo(beNil());
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromString:@"'" error:nil]).to(beNil());
+
+            NSDictionary* dictionary = [metrics dictionaryValue];
+            expect(dictionary[@"phases"][@"MAETModel4"][@"transform"][@"count"]).to(equal(@2));
+            expect(dictionary[@"transformers"][@"MAETModel4"][@"model3"][@"count"]).to(equal(@1));
+            expect(dictionary[@"errors"][@(MAEErrorInvalidInputData).stringValue]).to(equal(@1));
+            expect(@([NSJSONSerialization isValidJSONObject:dictionary])).to(beTrue());
+        });
+    });
+
+    describe(@"reset", ^{
+        it(@"clears all metrics", ^{
+            expect([MAEArrayAdapter modelOfClass:MAETModel2.class fromString:@"'" error:nil]).to(beNil());
+            [metrics reset];
+            expect(@([metrics countOfErrorCode:MAEErrorInvalidInputData])).to(equal(@0));
+        });
+    });
+}
+QuickSpecEnd
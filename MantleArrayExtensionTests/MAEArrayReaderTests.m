@@ -0,0 +1,187 @@
+//
+//  MAEArrayReaderTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayReader.h"
+#import "MAEArrayWriter.h"
+#import "MAETModel.h"
+
+QuickSpecBegin(MAEArrayReaderTests)
+{
+    NSArray<MAETModel3*>* (^readAll)(NSString*, NSUInteger, NSUInteger, NSError**) =
+        ^(NSString* input, NSUInteger chunkSize, NSUInteger batchSize, NSError** error) {
+            NSInputStream* stream = [NSInputStream inputStreamWithData:[input dataUsingEncoding:NSUTF8StringEncoding]];
+            MAEArrayReader* reader = [[MAEArrayReader alloc] initWithModelClass:MAETModel3.class
+                                                                    inputStream:stream
+                                                               recordTerminator:'\n'];
+            reader.chunkSize = chunkSize;
+            reader.batchSize = batchSize;
+
+            NSMutableArray* models = [NSMutableArray array];
+            BOOL success = [reader readModelsUsingBlock:^(NSArray* batch, BOOL* stop) {
+                expect(@(batch.count)).to(beLessThanOrEqualTo(@(batchSize)));
+                [models addObjectsFromArray:batch];
+            }
+                                                  error:error];
+            return success ? models : nil;
+        };
+
+    describe(@"readModelsUsingBlock:error:", ^{
+        it(@"can read records that cross chunk boundaries", ^{
+            NSString* input = @"a, b, c\n'x\ny', z\r\n\n\"q,\\\"w\"\n日本語, 🍣\n";
+            for (NSUInteger chunkSize = 1; chunkSize <= input.length + 1; chunkSize++) {
+                __block NSError* error = nil;
+                __block NSArray<MAETModel3*>* models = nil;
+                expect(models = readAll(input, chunkSize, 2, &error)).notTo(beNil());
+                expect(error).to(beNil());
+                expect(models.count).to(equal(4));
+
+                expect(models[0].requireString).to(equal(@"a"));
+                expect(models[0].optionalString).to(equal(@"b"));
+                expect(models[0].variadicArray).to(equal(@[ @"c" ]));
+
+                expect(models[1].requireString).to(equal(@"x\ny"));
+                expect(models[1].optionalString).to(beNil());
+                expect(models[1].variadicArray).to(equal(@[ @"z" ]));
+
+                expect(models[2].requireString).to(equal(@"q,\"w"));
+                expect(models[2].variadicArray).to(equal(@[]));
+
+                expect(models[3].requireString).to(equal(@"日本語"));
+                expect(models[3].variadicArray).to(equal(@[ @"🍣" ]));
+            }
+        });
+
+        it(@"can read the last record without terminator", ^{
+            __block NSArray<MAETModel3*>* models = nil;
+            expect(models = readAll(@"a\nb", 4, 10, nil)).notTo(beNil());
+            expect([models valueForKey:@"requireString"]).to(equal(@[ @"a", @"b" ]));
+        });
+
+        it(@"passes models before the invalid record, and returns error", ^{
+            NSInputStream* stream = [NSInputStream inputStreamWithData:[@"a\nb\n\"c\n" dataUsingEncoding:NSUTF8StringEncoding]];
+            MAEArrayReader* reader = [[MAEArrayReader alloc] initWithModelClass:MAETModel3.class
+                                                                    inputStream:stream
+                                                               recordTerminator:'\n'];
+            reader.chunkSize = 4;
+            reader.batchSize = 1;
+
+            NSMutableArray* batches = [NSMutableArray array];
+            __block NSError* error = nil;
+            expect([reader readModelsUsingBlock:^(NSArray* batch, BOOL* stop) {
+                [batches addObject:[batch valueForKey:@"requireString"]];
+            }
+                                          error:&error])
+                .to(equal(NO));
+            expect(batches).to(equal(@[ @[ @"a" ], @[ @"b" ] ]));
+            expect(@(reader.acceptedCount)).to(equal(@2));
+            expect(error).notTo(beNil());
+            expect(error.domain).to(equal(MAEErrorDomain));
+            expect(error.code).to(equal(MAEErrorInvalidInputData));
+        });
+
+        it(@"returns error, if a record is longer than maximumRecordLength", ^{
+            NSMutableString* input = [NSMutableString stringWithString:@"a\n'unclosed"];
+            for (NSUInteger i = 0; i < 100; i++) {
+                [input appendString:@", x\ny"];
+            }
+            NSInputStream* stream = [NSInputStream inputStreamWithData:[input dataUsingEncoding:NSUTF8StringEncoding]];
+            MAEArrayReader* reader = [[MAEArrayReader alloc] initWithModelClass:MAETModel3.class
+                                                                    inputStream:stream
+                                                               recordTerminator:'\n'];
+            reader.chunkSize = 16;
+            reader.maximumRecordLength = 64;
+
+            __block NSUInteger count = 0;
+            __block NSError* error = nil;
+            expect([reader readModelsUsingBlock:^(NSArray* batch, BOOL* stop) {
+                count += batch.count;
+            }
+                                          error:&error])
+                .to(equal(NO));
+            expect(count).to(equal(1));
+            expect(error.domain).to(equal(MAEErrorDomain));
+            expect(error.code).to(equal(MAEErrorInvalidInputData));
+        });
+
+        it(@"stops reading, if the block sets YES to stop", ^{
+            NSInputStream* stream = [NSInputStream inputStreamWithData:[@"a\nb\nc\n" dataUsingEncoding:NSUTF8StringEncoding]];
+            MAEArrayReader* reader = [[MAEArrayReader alloc] initWithModelClass:MAETModel3.class
+                                                                    inputStream:stream
+                                                               recordTerminator:'\n'];
+            reader.batchSize = 1;
+
+            __block NSUInteger count = 0;
+            expect([reader readModelsUsingBlock:^(NSArray* batch, BOOL* stop) {
+                count += batch.count;
+                *stop = YES;
+            }
+                                          error:nil])
+                .to(equal(YES));
+            expect(count).to(equal(1));
+        });
+
+        it(@"can read from file descriptor", ^{
+            int fds[2];
+            expect(pipe(fds)).to(equal(0));
+            const char* input = "a, b\nc\n";
+            write(fds[1], input, strlen(input));
+            close(fds[1]);
+
+            MAEArrayReader* reader = [[MAEArrayReader alloc] initWithModelClass:MAETModel3.class
+                                                                 fileDescriptor:fds[0]
+                                                               recordTerminator:'\n'];
+            NSMutableArray<MAETModel3*>* models = [NSMutableArray array];
+            expect([reader readModelsUsingBlock:^(NSArray* batch, BOOL* stop) {
+                [models addObjectsFromArray:batch];
+            }
+                                          error:nil])
+                .to(equal(YES));
+            close(fds[0]);
+
+            expect([models valueForKey:@"requireString"]).to(equal(@[ @"a", @"c" ]));
+        });
+    });
+
+    describe(@"patchRecordsReplacingValue:forPropertyKey:toWriter:error:", ^{
+        it(@"writes records whose field is replaced, and copies other bytes", ^{
+            NSString* input = @"true, 1,2,3.0,4.50\r\n\nt,1,2,3,4,5\nfalse,1,2,3,4";
+            for (NSUInteger chunkSize = 1; chunkSize <= input.length + 1; chunkSize++) {
+                NSInputStream* stream = [NSInputStream inputStreamWithData:[input dataUsingEncoding:NSUTF8StringEncoding]];
+                MAEArrayReader* reader = [[MAEArrayReader alloc] initWithModelClass:MAETModel1.class
+                                                                        inputStream:stream
+                                                                   recordTerminator:'\n'];
+                reader.chunkSize = chunkSize;
+                NSMutableData* data = [NSMutableData data];
+                MAEArrayWriter* writer = [[MAEArrayWriter alloc] initWithMutableData:data recordTerminator:'\n'];
+
+                __block NSError* error = nil;
+                expect(@([reader patchRecordsReplacingValue:@(-3) forPropertyKey:@"i" toWriter:writer error:&error]))
+                    .to(beTrue());
+                expect(@(reader.acceptedCount)).to(equal(@3));
+                expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding])
+                    .to(equal(@"true, 1,-3,3.0,4.50\r\n\nt,1,-3,3,4,5\nfalse,1,-3,3,4\n"));
+            }
+        });
+
+        it(@"writes records before the invalid record, and returns error", ^{
+            NSInputStream* stream = [NSInputStream inputStreamWithData:[@"true,1,2,3,4\ntrue,1\ntrue,1,2,3,4\n"
+                                                                            dataUsingEncoding:NSUTF8StringEncoding]];
+            MAEArrayReader* reader = [[MAEArrayReader alloc] initWithModelClass:MAETModel1.class
+                                                                    inputStream:stream
+                                                               recordTerminator:'\n'];
+            NSMutableData* data = [NSMutableData data];
+            MAEArrayWriter* writer = [[MAEArrayWriter alloc] initWithMutableData:data recordTerminator:'\n'];
+
+            __block NSError* error = nil;
+            expect(@([reader patchRecordsReplacingValue:@5 forPropertyKey:@"ui" toWriter:writer error:&error])).to(beFalse());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentCount));
+            expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]).to(equal(@"true,5,2,3,4\n"));
+        });
+    });
+}
+QuickSpecEnd
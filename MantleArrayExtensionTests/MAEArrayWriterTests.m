@@ -0,0 +1,168 @@
+//
+//  MAEArrayWriterTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayWriter.h"
+#import "MAETModel.h"
+#import <fcntl.h>
+#import <unistd.h>
+
+QuickSpecBegin(MAEArrayWriterTests)
+{
+    NSArray* (^makeModels)(void) = ^NSArray*(void) {
+        MAETModel1* model1 = [MAETModel1 new];
+        model1.b = YES;
+        model1.ui = 18446744073709551615u;
+        model1.i = -12;
+        model1.f = 0.1f;
+        model1.d = 1e-7;
+
+        MAETModel2* model2 = [MAETModel2 new];
+        model2.a = @"a b";
+        model2.c = @"say \"hi\" 日本語";
+
+        MAETModel3* model3 = [MAETModel3 new];
+        model3.requireString = @"";
+        model3.optionalString = @"🍣";
+        model3.variadicArray = @[ @"x y", @"z" ];
+
+        MAETModel4* model4 = [MAETModel4 new];
+        model4.requireString = @"req";
+        model4.model3 = model3;
+
+        MAETModel6* model6 = [MAETModel6 new];
+        model6.url = [NSURL URLWithString:@"https://example.com/a?b=c"];
+        model6.boolean = NO;
+
+        return @[ model1, model2, model3, model4, model6 ];
+    };
+
+    NSString* (^expectedString)(NSArray*) = ^NSString*(NSArray* models) {
+        NSMutableString* string = [NSMutableString string];
+        for (id model in models) {
+            [string appendString:[MAEArrayAdapter stringFromModel:model error:nil]];
+            [string appendString:@"\n"];
+        }
+        return string;
+    };
+
+    describe(@"appendModel:toData:error:", ^{
+        it(@"appends the same string as stringFromModel:error:", ^{
+            for (id model in makeModels()) {
+                NSMutableData* data = [NSMutableData dataWithBytes:"prefix" length:6];
+                MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:[model class]];
+                expect([adapter appendModel:model toData:data error:nil]).to(beTrue());
+
+                NSString* string = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+                expect(string).to(equal([@"prefix" stringByAppendingString:[adapter stringFromModel:model error:nil]]));
+            }
+        });
+
+        it(@"does not change the data, if conversion failed", ^{
+            MAETModel6* model = [MAETModel6 new];
+            model.url = (id) @"not url";
+            model.empty = @"empty";
+            NSMutableData* data = [NSMutableData dataWithBytes:"abc" length:3];
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel6.class];
+
+            __block NSError* error = nil;
+            expect([adapter appendModel:model toData:data error:&error]).to(beFalse());
+            expect(error).notTo(beNil());
+            expect(data.length).to(equal(3));
+
+            expect([adapter appendModel:nil toData:data error:&error]).to(beFalse());
+            expect(error.code).to(equal(MAEErrorNilInputData));
+            expect(data.length).to(equal(3));
+        });
+    });
+
+    describe(@"writeModels:error:", ^{
+        it(@"writes records to data", ^{
+            NSArray* models = makeModels();
+            NSMutableData* data = [NSMutableData data];
+            MAEArrayWriter* writer = [[MAEArrayWriter alloc] initWithMutableData:data recordTerminator:'\n'];
+
+            expect([writer writeModels:models error:nil]).to(beTrue());
+            expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]).to(equal(expectedString(models)));
+        });
+
+        it(@"writes records to a stream", ^{
+            NSArray* models = makeModels();
+            NSOutputStream* stream = [NSOutputStream outputStreamToMemory];
+            MAEArrayWriter* writer = [[MAEArrayWriter alloc] initWithOutputStream:stream recordTerminator:'\n'];
+            writer.bufferSize = 8;
+
+            expect([writer writeModels:models error:nil]).to(beTrue());
+            expect([writer flush:nil]).to(beTrue());
+
+            NSData* data = [stream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+            expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]).to(equal(expectedString(models)));
+        });
+
+        it(@"writes models before the invalid model, and returns error", ^{
+            MAETModel2* valid = [MAETModel2 new];
+            valid.a = @"a";
+            MAETModel6* invalid = [MAETModel6 new];
+            invalid.url = (id) @"not url";
+
+            NSMutableData* data = [NSMutableData data];
+            MAEArrayWriter* writer = [[MAEArrayWriter alloc] initWithMutableData:data recordTerminator:'\n'];
+
+            __block NSError* error = nil;
+            expect([writer writeModels:@[ valid, invalid, valid ] error:&error]).to(beFalse());
+            expect(error).notTo(beNil());
+            expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]).to(equal(@"a \"\"\n"));
+        });
+    });
+
+    describe(@"writeModelsConcurrently:errors:error:", ^{
+        it(@"writes records in the original order, and skips invalid models", ^{
+            NSArray* validModels = makeModels();
+            MAETModel6* invalid = [MAETModel6 new];
+            invalid.url = (id) @"not url";
+
+            NSMutableArray* models = [NSMutableArray array];
+            NSMutableArray* expectedModels = [NSMutableArray array];
+            for (NSUInteger i = 0; i < 5000; i++) {
+                if (i % 1000 == 999) {
+                    [models addObject:invalid];
+                } else {
+                    [models addObject:validModels[i % validModels.count]];
+                    [expectedModels addObject:validModels[i % validModels.count]];
+                }
+            }
+
+            NSOutputStream* stream = [NSOutputStream outputStreamToMemory];
+            MAEArrayWriter* writer = [[MAEArrayWriter alloc] initWithOutputStream:stream recordTerminator:'\n'];
+            writer.bufferSize = 1024;
+
+            NSDictionary<NSNumber*, NSError*>* errors = nil;
+            expect([writer writeModelsConcurrently:models.objectEnumerator errors:&errors error:nil]).to(beTrue());
+            expect([writer flush:nil]).to(beTrue());
+            expect([errors.allKeys sortedArrayUsingSelector:@selector(compare:)]).to(equal(@[ @999, @1999, @2999, @3999, @4999 ]));
+
+            NSData* data = [stream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+            expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]).to(equal(expectedString(expectedModels)));
+        });
+
+        it(@"writes records to a file descriptor", ^{
+            NSArray* models = makeModels();
+            NSString* path = [NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString];
+            int fd = open(path.fileSystemRepresentation, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            MAEArrayWriter* writer = [[MAEArrayWriter alloc] initWithFileDescriptor:fd recordTerminator:'\n'];
+
+            NSDictionary<NSNumber*, NSError*>* errors = nil;
+            expect([writer writeModelsConcurrently:models errors:&errors error:nil]).to(beTrue());
+            expect([writer flush:nil]).to(beTrue());
+            close(fd);
+            expect(errors).to(beNil());
+            expect([NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:nil])
+                .to(equal(expectedString(models)));
+        });
+    });
+}
+QuickSpecEnd
@@ -0,0 +1,230 @@
+//
+//  MAEColumnarBatchTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import "MAEColumnarBatch.h"
+#import "MAETModel.h"
+
+QuickSpecBegin(MAEColumnarBatchTests)
+{
+    describe(@"columnarBatchOfClass:fromData:recordSeparator:errors:", ^{
+        it(@"decodes numbers and bools into primitive columns", ^{
+            NSData* data = [@"1,2,-3,4.5,5.5\nNO,18446744073709551615,4,0.1,1e3,7\n" dataUsingEncoding:NSUTF8StringEncoding];
+            NSDictionary* errors = nil;
+            MAEColumnarBatch* batch = [MAEArrayAdapter columnarBatchOfClass:MAETModel1.class
+                                                                   fromData:data
+                                                            recordSeparator:'\n'
+                                                                     errors:&errors];
+            expect(errors).to(beNil());
+            expect(@(batch.rowCount)).to(equal(@2));
+            expect(@(batch.columns.count)).to(equal(@6));
+
+            MAEColumn* b = [batch columnForPropertyKey:@"b"];
+            expect(@(b.type)).to(equal(@(MAEColumnTypeBool)));
+            expect(@(b.boolValues[0])).to(beTrue());
+            expect(@(b.boolValues[1])).to(beFalse());
+
+            MAEColumn* ui = [batch columnForPropertyKey:@"ui"];
+            expect(@(ui.type)).to(equal(@(MAEColumnTypeInt64)));
+            expect(@((uint64_t)ui.int64Values[1])).to(equal(@(ULLONG_MAX)));
+
+            MAEColumn* i = [batch columnForPropertyKey:@"i"];
+            expect(@(i.int64Values[0])).to(equal(@(-3)));
+            expect(@(i.int64Values[1])).to(equal(@4));
+
+            MAEColumn* f = [batch columnForPropertyKey:@"f"];
+            expect(@(f.type)).to(equal(@(MAEColumnTypeDouble)));
+            expect(@((float)f.doubleValues[1])).to(equal(@(0.1f)));
+
+            MAEColumn* d = [batch columnForPropertyKey:@"d"];
+            expect(@(d.doubleValues[1])).to(equal(@1000));
+
+            MAEColumn* n = [batch columnForPropertyKey:@"n"];
+            expect(@(n.type)).to(equal(@(MAEColumnTypeDouble)));
+            expect(@([n isValidAtRow:0])).to(beFalse());
+            expect(@([n isValidAtRow:1])).to(beTrue());
+            expect(@(n.doubleValues[0])).to(equal(@0));
+            expect(@(n.doubleValues[1])).to(equal(@7));
+        });
+
+        it(@"decodes strings and variadic fields with offsets", ^{
+            NSData* data = [@"a, \"b,c\", d, e\r\n\r\nf\n" dataUsingEncoding:NSUTF8StringEncoding];
+            MAEColumnarBatch* batch = [MAEArrayAdapter columnarBatchOfClass:MAETModel3.class
+                                                                   fromData:data
+                                                            recordSeparator:'\n'
+                                                                     errors:nil];
+            expect(@(batch.rowCount)).to(equal(@2));
+
+            MAEColumn* requireString = [batch columnForPropertyKey:@"requireString"];
+            expect(@(requireString.type)).to(equal(@(MAEColumnTypeString)));
+            expect([requireString stringAtIndex:0]).to(equal(@"a"));
+            expect([requireString stringAtIndex:1]).to(equal(@"f"));
+
+            MAEColumn* optionalString = [batch columnForPropertyKey:@"optionalString"];
+            expect([optionalString stringAtIndex:0]).to(equal(@"b,c"));
+            expect(@([optionalString isValidAtRow:1])).to(beFalse());
+            expect([optionalString stringAtIndex:1]).to(equal(@""));
+
+            MAEColumn* variadicArray = [batch columnForPropertyKey:@"variadicArray"];
+            expect(@(variadicArray.variadic)).to(beTrue());
+            expect(@(variadicArray.count)).to(equal(@2));
+            expect(@(variadicArray.valueOffsets[0])).to(equal(@0));
+            expect(@(variadicArray.valueOffsets[1])).to(equal(@2));
+            expect(@(variadicArray.valueOffsets[2])).to(equal(@2));
+            expect([variadicArray stringAtIndex:0]).to(equal(@"d"));
+            expect([variadicArray stringAtIndex:1]).to(equal(@"e"));
+            expect(@([variadicArray isValidAtRow:1])).to(beTrue());
+        });
+
+        it(@"appends an invalid row for a record that could not be converted", ^{
+            NSData* data = [@"1,2,3,4,5;1,2;YES,x,3,4,5;1,2,3,4,5" dataUsingEncoding:NSUTF8StringEncoding];
+            NSDictionary<NSNumber*, NSError*>* errors = nil;
+            MAEColumnarBatch* batch = [MAEArrayAdapter columnarBatchOfClass:MAETModel1.class
+                                                                   fromData:data
+                                                            recordSeparator:';'
+                                                                     errors:&errors];
+            expect(@(batch.rowCount)).to(equal(@4));
+            expect(@(errors.count)).to(equal(@2));
+            expect(errors[@2]).notTo(beNil());
+            expect(@(errors[@1].code)).to(equal(@(MAEErrorNotMatchFragmentCount)));
+
+            for (MAEColumn* column in batch.columns) {
+                expect(@(column.count)).to(equal(@4));
+                expect(@([column isValidAtRow:1])).to(beFalse());
+                expect(@([column isValidAtRow:2])).to(beFalse());
+            }
+            MAEColumn* i = [batch columnForPropertyKey:@"i"];
+            expect(@([i isValidAtRow:3])).to(beTrue());
+            expect(@(i.int64Values[2])).to(equal(@0));
+            expect(@(i.int64Values[3])).to(equal(@3));
+        });
+    });
+
+    describe(@"appendRecordFromUTF8Bytes:length:toColumnarBatch:error:", ^{
+        it(@"appends rows one by one", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel3.class];
+            MAEColumnarBatch* batch = [adapter emptyColumnarBatch];
+            expect(@(batch.rowCount)).to(equal(@0));
+
+            NSError* error = nil;
+            expect(@([adapter appendRecordFromUTF8Bytes:"x, y" length:4 toColumnarBatch:batch error:&error]))
+                .to(beTrue());
+            expect(@([adapter appendRecordFromUTF8Bytes:"'z" length:2 toColumnarBatch:batch error:&error]))
+                .to(beFalse());
+            expect(@(error.code)).to(equal(@(MAEErrorInvalidInputData)));
+
+            expect(@(batch.rowCount)).to(equal(@2));
+            expect([[batch columnForPropertyKey:@"optionalString"] stringAtIndex:0]).to(equal(@"y"));
+            expect(@([[batch columnForPropertyKey:@"requireString"] isValidAtRow:1])).to(beFalse());
+        });
+    });
+    describe(@"dataFromColumnarBatch:recordSeparator:error:", ^{
+        NSString* (^stringFromBatch)(MAEColumnarBatch*, NSError**) = ^(MAEColumnarBatch* batch, NSError** error) {
+            NSData* data = [MAEArrayAdapter dataFromColumnarBatch:batch recordSeparator:'\n' error:error];
+            return data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : nil;
+        };
+
+        it(@"encodes the rows that columnarBatchOfClass:fromData:recordSeparator:errors: decodes", ^{
+            NSString* records = @"true,2,-3,4.5,5.5\nfalse,18446744073709551615,4,0.1,1000,7\n";
+            MAEColumnarBatch* batch = [MAEArrayAdapter columnarBatchOfClass:MAETModel1.class
+                                                                   fromData:[records dataUsingEncoding:NSUTF8StringEncoding]
+                                                            recordSeparator:'\n'
+                                                                     errors:nil];
+            __block NSError* error = nil;
+            expect(stringFromBatch(batch, &error)).to(equal(records));
+        });
+
+        it(@"encodes columns that are created from buffers", ^{
+            const char* stringBytes = "adeb cfxy";
+            const NSUInteger requireOffsets[] = { 0, 1, 2, 3 };
+            const NSUInteger optionalOffsets[] = { 3, 6, 6, 7 };
+            const uint8_t optionalValidity[] = { 0x5 };
+            const NSUInteger variadicOffsets[] = { 7, 8, 9 };
+            const NSUInteger variadicRows[] = { 0, 2, 2, 2 };
+
+            NSArray<MAEColumn*>* columns = @[
+                [[MAEColumn alloc] initWithPropertyKey:@"requireString"
+                                                  type:MAEColumnTypeString
+                                              rowCount:3
+                                                values:requireOffsets
+                                           stringBytes:(const uint8_t*)stringBytes
+                                          valueOffsets:NULL
+                                        validityBitmap:NULL],
+                [[MAEColumn alloc] initWithPropertyKey:@"optionalString"
+                                                  type:MAEColumnTypeString
+                                              rowCount:3
+                                                values:optionalOffsets
+                                           stringBytes:(const uint8_t*)stringBytes
+                                          valueOffsets:NULL
+                                        validityBitmap:optionalValidity],
+                [[MAEColumn alloc] initWithPropertyKey:@"variadicArray"
+                                                  type:MAEColumnTypeString
+                                              rowCount:3
+                                                values:variadicOffsets
+                                           stringBytes:(const uint8_t*)stringBytes
+                                          valueOffsets:variadicRows
+                                        validityBitmap:NULL],
+            ];
+            MAEColumnarBatch* batch = [[MAEColumnarBatch alloc] initWithModelClass:MAETModel3.class columns:columns];
+            expect(@(batch.rowCount)).to(equal(@3));
+            expect([columns[1] stringAtIndex:0]).to(equal(@"b c"));
+
+            __block NSError* error = nil;
+            expect(stringFromBatch(batch, &error)).to(equal(@"a,\"b c\",x,y\nd\ne,f\n"));
+        });
+
+        it(@"encodes rows in parallel in order", ^{
+            const NSUInteger rowCount = 10000;
+            int64_t* values = malloc(rowCount * sizeof(int64_t));
+            for (NSUInteger row = 0; row < rowCount; row++) {
+                values[row] = (int64_t)row - 5000;
+            }
+            MAEColumn* column = [[MAEColumn alloc] initWithPropertyKey:@"count"
+                                                                  type:MAEColumnTypeInt64
+                                                              rowCount:rowCount
+                                                                values:values
+                                                           stringBytes:NULL
+                                                          valueOffsets:NULL
+                                                        validityBitmap:NULL];
+            free(values);
+            MAEColumnarBatch* batch = [[MAEColumnarBatch alloc] initWithModelClass:MAETModel7.class columns:@[ column ]];
+
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel7.class];
+            NSMutableData* expected = [NSMutableData data];
+            expect(@([adapter appendRowsInRange:NSMakeRange(0, rowCount)
+                                ofColumnarBatch:batch
+                                recordSeparator:'\n'
+                                         toData:expected
+                                          error:nil]))
+                .to(beTrue());
+            expect([adapter dataFromColumnarBatch:batch recordSeparator:'\n' error:nil]).to(equal(expected));
+
+            MAETModel7* model = [MAETModel7 new];
+            model.count = -5000;
+            NSString* first = [[NSString alloc] initWithData:[expected subdataWithRange:NSMakeRange(0, 5)]
+                                                    encoding:NSUTF8StringEncoding];
+            expect(first).to(equal([MAEArrayAdapter stringFromModel:model error:nil]));
+        });
+
+        it(@"returns an error, if a row does not have the value of a required property", ^{
+            const BOOL values[] = { YES };
+            MAEColumn* b = [[MAEColumn alloc] initWithPropertyKey:@"b"
+                                                             type:MAEColumnTypeBool
+                                                         rowCount:1
+                                                           values:values
+                                                      stringBytes:NULL
+                                                     valueOffsets:NULL
+                                                   validityBitmap:NULL];
+            MAEColumnarBatch* batch = [[MAEColumnarBatch alloc] initWithModelClass:MAETModel1.class columns:@[ b ]];
+            __block NSError* error = nil;
+            expect(stringFromBatch(batch, &error)).to(beNil());
+            expect(@(error.code)).to(equal(@(MAEErrorInvalidInputData)));
+        });
+    });
+}
+QuickSpecEnd
@@ -0,0 +1,63 @@
+//
+//  MAEModelPoolTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import "MAEModelPool.h"
+#import "MAETModel.h"
+
+QuickSpecBegin(MAEModelPoolTests)
+{
+    describe(@"recycleModels:", ^{
+        it(@"holds models up to the capacity for each class", ^{
+            MAEModelPool* pool = [[MAEModelPool alloc] initWithCapacity:2];
+            MAETModel1* model1 = [MAETModel1 new];
+            [pool recycleModels:@[ model1, NSNull.null, [MAETModel1 new], [MAETModel1 new], [MAETModel3 new] ]];
+            expect(@(pool.count)).to(equal(@3));
+
+            expect([pool dequeueModelOfClass:MAETModel3.class]).to(beAKindOf(MAETModel3.class));
+            expect([pool dequeueModelOfClass:MAETModel3.class]).to(beNil());
+            expect([pool dequeueModelOfClass:MAETModel1.class]).notTo(beNil());
+            expect([pool dequeueModelOfClass:MAETModel1.class]).to(beIdenticalTo(model1));
+            expect(@(pool.count)).to(equal(@0));
+        });
+    });
+
+    describe(@"adapterWithModelPool:", ^{
+        it(@"returns the receiver, if the pool is the same", ^{
+            MAEModelPool* pool = [[MAEModelPool alloc] initWithCapacity:1];
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel3.class];
+            expect([adapter adapterWithModelPool:nil]).to(beIdenticalTo(adapter));
+
+            MAEArrayAdapter* pooledAdapter = [adapter adapterWithModelPool:pool];
+            expect(pooledAdapter.modelPool).to(beIdenticalTo(pool));
+            expect([pooledAdapter adapterWithModelPool:pool]).to(beIdenticalTo(pooledAdapter));
+            expect([pooledAdapter adapterWithOptions:MAEArrayAdapterSkipValidation].modelPool).to(beIdenticalTo(pool));
+        });
+
+        it(@"reuses recycled models, and resets their properties", ^{
+            MAEModelPool* pool = [[MAEModelPool alloc] initWithCapacity:4];
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter adapterForModelClass:MAETModel3.class] adapterWithModelPool:pool];
+
+            NSArray<MAETModel3*>* models = [adapter modelsFromString:@"a, b, c\nd, e" recordSeparator:'\n' errors:nil];
+            expect(@(models.count)).to(equal(@2));
+            [pool recycleModels:models];
+
+            NSArray<MAETModel3*>* reusedModels = [adapter modelsFromString:@"x\ny, z" recordSeparator:'\n' errors:nil];
+            expect(@(pool.count)).to(equal(@0));
+            expect([NSSet setWithArray:reusedModels]).to(haveCount(2));
+            for (MAETModel3* model in reusedModels) {
+                expect(@([models indexOfObjectIdenticalTo:model] != NSNotFound)).to(beTrue());
+            }
+            expect(reusedModels).to(equal([[MAEArrayAdapter adapterForModelClass:MAETModel3.class]
+                modelsFromString:@"x\ny, z"
+                 recordSeparator:'\n'
+                          errors:nil]));
+        });
+    });
+}
+QuickSpecEnd
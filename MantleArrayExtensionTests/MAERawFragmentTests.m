@@ -111,6 +111,35 @@ QuickSpecBegin(MAERawFragmentTests)
         });
     });
 
+    describe(@"isCandidateUTF8Bytes:length:", ^{
+        MAERawFragment* fragment = MAERawEither(@[ @"ab", @"\"b\"", @"日本" ]);
+
+        it(@"compares original characters", ^{
+            for (NSString* characters in @[ @"ab", @"\"b\"", @"日本" ]) {
+                NSData* data = [characters dataUsingEncoding:NSUTF8StringEncoding];
+                expect([fragment isCandidateUTF8Bytes:data.bytes length:data.length]).to(beTrue());
+            }
+            for (NSString* characters in @[ @"", @"a", @"abc", @"b", @"日" ]) {
+                NSData* data = [characters dataUsingEncoding:NSUTF8StringEncoding];
+                expect([fragment isCandidateUTF8Bytes:data.bytes length:data.length]).to(beFalse());
+            }
+        });
+    });
+
+    describe(@"isCandidateField:inString:", ^{
+        MAERawFragment* fragment = MAERawEither(@[ @"ab", @"\"b\"" ]);
+
+        it(@"compares original characters in the range of the field", ^{
+            NSString* string = @"ab \"b\" b";
+            MAEField quoted = { NSMakeRange(3, 3), NSMakeRange(4, 1), MAEStringTypeDoubleQuoted, NO };
+            MAEField enumerate = { NSMakeRange(7, 1), NSMakeRange(7, 1), MAEStringTypeEnumerate, NO };
+            MAEField prefix = { NSMakeRange(0, 1), NSMakeRange(0, 1), MAEStringTypeEnumerate, NO };
+            expect([fragment isCandidateField:quoted inString:string]).to(beTrue());
+            expect([fragment isCandidateField:enumerate inString:string]).to(beFalse());
+            expect([fragment isCandidateField:prefix inString:string]).to(beFalse());
+        });
+    });
+
     describe(@"copy", ^{
         it(@"shallow copy", ^{
             MAERawFragment* fragment1 = MAERaw(@"hoge");
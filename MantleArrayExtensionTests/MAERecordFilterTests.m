@@ -0,0 +1,142 @@
+//
+//  MAERecordFilterTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import "MAEArrayReader.h"
+#import "MAERecordFilter.h"
+#import "MAETModel.h"
+
+QuickSpecBegin(MAERecordFilterTests)
+{
+    describe(@"acceptsUTF8Bytes:length:", ^{
+        it(@"returns the same result as acceptsCharacters:", ^{
+            NSMutableSet<NSString*>* manyCharacters = [NSMutableSet set];
+            for (NSUInteger i = 0; i < 20; i++) {
+                [manyCharacters addObject:@(i).stringValue];
+            }
+            NSArray<MAERecordFilter*>* filters = @[
+                [MAERecordFilter filterWithPropertyKey:@"a" isEqualTo:@"日本"],
+                [MAERecordFilter filterWithPropertyKey:@"a" isIn:[NSSet setWithObjects:@"", @"x", nil]],
+                [MAERecordFilter filterWithPropertyKey:@"a" isIn:manyCharacters],
+                [MAERecordFilter filterWithPropertyKey:@"a"
+                                           passingTest:^BOOL(NSString* _Nonnull characters) {
+                                               return [characters hasPrefix:@"1"];
+                                           }],
+            ];
+            for (MAERecordFilter* filter in filters) {
+                for (NSString* characters in @[ @"", @"x", @"日本", @"日", @"1", @"12", @"19", @"20" ]) {
+                    NSData* data = [characters dataUsingEncoding:NSUTF8StringEncoding];
+                    expect(@([filter acceptsUTF8Bytes:data.bytes length:data.length]))
+                        .to(equal(@([filter acceptsCharacters:characters])));
+                }
+            }
+            expect(@([filters[0] acceptsCharacters:@"日本"])).to(beTrue());
+            expect(@([filters[1] acceptsCharacters:@""])).to(beTrue());
+            expect(@([filters[2] acceptsCharacters:@"20"])).to(beFalse());
+            expect(@([filters[3] acceptsCharacters:@"12"])).to(beTrue());
+        });
+    });
+
+    describe(@"adapterWithFilters:", ^{
+        MAERecordFilter* requireFilter = [MAERecordFilter filterWithPropertyKey:@"requireString"
+                                                                           isIn:[NSSet setWithObjects:@"a", @"b c", @"x\"y", nil]];
+
+        it(@"returns the receiver, if filters are the same", ^{
+            MAEArrayAdapter* adapter = [MAEArrayAdapter adapterForModelClass:MAETModel3.class];
+            expect([adapter adapterWithFilters:nil]).to(beIdenticalTo(adapter));
+            expect([adapter adapterWithFilters:@[]]).to(beIdenticalTo(adapter));
+
+            MAEArrayAdapter* filteredAdapter = [adapter adapterWithFilters:@[ requireFilter ]];
+            expect(filteredAdapter.filters).to(equal(@[ requireFilter ]));
+            expect([filteredAdapter adapterWithFilters:@[ requireFilter ]]).to(beIdenticalTo(filteredAdapter));
+            expect([filteredAdapter adapterWithOptions:MAEArrayAdapterSkipValidation].filters)
+                .to(equal(@[ requireFilter ]));
+        });
+
+        it(@"rejects records before validation and transformation", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter adapterForModelClass:MAETModel1.class]
+                adapterWithFilters:@[ [MAERecordFilter filterWithPropertyKey:@"b" isEqualTo:@"YES"] ]];
+
+            __block NSError* error = nil;
+            expect([adapter modelFromString:@"NO,x,3,4,5" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorRejectedByFilter));
+            expect(error.localizedDescription).to(equal(@"The record was rejected by filters"));
+            expect([adapter modelFromData:[@"NO,x,3,4,5" dataUsingEncoding:NSUTF8StringEncoding] error:&error])
+                .to(beNil());
+            expect(error.code).to(equal(MAEErrorRejectedByFilter));
+            expect([adapter modelFromArray:@[ @"NO", @"x", @"3", @"4", @"5" ] error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorRejectedByFilter));
+
+            expect([adapter modelFromString:@"YES,x,3,4,5" error:&error]).to(beNil());
+            expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+            expect([adapter modelFromString:@"YES,1,2" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorNotMatchFragmentCount));
+
+            __block MAETModel1* model = nil;
+            expect(model = [adapter modelFromString:@"YES,1,2,3,4" error:&error]).notTo(beNil());
+            expect(model.i).to(equal(2));
+        });
+
+        it(@"compares characters without quotes and escapes", ^{
+            MAEArrayAdapter* adapter =
+                [[MAEArrayAdapter adapterForModelClass:MAETModel3.class] adapterWithFilters:@[ requireFilter ]];
+            NSArray<NSString*>* records =
+                @[ @"a", @" \"b c\" , d", @"'a'", @"\"\\a\"", @"c", @"\"a\" , \"b\\\"\"", @"\"x\\\"y\"" ];
+            NSArray<NSNumber*>* accepted = @[ @YES, @YES, @YES, @NO, @NO, @YES, @YES ];
+            for (NSUInteger i = 0; i < records.count; i++) {
+                NSData* data = [records[i] dataUsingEncoding:NSUTF8StringEncoding];
+                expect(@([adapter modelFromString:records[i] error:nil] != nil)).to(equal(accepted[i]));
+                expect(@([adapter modelFromData:data error:nil] != nil)).to(equal(accepted[i]));
+            }
+        });
+
+        it(@"rejects records that omit the field of the filter", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter adapterForModelClass:MAETModel3.class]
+                adapterWithFilters:@[ [MAERecordFilter filterWithPropertyKey:@"optionalString" isEqualTo:@"b"] ]];
+            __block NSError* error = nil;
+            expect([adapter modelFromString:@"a" error:&error]).to(beNil());
+            expect(error.code).to(equal(MAEErrorRejectedByFilter));
+            expect([adapter modelFromString:@"a, b, c" error:&error]).notTo(beNil());
+        });
+
+        it(@"counts rejected records in batches", ^{
+            MAEArrayAdapter* adapter = [[MAEArrayAdapter adapterForModelClass:MAETModel3.class]
+                adapterWithFilters:@[ requireFilter ]];
+
+            NSDictionary<NSNumber*, NSError*>* errors = nil;
+            NSArray* models = [adapter modelsFromString:@"a\nx\nb c, 'd\n" recordSeparator:'\n' errors:&errors];
+            expect(@(models.count)).to(equal(@3));
+            expect(@(errors[@1].code)).to(equal(@(MAEErrorRejectedByFilter)));
+            expect(@(errors[@2].code)).to(equal(@(MAEErrorInvalidInputData)));
+
+            MAEColumnarBatch* batch = [adapter columnarBatchFromData:[@"a\nx\ny\nb c, d" dataUsingEncoding:NSUTF8StringEncoding]
+                                                     recordSeparator:'\n'
+                                                              errors:&errors];
+            expect(errors).to(beNil());
+            expect(@(batch.rowCount)).to(equal(@2));
+            expect(@(batch.rejectedCount)).to(equal(@2));
+            expect([[batch columnForPropertyKey:@"optionalString"] stringAtIndex:1]).to(equal(@"d"));
+
+            NSInputStream* stream = [NSInputStream inputStreamWithData:[@"a\nx\nb c\ny\n" dataUsingEncoding:NSUTF8StringEncoding]];
+            MAEArrayReader* reader = [[MAEArrayReader alloc] initWithModelClass:MAETModel3.class
+                                                                    inputStream:stream
+                                                               recordTerminator:'\n'];
+            reader.filters = @[ requireFilter ];
+            NSMutableArray<MAETModel3*>* readModels = [NSMutableArray array];
+            expect(@([reader readModelsUsingBlock:^(NSArray* chunk, BOOL* stop) {
+                [readModels addObjectsFromArray:chunk];
+            }
+                                            error:nil]))
+                .to(beTrue());
+            expect([readModels valueForKey:@"requireString"]).to(equal(@[ @"a", @"b c" ]));
+            expect(@(reader.acceptedCount)).to(equal(@2));
+            expect(@(reader.rejectedCount)).to(equal(@2));
+        });
+    });
+}
+QuickSpecEnd
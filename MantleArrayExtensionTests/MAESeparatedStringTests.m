@@ -6,6 +6,7 @@
 //  Copyright © 2017年 Hinagiku Soranoba. All rights reserved.
 //
 
+#import "MAEField.h"
 #import "MAESeparatedString.h"
 
 QuickSpecBegin(MAESeparatedStringTests)
@@ -51,6 +52,37 @@ QuickSpecBegin(MAESeparatedStringTests)
         });
     });
 
+    describe(@"lazy characters", ^{
+        it(@"unescapes quotes only when characters contains escaped quotes", ^{
+            MAESeparatedString* s = [[MAESeparatedString alloc] initWithOriginalCharacters:@" \"a\\\"b\" " ignoreEdgeBlank:YES];
+            expect(@(s.type)).to(equal(MAEStringTypeDoubleQuoted));
+            expect(s.length).to(equal(3));
+            expect(@([s characterAtIndex:1])).to(equal('"'));
+            expect(s.characters).to(equal(@"a\"b"));
+            expect(s.originalCharacters).to(equal(@" \"a\\\"b\" "));
+
+            s = [[MAESeparatedString alloc] initWithOriginalCharacters:@"'a\\\"b'" ignoreEdgeBlank:NO];
+            expect(s.length).to(equal(4));
+            expect(s.characters).to(equal(@"a\\\"b"));
+        });
+
+        it(@"refers to the range of the string that the field was created from", ^{
+            MAEField field = { .range = NSMakeRange(4, 8),
+                               .contentRange = NSMakeRange(7, 4),
+                               .type = MAEStringTypeSingleQuoted,
+                               .needsUnescape = NO };
+            NSMutableString* string = [NSMutableString stringWithString:@"abc,  'hoge',def"];
+            MAESeparatedString* s = [[MAESeparatedString alloc] initWithField:field inString:string];
+            [string setString:@""];
+
+            expect(s.originalCharacters).to(equal(@"  'hoge'"));
+            expect(s.characters).to(equal(@"hoge"));
+            expect(s.length).to(equal(4));
+            expect(@([s characterAtIndex:3])).to(equal('e'));
+            expect(@([s characterAtIndex:4])).to(raiseException());
+        });
+    });
+
     describe(@"isEqualToSeparatedString:", ^{
         it(@"can compare NSString and MAESeparatedString", ^{
             MAESeparatedString* s = [[MAESeparatedString alloc] initWithCharacters:@"hoge"
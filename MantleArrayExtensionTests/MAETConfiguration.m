@@ -0,0 +1,26 @@
+//
+//  MAETConfiguration.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAEArrayAdapter.h"
+#import <Foundation/Foundation.h>
+
+@interface MAEArrayAdapter ()
++ (void)removeAllCachedAdapters;
+@end
+
+QuickConfigurationBegin(MAETConfiguration)
+
++ (void)configure:(Configuration*)configuration
+{
+    [configuration beforeEach:^{
+        // NOTE: Some tests stub class methods of models, so adapters MUST NOT be shared between tests.
+        [MAEArrayAdapter removeAllCachedAdapters];
+    }];
+}
+
+QuickConfigurationEnd
@@ -0,0 +1,171 @@
+//
+//  MAETokenizerTests.m
+//  MantleArrayExtension
+//
+//  Created by Hinagiku Soranoba on 2026/10/17.
+//  Copyright © 2026年 Hinagiku Soranoba. All rights reserved.
+//
+
+#import "MAECharacterScanner.h"
+#import "MAETokenizer.h"
+
+@interface MAETokenizer ()
+- (instancetype _Nonnull)initWithSeparator:(unichar)separator
+                           ignoreEdgeBlank:(BOOL)ignoreEdgeBlank
+                             quotedOptions:(MAEArrayQuotedOptions)quotedOptions
+                               scannerKind:(MAEScannerKind)scannerKind;
+@end
+
+QuickSpecBegin(MAETokenizerTests)
+{
+    MAEArrayQuotedOptions bothQuotes = MAEArraySingleQuotedEnable | MAEArrayDoubleQuotedEnable;
+
+    describe(@"tokenizeString:intoFieldList:", ^{
+        it(@"returns ranges, types and whether unescaping is needed", ^{
+            MAETokenizer* tokenizer = [[MAETokenizer alloc] initWithSeparator:',' ignoreEdgeBlank:YES quotedOptions:bothQuotes];
+            NSString* string = @"a, \"b\\\"c\" ,'d',";
+
+            MAEFieldList list;
+            MAEFieldListInit(&list);
+            expect([tokenizer tokenizeString:string intoFieldList:&list]).to(equal(YES));
+            expect(list.count).to(equal(3));
+
+            expect(NSStringFromRange(list.fields[0].range)).to(equal(NSStringFromRange(NSMakeRange(0, 1))));
+            expect(NSStringFromRange(list.fields[0].contentRange)).to(equal(NSStringFromRange(NSMakeRange(0, 1))));
+            expect(@(list.fields[0].type)).to(equal(MAEStringTypeEnumerate));
+            expect(list.fields[0].needsUnescape).to(equal(NO));
+
+            expect(NSStringFromRange(list.fields[1].range)).to(equal(NSStringFromRange(NSMakeRange(2, 8))));
+            expect(NSStringFromRange(list.fields[1].contentRange)).to(equal(NSStringFromRange(NSMakeRange(4, 4))));
+            expect(@(list.fields[1].type)).to(equal(MAEStringTypeDoubleQuoted));
+            expect(list.fields[1].needsUnescape).to(equal(YES));
+
+            expect(NSStringFromRange(list.fields[2].range)).to(equal(NSStringFromRange(NSMakeRange(11, 3))));
+            expect(NSStringFromRange(list.fields[2].contentRange)).to(equal(NSStringFromRange(NSMakeRange(12, 1))));
+            expect(@(list.fields[2].type)).to(equal(MAEStringTypeSingleQuoted));
+            expect(list.fields[2].needsUnescape).to(equal(NO));
+            MAEFieldListDestroy(&list);
+        });
+
+        it(@"returns NO, if there is unclosed quoted string", ^{
+            MAETokenizer* tokenizer = [[MAETokenizer alloc] initWithSeparator:' ' ignoreEdgeBlank:YES quotedOptions:bothQuotes];
+            MAEFieldList list;
+            MAEFieldListInit(&list);
+            expect([tokenizer tokenizeString:@"a \"b c" intoFieldList:&list]).to(equal(NO));
+            MAEFieldListDestroy(&list);
+        });
+
+        it(@"can hold more fields than the inline capacity", ^{
+            MAETokenizer* tokenizer = [[MAETokenizer alloc] initWithSeparator:',' ignoreEdgeBlank:NO quotedOptions:bothQuotes];
+            NSMutableArray* components = [NSMutableArray array];
+            for (NSUInteger i = 0; i < MAEFieldListInlineCapacity * 10; i++) {
+                [components addObject:[@(i) stringValue]];
+            }
+            NSString* string = [components componentsJoinedByString:@","];
+
+            MAEFieldList list;
+            MAEFieldListInit(&list);
+            expect([tokenizer tokenizeString:string intoFieldList:&list]).to(equal(YES));
+            expect(list.count).to(equal(components.count));
+            for (NSUInteger i = 0; i < list.count; i++) {
+                expect([string substringWithRange:list.fields[i].range]).to(equal(components[i]));
+            }
+            MAEFieldListDestroy(&list);
+        });
+
+        it(@"returns the same result as MAESeparatedString, regardless of the storage of string", ^{
+            NSArray<NSString*>* inputs = @[ @"a  b", @"  'a b'  \"c\\\"d\" ", @"'it\\'s' x", @"\\", @"a \\", @"日本 語",
+                                            [@"" stringByPaddingToLength:1000 withString:@"ab 'c' " startingAtIndex:0] ];
+            for (NSString* input in inputs) {
+                for (NSNumber* ignoreEdgeBlank in @[ @YES, @NO ]) {
+                    MAETokenizer* tokenizer = [[MAETokenizer alloc] initWithSeparator:' '
+                                                                      ignoreEdgeBlank:ignoreEdgeBlank.boolValue
+                                                                        quotedOptions:bothQuotes];
+                    // NOTE: A string created from UTF-8 bytes does not have an internal UTF-16 buffer in most cases.
+                    NSString* utf8String = [[NSString alloc] initWithData:[input dataUsingEncoding:NSUTF8StringEncoding]
+                                                                 encoding:NSUTF8StringEncoding];
+                    NSString* utf16String = [[NSString alloc] initWithData:[input dataUsingEncoding:NSUTF16StringEncoding]
+                                                                  encoding:NSUTF16StringEncoding];
+
+                    for (NSString* string in @[ utf8String, utf16String ]) {
+                        MAEFieldList list;
+                        MAEFieldListInit(&list);
+                        if ([tokenizer tokenizeString:string intoFieldList:&list]) {
+                            for (NSUInteger i = 0; i < list.count; i++) {
+                                MAESeparatedString* got = [[MAESeparatedString alloc] initWithField:list.fields[i] inString:string];
+                                MAESeparatedString* expected =
+                                    [[MAESeparatedString alloc] initWithOriginalCharacters:[string substringWithRange:list.fields[i].range]
+                                                                           ignoreEdgeBlank:ignoreEdgeBlank.boolValue];
+                                expect(got.originalCharacters).to(equal(expected.originalCharacters));
+                                expect(got.characters).to(equal(expected.characters));
+                                expect(@(got.type)).to(equal(@(expected.type)));
+                            }
+                        }
+                        MAEFieldListDestroy(&list);
+                    }
+                }
+            }
+        });
+    });
+
+    describe(@"scanner", ^{
+        it(@"returns the same result as the scalar scanner", ^{
+            const unichar alphabet[] = { 'a', ' ', ',', '"', '\'', '\\', 0x3042 };
+            const NSUInteger alphabetCount = sizeof(alphabet) / sizeof(alphabet[0]);
+            const MAEScannerKind kinds[] = { MAEScannerKindAutomatic, MAEScannerKindSSE2, MAEScannerKindAVX2, MAEScannerKindNEON };
+            const MAEArrayQuotedOptions quotedOptions[] = { MAEArrayQuotedNone, MAEArraySingleQuotedEnable,
+                                                            MAEArrayDoubleQuotedEnable, bothQuotes };
+
+            // NOTE: A fixed linear congruential generator makes failures reproducible.
+            __block uint32_t seed = 1;
+            uint32_t (^random)(uint32_t) = ^uint32_t(uint32_t upperBound) {
+                seed = seed * 1103515245 + 12345;
+                return (seed >> 16) % upperBound;
+            };
+
+            unichar chars[100];
+            for (NSUInteger iteration = 0; iteration < 2000; iteration++) {
+                NSUInteger length = random(100);
+                // NOTE: Structural characters are rare in most cases, like real records.
+                BOOL sparse = random(2) == 0;
+                for (NSUInteger i = 0; i < length; i++) {
+                    chars[i] = sparse && random(8) != 0 ? 'a' : alphabet[random(alphabetCount)];
+                }
+                unichar separator = random(2) ? ' ' : ',';
+                BOOL ignoreEdgeBlank = random(2) != 0;
+                MAEArrayQuotedOptions options = quotedOptions[random(4)];
+
+                MAETokenizer* scalarTokenizer = [[MAETokenizer alloc] initWithSeparator:separator
+                                                                         ignoreEdgeBlank:ignoreEdgeBlank
+                                                                           quotedOptions:options
+                                                                             scannerKind:MAEScannerKindScalar];
+                MAEFieldList expected;
+                MAEFieldListInit(&expected);
+                BOOL expectedResult = [scalarTokenizer tokenizeCharacters:chars length:length intoFieldList:&expected];
+
+                for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++) {
+                    if (!MAEScanFunctionForKind(kinds[k])) {
+                        continue;
+                    }
+                    MAETokenizer* tokenizer = [[MAETokenizer alloc] initWithSeparator:separator
+                                                                      ignoreEdgeBlank:ignoreEdgeBlank
+                                                                        quotedOptions:options
+                                                                          scannerKind:kinds[k]];
+                    MAEFieldList list;
+                    MAEFieldListInit(&list);
+                    expect([tokenizer tokenizeCharacters:chars length:length intoFieldList:&list]).to(equal(expectedResult));
+                    expect(list.count).to(equal(expected.count));
+                    for (NSUInteger i = 0; i < MIN(list.count, expected.count); i++) {
+                        expect(NSEqualRanges(list.fields[i].range, expected.fields[i].range)).to(beTrue());
+                        expect(NSEqualRanges(list.fields[i].contentRange, expected.fields[i].contentRange)).to(beTrue());
+                        expect(@(list.fields[i].type)).to(equal(@(expected.fields[i].type)));
+                        expect(list.fields[i].needsUnescape).to(equal(expected.fields[i].needsUnescape));
+                    }
+                    MAEFieldListDestroy(&list);
+                }
+                MAEFieldListDestroy(&expected);
+            }
+        });
+    });
+}
+QuickSpecEnd
@@ -61,3 +61,24 @@
 + (NSValueTransformer* _Nonnull)booleanArrayTransformer;
 
 @end
+
+@interface MAETModel7 : MTLModel <MAEArraySerializing>
+
+@property (nonatomic, assign) NSInteger count;
+
+@end
+
+@interface MAETModel8 : MTLModel <MAEArraySerializing>
+
+@property (nonatomic, nullable, copy) NSString* kind;
+@property (nonatomic, nullable, copy) NSString* value;
+
+@end
+
+@interface MAETModel9 : MTLModel <MAEArraySerializing>
+
+@property (nonatomic, nullable, copy) NSString* name;
+@property (nonatomic, nullable, strong) MAETModel4* model4;
+@property (nonatomic, nullable, strong) MAETModel1* model1;
+
+@end
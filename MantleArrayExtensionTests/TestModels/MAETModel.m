@@ -191,3 +191,84 @@
 }
 
 @end
+
+@implementation MAETModel7
+
+#pragma mark - MAEArraySerializing
+
++ (NSArray* _Nonnull)formatByPropertyKey
+{
+    return @[ @"count" ];
+}
+
+#pragma mark - NSKeyValueCoding
+
+- (BOOL)validateCount:(id _Nullable* _Nonnull)ioValue error:(NSError* _Nullable* _Nullable)error
+{
+    if ([*ioValue integerValue] < 0) {
+        *ioValue = @0;
+    }
+    return YES;
+}
+
+#pragma mark - NSObject (Override)
+
+- (BOOL)validate:(NSError* _Nullable* _Nullable)error
+{
+    if (self.count > 100) {
+        if (error) {
+            *error = [NSError errorWithDomain:@"domain" code:100 userInfo:nil];
+        }
+        return NO;
+    }
+    return [super validate:error];
+}
+
+@end
+
+@implementation MAETModel8
+
+#pragma mark - MAEArraySerializing
+
++ (NSArray* _Nonnull)formatByPropertyKey
+{
+    return @[ @"kind", @"value" ];
+}
+
++ (unichar)separator
+{
+    return ',';
+}
+
++ (BOOL)ignoreEdgeBlank
+{
+    return YES;
+}
+
++ (NSDictionary<NSString*, Class>* _Nonnull)classesByDiscriminator
+{
+    return @{ @"self" : MAETModel8.class, @"text" : MAETModel3.class, @"nest" : MAETModel4.class };
+}
+
+@end
+
+@implementation MAETModel9
+
+#pragma mark - MAEArraySerializing
+
++ (NSArray* _Nonnull)formatByPropertyKey
+{
+    return @[ @"name", @"model4", MAEVariadic(@"model1") ];
+}
+
++ (unichar)separator
+{
+    return ';';
+}
+
++ (NSValueTransformer* _Nonnull)model1ArrayTransformer
+{
+    return [MAEArrayAdapter variadicTransformerWithArrayModelClass:MAETModel1.class];
+}
+
+@end